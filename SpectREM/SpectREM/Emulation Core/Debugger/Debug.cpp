@@ -256,6 +256,6 @@ void Debug::fillMemory(uint16_t fromAddress, uint16_t toAddress, uint8_t value)
 {
     for (uint16_t addr = fromAddress; addr < toAddress; addr++)
     {
-        machine->coreDebugWrite(addr, value, nullptr);
+        machine->z80Core.Z80CoreDebugMemWrite(addr, value, nullptr);
     }
 }
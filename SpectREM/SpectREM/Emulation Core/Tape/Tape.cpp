@@ -29,7 +29,7 @@ static const int cHEADER_CHECKSUM_OFFSET = 17;
 
 static const int cPROGRAM_HEADER_AUTOSTART_LINE_OFFSET = 14;
 static const int cPROGRAM_HEADER_PROGRAM_LENGTH_OFFSET = 16;
-static int cPROGRAM_HEADER_CHECKSUM_OFFSET = 18;
+static const int cPROGRAM_HEADER_CHECKSUM_OFFSET = 18;
 
 //static int cNUMERIC_DATA_HEADER_UNUSED_1_OFFSET = 14;
 //static const int cNUMERIC_DATA_HEADER_VARIBABLE_NAME_OFFSET = 15;
@@ -337,6 +337,51 @@ void Tape::updateWithTs(uint32_t tStates)
 
 }
 
+/**
+ Each state only adds the tStates passed in to its count until the count reaches the length of the pulse. After that the
+ next few calls each do a step of changing the input bit and moving on, so those need to happen an opcode at a time. The
+ pause between blocks is also left to be run an opcode at a time as each call can add a crackle.
+ **/
+uint32_t Tape::tsToNextEdge() const
+{
+   if (currentBlockIndex > static_cast<uint32_t>(blocks.size() - 1) || newBlock || flipTapeBit)
+   {
+       return 0;
+   }
+
+   uint32_t pulseTStates = 0;
+   uint32_t tStates = 0;
+
+   switch (processingState)
+   {
+       case eHEADER_PILOT:
+       case eDATA_PILOT:
+           if (pilotPulses >= static_cast<uint32_t>((processingState == eHEADER_PILOT) ? cPILOT_HEADER_PULSES : cPILOT_DATA_PULSES))
+           {
+               return 0;
+           }
+           pulseTStates = cPILOT_PULSE_TSTATE_LENGTH;
+           tStates = pilotPulseTStates;
+           break;
+       case eSYNC1:
+           pulseTStates = cFIRST_SYNC_PULSE_TSTATE_DELAY;
+           tStates = syncPulseTStates;
+           break;
+       case eSYNC2:
+           pulseTStates = cSECOND_SYNC_PULSE_TSTATE_DELAY;
+           tStates = syncPulseTStates;
+           break;
+       case eDATA_BIT:
+           pulseTStates = dataPulseTStates;
+           tStates = dataBitTStates;
+           break;
+       default:
+           return 0;
+   }
+
+   return (tStates < pulseTStates) ? pulseTStates - tStates : 0;
+}
+
 void Tape::generateHeaderPilotWithTs(uint32_t tStates)
 {
    if (pilotPulses < cPILOT_HEADER_PULSES)
@@ -434,6 +479,17 @@ void Tape::generateSync2WithTs(uint32_t tStates)
 void Tape::tapeGenerateDataStreamWithTs(uint32_t)
 {
    size_t currentBlockLength = blocks[ currentBlockIndex ]->getDataLength();
+
+   // Once every bit of the block has been sent move on to the pause, rather than reading past the end of the block. The
+   // edge at the start of the pause ends the last pulse so the loader can time it
+   if (currentBytePtr >= currentBlockLength)
+   {
+       inputBit ^= 1;
+       processingState = eBLOCK_PAUSE;
+       blockPauseTStates = 0;
+       return;
+   }
+
    uint8_t byte = blocks[ currentBlockIndex ]->blockData[ currentBytePtr ];
    uint8_t bit = (byte << currentDataBit) & 128;
 
@@ -442,12 +498,6 @@ void Tape::tapeGenerateDataStreamWithTs(uint32_t)
    {
        currentDataBit = 0;
        currentBytePtr += 1;
-       if (currentBytePtr > currentBlockLength)
-       {
-           processingState = eBLOCK_PAUSE;
-           blockPauseTStates = 0;
-           return;
-       }
    }
 
    if (bit)
@@ -467,6 +517,15 @@ void Tape::tapeGenerateDataStreamWithTs(uint32_t)
 void Tape::generateHeaderDataStreamWithTs(uint32_t)
 {
    size_t currentBlockLength = cHEADER_BLOCK_LENGTH;
+
+   if (currentBytePtr >= currentBlockLength)
+   {
+       inputBit ^= 1;
+       processingState = eBLOCK_PAUSE;
+       blockPauseTStates = 0;
+       return;
+   }
+
    uint8_t byte = blocks[ currentBlockIndex ]->blockData[ currentBytePtr ];
    uint8_t bit = (byte << currentDataBit) & 128;
 
@@ -476,12 +535,6 @@ void Tape::generateHeaderDataStreamWithTs(uint32_t)
        currentDataBit = 0;
        currentBytePtr += 1;
        tapeCurrentBlock->currentByte += 1;
-       if (currentBytePtr > currentBlockLength)
-       {
-           processingState = eBLOCK_PAUSE;
-           blockPauseTStates = 0;
-           return;
-       }
    }
 
    if (bit)
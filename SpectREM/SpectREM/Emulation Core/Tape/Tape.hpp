@@ -151,6 +151,10 @@ public:
 
     // Updates the tape to generate the tape output. Tstates passed in should be the tStates used in each opcode executed
     void                    updateWithTs(uint32_t tStates);
+    
+    // How many tStates can be passed to a single updateWithTs call with the same result as passing them an opcode at a
+    // time. That is up to the end of the current pulse, after which updateWithTs needs calling for each opcode again
+    uint32_t                tsToNextEdge() const;
 
     // Functions used to control the state of the currently loaded tape
     void                    startPlaying();
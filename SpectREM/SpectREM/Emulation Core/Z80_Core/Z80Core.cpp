@@ -1,4 +1,5 @@
 #include <iostream>
+#include <cstring>
 #include "Z80Core.h"
 
 //-----------------------------------------------------------------------------------------
@@ -7,7 +8,78 @@
 
 //-----------------------------------------------------------------------------------------
 
-CZ80Core::CZ80Core()
+constexpr CZ80CoreBase::Z80ByteTable CZ80CoreBase::BuildSZ35Table()
+{
+    Z80ByteTable table = {};
+
+    for (uint32_t i = 0; i < 256; i++)
+    {
+        table.values[i] = static_cast<uint8_t>(((i == 0) ? FLAG_Z : 0) | (i & (FLAG_S | FLAG_3 | FLAG_5)));
+    }
+
+    return table;
+}
+
+//-----------------------------------------------------------------------------------------
+
+constexpr CZ80CoreBase::Z80ByteTable CZ80CoreBase::BuildParityTable()
+{
+    Z80ByteTable table = {};
+
+    for (uint32_t i = 0; i < 256; i++)
+    {
+        uint32_t parity = i ^ (i >> 4);
+        parity ^= parity >> 2;
+        parity ^= parity >> 1;
+        table.values[i] = (parity & 1) ? 0 : FLAG_P;
+    }
+
+    return table;
+}
+
+//-----------------------------------------------------------------------------------------
+
+constexpr CZ80CoreBase::Z80ByteTable CZ80CoreBase::SZ35Table = CZ80CoreBase::BuildSZ35Table();
+constexpr CZ80CoreBase::Z80ByteTable CZ80CoreBase::ParityTable = CZ80CoreBase::BuildParityTable();
+
+//-----------------------------------------------------------------------------------------
+
+#ifdef Z80CORE_FLAG_TABLES
+uint8_t CZ80CoreBase::AddFlagsTable[2][256][256];
+uint8_t CZ80CoreBase::SubFlagsTable[2][256][256];
+
+void CZ80CoreBase::BuildFlagTables()
+{
+    static const uint8_t add_halfcarry_lookup[] = { 0, FLAG_H, FLAG_H, FLAG_H, 0, 0, 0, FLAG_H };
+    static const uint8_t add_overflow_lookup[] = { 0, 0, 0, FLAG_V, FLAG_V, 0, 0, 0 };
+    static const uint8_t sub_halfcarry_lookup[] = { 0, 0, FLAG_H, 0, FLAG_H, 0, FLAG_H, FLAG_H };
+    static const uint8_t sub_overflow_lookup[] = { 0, FLAG_V, 0, 0, 0, 0, FLAG_V, 0 };
+
+    for (uint32_t carry = 0; carry < 2; carry++)
+    {
+        for (uint32_t a = 0; a < 256; a++)
+        {
+            for (uint32_t value = 0; value < 256; value++)
+            {
+                uint16_t add = static_cast<uint16_t>(a + value + carry);
+                uint16_t sub = static_cast<uint16_t>(a - value - carry);
+                int add_lookup = ((a & 0x88) >> 3) | ((value & 0x88) >> 2) | ((add & 0x88) >> 1);
+                int sub_lookup = ((a & 0x88) >> 3) | ((value & 0x88) >> 2) | ((sub & 0x88) >> 1);
+
+                AddFlagsTable[carry][a][value] = add_halfcarry_lookup[add_lookup & 7] | add_overflow_lookup[add_lookup >> 4] |
+                                                 ((add & 0x100) ? FLAG_C : 0) | (add & (FLAG_S | FLAG_3 | FLAG_5)) | ((add & 0xff) ? 0 : FLAG_Z);
+                SubFlagsTable[carry][a][value] = sub_halfcarry_lookup[sub_lookup & 7] | sub_overflow_lookup[sub_lookup >> 4] | FLAG_N |
+                                                 ((sub & 0x100) ? FLAG_C : 0) | (sub & (FLAG_S | FLAG_3 | FLAG_5)) | ((sub & 0xff) ? 0 : FLAG_Z);
+            }
+        }
+    }
+}
+#endif
+
+//-----------------------------------------------------------------------------------------
+
+template <class Bus>
+CZ80CoreT<Bus>::CZ80CoreT()
 {
     m_MemRead = nullptr;
     m_MemWrite = nullptr;
@@ -15,24 +87,35 @@ CZ80Core::CZ80Core()
     m_IOWrite = nullptr;
     m_MemContentionHandling = nullptr;
     m_DebugRead = nullptr;
+    m_ContendedPages = 0xff;
+    m_ContentionStart = 0;
+    m_ContentionLength = 0xffffffff;
     m_OpcodeCallback = nullptr;
     m_DebugCallback = nullptr;
     m_CPUType = eCPUTYPE_Zilog;
     m_PrevOpcodeFlags = 0;
 
+#ifdef Z80CORE_DECODE_CACHE
+    m_DecodeCache.resize(65536);
+    m_DecodeEpoch = 0;
+#endif
+
+    ClearOpcodeTraps();
     Reset();
 
 }
 
 //-----------------------------------------------------------------------------------------
 
-CZ80Core::~CZ80Core()
+template <class Bus>
+CZ80CoreT<Bus>::~CZ80CoreT()
 {
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Initialise(Z80CoreRead mem_read, Z80CoreWrite mem_write, Z80CoreRead io_read, Z80CoreWrite io_write, Z80CoreContention mem_contention_handling, Z80CoreDebugRead debug_read_handler, Z80CoreDebugWrite debug_write_handler,void *param)
+template <class Bus>
+void CZ80CoreT<Bus>::Initialise(Z80CoreRead mem_read, Z80CoreWrite mem_write, Z80CoreRead io_read, Z80CoreWrite io_write, Z80CoreContention mem_contention_handling, Z80CoreDebugRead debug_read_handler, Z80CoreDebugWrite debug_write_handler,void *param)
 {
     // Store our settings
     m_Param = param;
@@ -44,28 +127,17 @@ void CZ80Core::Initialise(Z80CoreRead mem_read, Z80CoreWrite mem_write, Z80CoreR
     m_DebugRead = debug_read_handler;
     m_Debugwrite = debug_write_handler;
 
-    // Setup the flags tables
-    for (uint16_t i = 0; i < 256; i++)
-    {
-        m_SZ35Table[i] = (i == 0) ? FLAG_Z : 0;
-        m_SZ35Table[i] |= ((i & 0x80) == 0x80) ? FLAG_S : 0;
-        m_SZ35Table[i] |= i & (FLAG_3 | FLAG_5);
-
-        uint8_t parity = 0;
-        uint8_t v = static_cast<uint8_t>(i);
-        for (int b = 0; b < 8; b++)
-        {
-            parity ^= v & 1;
-            v >>= 1;
-        }
-
-        m_ParityTable[i] = (parity ? 0 : FLAG_P);
-    }
+#ifdef Z80CORE_FLAG_TABLES
+    // Built once for every core, which C++11 guarantees is thread safe
+    static const bool flag_tables_built = (BuildFlagTables(), true);
+    (void)flag_tables_built;
+#endif
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RegisterOpcodeCallback(Z80OpcodeCallback callback)
+template <class Bus>
+void CZ80CoreT<Bus>::RegisterOpcodeCallback(Z80OpcodeCallback callback)
 {
     // Set the callback
     m_OpcodeCallback = callback;
@@ -73,78 +145,54 @@ void CZ80Core::RegisterOpcodeCallback(Z80OpcodeCallback callback)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RegisterDebugCallback(Z80DebugCallback callback)
-{
-    // Set the callback
-    m_DebugCallback = callback;
-}
-
-//-----------------------------------------------------------------------------------------
-
-uint8_t CZ80Core::Z80CoreMemRead(uint16_t address, uint32_t tstates)
+template <class Bus>
+void CZ80CoreT<Bus>::AddOpcodeTrap(uint16_t address)
 {
-    // First handle the contention
-    Z80CoreMemoryContention(address, tstates);
-
-    if (m_MemRead != nullptr)
-    {
-        return m_MemRead(address, m_Param);
-    }
-
-    return 0;
+    m_OpcodeTraps[address >> 5] |= (1u << (address & 31));
 }
 
-
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Z80CoreMemWrite(uint16_t address, uint8_t data, uint32_t tstates)
+template <class Bus>
+void CZ80CoreT<Bus>::RemoveOpcodeTrap(uint16_t address)
 {
-    // First handle the contention
-    Z80CoreMemoryContention(address, tstates);
-
-    if (m_MemWrite != nullptr)
-    {
-        m_MemWrite(address, data, m_Param);
-    }
+    m_OpcodeTraps[address >> 5] &= ~(1u << (address & 31));
 }
 
 //-----------------------------------------------------------------------------------------
 
-uint8_t CZ80Core::Z80CoreIORead(uint16_t address)
+template <class Bus>
+void CZ80CoreT<Bus>::ClearOpcodeTraps()
 {
-    if (m_IORead != nullptr)
+    for (uint32_t i = 0; i < 65536 / 32; i++)
     {
-        return m_IORead(address, m_Param);
+        m_OpcodeTraps[i] = 0;
     }
-
-    return 0;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Z80CoreIOWrite(uint16_t address, uint8_t data)
+template <class Bus>
+void CZ80CoreT<Bus>::SetContention(uint8_t page_mask, uint32_t tstates_start, uint32_t tstates_end)
 {
-    if (m_IOWrite != nullptr)
-    {
-        m_IOWrite(address, data, m_Param);
-    }
+    m_ContendedPages = page_mask;
+    m_ContentionStart = tstates_start;
+    m_ContentionLength = tstates_end - tstates_start;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Z80CoreMemoryContention(uint16_t address, uint32_t t_states)
+template <class Bus>
+void CZ80CoreT<Bus>::RegisterDebugCallback(Z80DebugCallback callback)
 {
-    if (m_MemContentionHandling != nullptr)
-    {
-        m_MemContentionHandling(address, t_states, m_Param);
-    }
-
-    m_CPURegisters.TStates += t_states;
+    // Set the callback
+    m_DebugCallback = callback;
 }
 
 //-----------------------------------------------------------------------------------------
 
-uint8_t CZ80Core::Z80CoreDebugMemRead(uint16_t address, void *data)
+template <class Bus>
+uint8_t CZ80CoreT<Bus>::Z80CoreDebugMemRead(uint16_t address, void *data)
 {
     if (m_DebugRead != nullptr)
     {
@@ -155,8 +203,13 @@ uint8_t CZ80Core::Z80CoreDebugMemRead(uint16_t address, void *data)
 }
 
 //-----------------------------------------------------------------------------------------
-void CZ80Core::Z80CoreDebugMemWrite(uint16_t address, uint8_t byte, void *data)
+template <class Bus>
+void CZ80CoreT<Bus>::Z80CoreDebugMemWrite(uint16_t address, uint8_t byte, void *data)
 {
+#ifdef Z80CORE_DECODE_CACHE
+    InvalidateDecode(address);
+#endif
+
     if (m_Debugwrite != nullptr)
     {
         m_Debugwrite(address, byte, m_Param, data);
@@ -166,15 +219,26 @@ void CZ80Core::Z80CoreDebugMemWrite(uint16_t address, uint8_t byte, void *data)
 
 //-----------------------------------------------------------------------------------------
 
-uint32_t CZ80Core::Execute(uint32_t num_tstates, uint32_t int_t_states)
+template <class Bus>
+uint32_t CZ80CoreT<Bus>::Execute(uint32_t num_tstates, uint32_t int_t_states)
+{
+    return ExecuteUntil(m_CPURegisters.TStates + num_tstates, int_t_states);
+}
+
+//-----------------------------------------------------------------------------------------
+
+template <class Bus>
+uint32_t CZ80CoreT<Bus>::ExecuteUntil(uint32_t tstates_horizon, uint32_t int_t_states)
 {
     uint32_t tstates = m_CPURegisters.TStates;
+    bool trapped = false;
 
     do
     {
         // Check if an NMI has been requested
         if (m_CPURegisters.NMIReq)
         {
+            RecordBusEvent(eBUSEVENT_NMIAck, m_CPURegisters.regPC, 0, m_CPURegisters.TStates);
             m_CPURegisters.NMIReq = false;
             m_CPURegisters.IFF1 = 0;
             if (!m_CPURegisters.IntReq)
@@ -207,6 +271,7 @@ uint32_t CZ80Core::Execute(uint32_t num_tstates, uint32_t int_t_states)
                  tell whether the next instruction will be interrupted. */
                 if ( m_Iff2_read )
                 {
+                    EvaluateFlags();
                     m_CPURegisters.regs.regF &= ~FLAG_V;
                 }
 
@@ -218,6 +283,7 @@ uint32_t CZ80Core::Execute(uint32_t num_tstates, uint32_t int_t_states)
                 }
 
                 // Process the interrupt based on its type
+                RecordBusEvent(eBUSEVENT_IntAck, m_CPURegisters.regPC, 0xff, m_CPURegisters.TStates);
                 m_CPURegisters.IFF1 = 0;
                 m_CPURegisters.IFF2 = 0;
                 m_CPURegisters.regR = (m_CPURegisters.regR & 0x80) | ((m_CPURegisters.regR + 1) & 0x7f);
@@ -267,10 +333,52 @@ uint32_t CZ80Core::Execute(uint32_t num_tstates, uint32_t int_t_states)
         // an interrupt, then the parity flag needs to be reset. This only effects NMOS chips and not CMOS
         m_Iff2_read = false;
 
-        Z80OpcodeTable *table = &Main_Opcodes;
+        const Z80OpcodeTable *table = &Main_Opcodes;
+        uint8_t opcode;
+        int8_t offset = 0;
+
+#ifdef Z80CORE_DECODE_CACHE
+        const uint16_t start = m_CPURegisters.regPC;
+        const uint8_t *code = Bus::CodePointer(*this, start);
+        Z80DecodeEntry &entry = m_DecodeCache[start];
+
+        if (code != nullptr && entry.code == code && entry.epoch == m_DecodeEpoch)
+        {
+            // Replay the fetches for their contention, R and T-states without reading the bytes again
+            table = entry.table;
+            opcode = entry.opcode;
+
+            Z80CoreMemoryContention(m_CPURegisters.regPC, 4);
+            RecordBusEvent(eBUSEVENT_Fetch, m_CPURegisters.regPC, code[0], m_CPURegisters.TStates - 4);
+            m_CPURegisters.regPC++;
+            m_CPURegisters.regR = (m_CPURegisters.regR & 0x80) | ((m_CPURegisters.regR + 1) & 0x7f);
+
+            if (entry.length > 1)
+            {
+                Z80CoreMemoryContention(m_CPURegisters.regPC, 4);
+                RecordBusEvent(eBUSEVENT_Fetch, m_CPURegisters.regPC, code[1], m_CPURegisters.TStates - 4);
+                m_CPURegisters.regPC++;
+                m_CPURegisters.regR = (m_CPURegisters.regR & 0x80) | ((m_CPURegisters.regR + 1) & 0x7f);
+            }
+
+            if (entry.length > 2)
+            {
+                Z80CoreMemoryContention(m_CPURegisters.regPC, 3);
+                RecordBusEvent(eBUSEVENT_MemRead, m_CPURegisters.regPC, code[2], m_CPURegisters.TStates - 3);
+                m_CPURegisters.regPC++;
+                m_MEMPTR = ((table == &DDCB_Opcodes) ? m_CPURegisters.reg_pairs.regIX : m_CPURegisters.reg_pairs.regIY) + entry.offset;
+
+                Z80CoreMemoryContention(m_CPURegisters.regPC, 3);
+                RecordBusEvent(eBUSEVENT_MemRead, m_CPURegisters.regPC, code[3], m_CPURegisters.TStates - 3);
+                m_CPURegisters.regPC++;
+            }
+        }
+        else
+        {
+#endif
 
         // Read the opcode
-        uint8_t opcode = Z80CoreMemRead(m_CPURegisters.regPC, 4);
+        opcode = Z80CoreFetch(m_CPURegisters.regPC);
 
         m_CPURegisters.regPC++;
         m_CPURegisters.regR = (m_CPURegisters.regR & 0x80) | ((m_CPURegisters.regR + 1) & 0x7f);
@@ -282,7 +390,7 @@ uint32_t CZ80Core::Execute(uint32_t num_tstates, uint32_t int_t_states)
                 table = &CB_Opcodes;
 
                 // Get the next byte
-                opcode = Z80CoreMemRead(m_CPURegisters.regPC, 4);
+                opcode = Z80CoreFetch(m_CPURegisters.regPC);
                 m_CPURegisters.regPC++;
                 m_CPURegisters.regR = (m_CPURegisters.regR & 0x80) | ((m_CPURegisters.regR + 1) & 0x7f);
                 break;
@@ -290,7 +398,7 @@ uint32_t CZ80Core::Execute(uint32_t num_tstates, uint32_t int_t_states)
             case 0xdd:
 
                 // Get the next byte
-                opcode = Z80CoreMemRead(m_CPURegisters.regPC, 4);
+                opcode = Z80CoreFetch(m_CPURegisters.regPC);
                 m_CPURegisters.regPC++;
                 m_CPURegisters.regR = (m_CPURegisters.regR & 0x80) | ((m_CPURegisters.regR + 1) & 0x7f);
 
@@ -299,7 +407,7 @@ uint32_t CZ80Core::Execute(uint32_t num_tstates, uint32_t int_t_states)
                     table = &DDCB_Opcodes;
 
                     // Read the offset
-                    int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC);
+                    offset = Z80CoreMemRead(m_CPURegisters.regPC);
                     m_CPURegisters.regPC++;
                     m_MEMPTR = m_CPURegisters.reg_pairs.regIX + offset;
 
@@ -317,7 +425,7 @@ uint32_t CZ80Core::Execute(uint32_t num_tstates, uint32_t int_t_states)
                 table = &ED_Opcodes;
 
                 // Get the next byte
-                opcode = Z80CoreMemRead(m_CPURegisters.regPC, 4);
+                opcode = Z80CoreFetch(m_CPURegisters.regPC);
                 m_CPURegisters.regPC++;
                 m_CPURegisters.regR = (m_CPURegisters.regR & 0x80) | ((m_CPURegisters.regR + 1) & 0x7f);
                 break;
@@ -325,7 +433,7 @@ uint32_t CZ80Core::Execute(uint32_t num_tstates, uint32_t int_t_states)
             case 0xfd:
 
                 // Get the next byte
-                opcode = Z80CoreMemRead(m_CPURegisters.regPC, 4);
+                opcode = Z80CoreFetch(m_CPURegisters.regPC);
                 m_CPURegisters.regPC++;
                 m_CPURegisters.regR = (m_CPURegisters.regR & 0x80) | ((m_CPURegisters.regR + 1) & 0x7f);
 
@@ -334,7 +442,7 @@ uint32_t CZ80Core::Execute(uint32_t num_tstates, uint32_t int_t_states)
                     table = &FDCB_Opcodes;
 
                     // Read the offset
-                    int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC);
+                    offset = Z80CoreMemRead(m_CPURegisters.regPC);
                     m_CPURegisters.regPC++;
                     m_MEMPTR = m_CPURegisters.reg_pairs.regIY + offset;
 
@@ -349,14 +457,31 @@ uint32_t CZ80Core::Execute(uint32_t num_tstates, uint32_t int_t_states)
                 break;
         }
 
+#ifdef Z80CORE_DECODE_CACHE
+            // Keep the decoded instruction if all of it came from the same block of plain memory
+            if (code != nullptr && ((start ^ (m_CPURegisters.regPC - 1)) & 0xff00) == 0)
+            {
+                entry.code = code;
+                entry.table = table;
+                entry.epoch = m_DecodeEpoch;
+                entry.opcode = opcode;
+                entry.length = static_cast<uint8_t>(m_CPURegisters.regPC - start);
+                entry.offset = offset;
+
+                m_DecodeBlocks[start >> 13] |= 1u << ((start >> 8) & 31);
+            }
+        }
+#endif
+
         // Handle if the callback wants to skip over this instruction
         bool skip_instruction = false;
 
-        // Handle a callback if needed
-        if (m_OpcodeCallback != nullptr)
+        // Handle a callback if one has been registered and the opcode address has been trapped
+        if (m_OpcodeCallback != nullptr && IsOpcodeTrap(static_cast<uint16_t>(m_CPURegisters.regPC - 1)))
         {
             // Callback before doing the opcode
             skip_instruction = m_OpcodeCallback(opcode, m_CPURegisters.regPC - 1, m_Param);
+            trapped = true;
         }
 
         if ( !skip_instruction )
@@ -369,6 +494,11 @@ uint32_t CZ80Core::Execute(uint32_t num_tstates, uint32_t int_t_states)
 
                 // Remember the details of if we updated flags
                 m_PrevOpcodeFlags = table->entries[opcode].flags;
+
+                if (m_CPURegisters.Halted && opcode == 0x76 && table == &Main_Opcodes && !trapped)
+                {
+                    HaltUntil(tstates_horizon, int_t_states);
+                }
             }
             else
             {
@@ -384,21 +514,132 @@ uint32_t CZ80Core::Execute(uint32_t num_tstates, uint32_t int_t_states)
             }
         }
 
-    } while (m_CPURegisters.TStates - tstates < num_tstates);
+    } while (m_CPURegisters.TStates < tstates_horizon && !trapped);
+
+#ifdef Z80CORE_BUS_EVENTS
+    FlushBusEvents();
+#endif
 
     return m_CPURegisters.TStates - tstates;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SignalInterrupt()
+template <class Bus>
+void CZ80CoreT<Bus>::HaltUntil(uint32_t tstates_horizon, uint32_t int_t_states)
+{
+    // Leave it to ExecuteUntil if an NMI or interrupt is going to be accepted at the top of its next loop
+    if (m_CPURegisters.NMIReq || (m_CPURegisters.IntReq && m_CPURegisters.IFF1 != 0 && m_CPURegisters.TStates < int_t_states))
+    {
+        return;
+    }
+
+    // Otherwise nothing can happen before the horizon other than the HALT opcode being fetched again every 4 T-states,
+    // so only the parts of each fetch that change anything are done. That is the contention for the fetch and R
+    while (m_CPURegisters.TStates < tstates_horizon)
+    {
+        Z80CoreMemoryContention(m_CPURegisters.regPC, 4);
+        RecordBusEvent(eBUSEVENT_Fetch, m_CPURegisters.regPC, 0x76, m_CPURegisters.TStates - 4);
+        m_CPURegisters.regR = (m_CPURegisters.regR & 0x80) | ((m_CPURegisters.regR + 1) & 0x7f);
+    }
+}
+
+//-----------------------------------------------------------------------------------------
+
+#ifdef Z80CORE_BUS_EVENTS
+template <class Bus>
+void CZ80CoreT<Bus>::AddBusEventCallback(Z80BusEventCallback callback, void *param)
+{
+    // Anything recorded so far belongs to the callbacks already registered
+    FlushBusEvents();
+
+    m_BusEventSubscribers.push_back({ callback, param });
+}
+
+//-----------------------------------------------------------------------------------------
+
+template <class Bus>
+void CZ80CoreT<Bus>::RemoveBusEventCallback(Z80BusEventCallback callback, void *param)
+{
+    // Anything recorded so far is still passed to the callback being removed
+    FlushBusEvents();
+
+    for (auto it = m_BusEventSubscribers.begin(); it != m_BusEventSubscribers.end(); ++it)
+    {
+        if (it->callback == callback && it->param == param)
+        {
+            m_BusEventSubscribers.erase(it);
+            break;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------------------
+
+// Passes the events recorded so far to every callback. Called whenever the batch fills and before ExecuteUntil returns
+template <class Bus>
+void CZ80CoreT<Bus>::FlushBusEvents()
+{
+    if (m_BusEventCount != 0)
+    {
+        for (const Z80BusEventSubscriber &subscriber : m_BusEventSubscribers)
+        {
+            subscriber.callback(m_BusEvents, m_BusEventCount, subscriber.param);
+        }
+        m_BusEventCount = 0;
+    }
+}
+
+//-----------------------------------------------------------------------------------------
+#endif
+
+template <class Bus>
+void CZ80CoreT<Bus>::InvalidateDecodeCache()
+{
+#ifdef Z80CORE_DECODE_CACHE
+    // Moving to a new epoch drops every entry at once. The entries only need clearing when the epoch wraps
+    if (++m_DecodeEpoch == 0)
+    {
+        for (Z80DecodeEntry &entry : m_DecodeCache)
+        {
+            entry.code = nullptr;
+        }
+    }
+
+    for (uint32_t &block : m_DecodeBlocks)
+    {
+        block = 0;
+    }
+#endif
+}
+
+//-----------------------------------------------------------------------------------------
+
+#ifdef Z80CORE_DECODE_CACHE
+template <class Bus>
+void CZ80CoreT<Bus>::InvalidateDecode(uint16_t address)
+{
+    // An instruction is at most four bytes long so the byte at address can only belong to one starting there or in
+    // the three bytes before it
+    for (uint16_t i = 0; i < 4; i++)
+    {
+        m_DecodeCache[static_cast<uint16_t>(address - i)].code = nullptr;
+    }
+}
+
+//-----------------------------------------------------------------------------------------
+#endif
+
+template <class Bus>
+void CZ80CoreT<Bus>::SignalInterrupt()
 {
     m_CPURegisters.IntReq = true;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Reset(bool hardReset)
+template <class Bus>
+void CZ80CoreT<Bus>::Reset(bool hardReset)
 {
     // Reset the cpu
     m_CPURegisters.regPC = 0x0000;
@@ -406,6 +647,9 @@ void CZ80Core::Reset(bool hardReset)
     m_CPURegisters.regI = 0;
 
     m_CPURegisters.reg_pairs.regAF = 0xffff;
+#ifdef Z80CORE_LAZY_FLAGS
+    m_LazyFlags.op = eLAZYFLAGS_None;
+#endif
     m_CPURegisters.reg_pairs.regAF_ = 0xffff;
     m_CPURegisters.regSP = 0xffff;
 
@@ -415,7 +659,12 @@ void CZ80Core::Reset(bool hardReset)
     m_CPURegisters.Halted = false;
     m_CPURegisters.EIHandled = false;
     m_CPURegisters.IntReq = false;
+    m_CPURegisters.NMIReq = false;
+    m_CPURegisters.DDFDmultiByte = false;
     m_CPURegisters.TStates = 0;
+    m_MEMPTR = 0;
+
+    InvalidateDecodeCache();
 
     if (hardReset == true)
     {
@@ -432,14 +681,15 @@ void CZ80Core::Reset(bool hardReset)
 
 //-----------------------------------------------------------------------------------------
 
-uint8_t CZ80Core::GetRegister(eZ80BYTEREGISTERS reg) const
+template <class Bus>
+uint8_t CZ80CoreT<Bus>::GetRegister(eZ80BYTEREGISTERS reg) const
 {
     uint8_t data = 0;
 
     switch (reg)
     {
     case eREG_A:		data = m_CPURegisters.regs.regA; break;
-    case eREG_F:		data = m_CPURegisters.regs.regF; break;
+    case eREG_F:		data = GetFlags(); break;
     case eREG_B:		data = m_CPURegisters.regs.regB; break;
     case eREG_C:		data = m_CPURegisters.regs.regC; break;
     case eREG_D:		data = m_CPURegisters.regs.regD; break;
@@ -463,13 +713,14 @@ uint8_t CZ80Core::GetRegister(eZ80BYTEREGISTERS reg) const
 
 //-----------------------------------------------------------------------------------------
 
-uint16_t CZ80Core::GetRegister(eZ80WORDREGISTERS reg) const
+template <class Bus>
+uint16_t CZ80CoreT<Bus>::GetRegister(eZ80WORDREGISTERS reg) const
 {
     uint16_t data = 0;
 
     switch (reg)
     {
-    case eREG_AF:		data = m_CPURegisters.reg_pairs.regAF; break;
+    case eREG_AF:		data = (m_CPURegisters.regs.regA << 8) | GetFlags(); break;
     case eREG_HL:		data = m_CPURegisters.reg_pairs.regHL; break;
     case eREG_BC:		data = m_CPURegisters.reg_pairs.regBC; break;
     case eREG_DE:		data = m_CPURegisters.reg_pairs.regDE; break;
@@ -488,12 +739,13 @@ uint16_t CZ80Core::GetRegister(eZ80WORDREGISTERS reg) const
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SetRegister(eZ80BYTEREGISTERS reg, uint8_t data)
+template <class Bus>
+void CZ80CoreT<Bus>::SetRegister(eZ80BYTEREGISTERS reg, uint8_t data)
 {
     switch (reg)
     {
     case eREG_A:		m_CPURegisters.regs.regA = data; break;
-    case eREG_F:		m_CPURegisters.regs.regF = data; break;
+    case eREG_F:		EvaluateFlags(); m_CPURegisters.regs.regF = data; break;
     case eREG_B:		m_CPURegisters.regs.regB = data; break;
     case eREG_C:		m_CPURegisters.regs.regC = data; break;
     case eREG_D:		m_CPURegisters.regs.regD = data; break;
@@ -515,11 +767,12 @@ void CZ80Core::SetRegister(eZ80BYTEREGISTERS reg, uint8_t data)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SetRegister(eZ80WORDREGISTERS reg, uint16_t data)
+template <class Bus>
+void CZ80CoreT<Bus>::SetRegister(eZ80WORDREGISTERS reg, uint16_t data)
 {
     switch (reg)
     {
-    case eREG_AF:		m_CPURegisters.reg_pairs.regAF = data; break;
+    case eREG_AF:		EvaluateFlags(); m_CPURegisters.reg_pairs.regAF = data; break;
     case eREG_HL:		m_CPURegisters.reg_pairs.regHL = data; break;
     case eREG_BC:		m_CPURegisters.reg_pairs.regBC = data; break;
     case eREG_DE:		m_CPURegisters.reg_pairs.regDE = data; break;
@@ -536,7 +789,61 @@ void CZ80Core::SetRegister(eZ80WORDREGISTERS reg, uint16_t data)
 
 //-----------------------------------------------------------------------------------------
 
-uint32_t CZ80Core::Debug_Disassemble(char *pStr, uint32_t StrLen, uint16_t address, bool hexFormat, void *data)
+template <class Bus>
+void CZ80CoreT<Bus>::GetState(Z80State &state) const
+{
+    memset(&state, 0, sizeof(state));
+
+    // The registers are copied a field at a time as copying the whole of Z80Registers would copy its padding over the
+    // cleared padding in state
+    state.version = Z80STATE_VERSION;
+    state.registers.reg_pairs = m_CPURegisters.reg_pairs;
+    state.registers.regs.regF = GetFlags();
+    state.registers.regSP = m_CPURegisters.regSP;
+    state.registers.regPC = m_CPURegisters.regPC;
+    state.registers.regI = m_CPURegisters.regI;
+    state.registers.regR = m_CPURegisters.regR;
+    state.registers.IFF1 = m_CPURegisters.IFF1;
+    state.registers.IFF2 = m_CPURegisters.IFF2;
+    state.registers.IM = m_CPURegisters.IM;
+    state.registers.Halted = m_CPURegisters.Halted;
+    state.registers.EIHandled = m_CPURegisters.EIHandled;
+    state.registers.IntReq = m_CPURegisters.IntReq;
+    state.registers.NMIReq = m_CPURegisters.NMIReq;
+    state.registers.DDFDmultiByte = m_CPURegisters.DDFDmultiByte;
+    state.registers.TStates = m_CPURegisters.TStates;
+    state.MEMPTR = m_MEMPTR;
+    state.prevOpcodeFlags = m_PrevOpcodeFlags;
+    state.iff2Read = m_Iff2_read;
+    state.LD_I_A = m_LD_I_A;
+}
+
+//-----------------------------------------------------------------------------------------
+
+template <class Bus>
+bool CZ80CoreT<Bus>::SetState(const Z80State &state)
+{
+    if (state.version != Z80STATE_VERSION)
+    {
+        return false;
+    }
+
+    m_CPURegisters = state.registers;
+#ifdef Z80CORE_LAZY_FLAGS
+    m_LazyFlags.op = eLAZYFLAGS_None;
+#endif
+    m_MEMPTR = state.MEMPTR;
+    m_PrevOpcodeFlags = state.prevOpcodeFlags;
+    m_Iff2_read = state.iff2Read;
+    m_LD_I_A = state.LD_I_A;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------------------
+
+template <class Bus>
+uint32_t CZ80CoreT<Bus>::Debug_Disassemble(char *pStr, uint32_t StrLen, uint16_t address, bool hexFormat, void *data)
 {
     // Why would you do this! ;)
     if (pStr == nullptr)
@@ -607,7 +914,8 @@ uint32_t CZ80Core::Debug_Disassemble(char *pStr, uint32_t StrLen, uint16_t addre
 
 //-----------------------------------------------------------------------------------------
 
-char *CZ80Core::Debug_WriteData(uint32_t variableType, char *pStr, uint32_t &StrLen, uint16_t address, bool hexFormat, void *data)
+template <class Bus>
+char *CZ80CoreT<Bus>::Debug_WriteData(uint32_t variableType, char *pStr, uint32_t &StrLen, uint16_t address, bool hexFormat, void *data)
 {
     // Get the number
     uint16_t num = 0;
@@ -679,7 +987,8 @@ char *CZ80Core::Debug_WriteData(uint32_t variableType, char *pStr, uint32_t &Str
 
 //-----------------------------------------------------------------------------------------
 
-uint32_t CZ80Core::Debug_GetOpcodeLength(uint16_t address, void *data)
+template <class Bus>
+uint32_t CZ80CoreT<Bus>::Debug_GetOpcodeLength(uint16_t address, void *data)
 {
     // Remember the start
     uint32_t start_address = address;
@@ -692,7 +1001,8 @@ uint32_t CZ80Core::Debug_GetOpcodeLength(uint16_t address, void *data)
 
 //-----------------------------------------------------------------------------------------
 
-bool CZ80Core::Debug_HasValidOpcode(uint16_t address, void *data)
+template <class Bus>
+bool CZ80CoreT<Bus>::Debug_HasValidOpcode(uint16_t address, void *data)
 {
     if (Debug_GetOpcodeDetails(address, data) == nullptr)
     {
@@ -704,9 +1014,10 @@ bool CZ80Core::Debug_HasValidOpcode(uint16_t address, void *data)
 
 //-----------------------------------------------------------------------------------------
 
-const char *CZ80Core::Debug_GetOpcodeDetails(uint16_t &address, void *data)
+template <class Bus>
+const char *CZ80CoreT<Bus>::Debug_GetOpcodeDetails(uint16_t &address, void *data)
 {
-    Z80OpcodeTable *table = &Main_Opcodes;
+    const Z80OpcodeTable *table = &Main_Opcodes;
 
     // Read the opcode
     uint16_t opcode_length = 0;
@@ -811,8 +1122,16 @@ const char *CZ80Core::Debug_GetOpcodeDetails(uint16_t &address, void *data)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Inc(uint8_t &r)
+template <class Bus>
+void CZ80CoreT<Bus>::Inc(uint8_t &r)
 {
+#ifdef Z80CORE_LAZY_FLAGS
+    m_LazyFlags.operand = GetCarry();
+    r++;
+
+    m_LazyFlags.op = eLAZYFLAGS_Inc;
+    m_LazyFlags.result = r;
+#else
     // Increase the register
     r++;
 
@@ -820,13 +1139,22 @@ void CZ80Core::Inc(uint8_t &r)
     m_CPURegisters.regs.regF = m_CPURegisters.regs.regF & FLAG_C;
     m_CPURegisters.regs.regF |= (r == 0x80) ? FLAG_V : 0;
     m_CPURegisters.regs.regF |= ((r & 0x0f) == 0x00) ? FLAG_H : 0;
-    m_CPURegisters.regs.regF |= m_SZ35Table[r];
+    m_CPURegisters.regs.regF |= SZ35Table[r];
+#endif
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Dec(uint8_t &r)
+template <class Bus>
+void CZ80CoreT<Bus>::Dec(uint8_t &r)
 {
+#ifdef Z80CORE_LAZY_FLAGS
+    m_LazyFlags.operand = GetCarry();
+    r--;
+
+    m_LazyFlags.op = eLAZYFLAGS_Dec;
+    m_LazyFlags.result = r;
+#else
     // Sort the initial flags
     m_CPURegisters.regs.regF = m_CPURegisters.regs.regF & FLAG_C;
     m_CPURegisters.regs.regF |= FLAG_N;
@@ -837,13 +1165,25 @@ void CZ80Core::Dec(uint8_t &r)
 
     // Now sort the flags
     m_CPURegisters.regs.regF |= (r == 0x7f) ? FLAG_V : 0;
-    m_CPURegisters.regs.regF |= m_SZ35Table[r];
+    m_CPURegisters.regs.regF |= SZ35Table[r];
+#endif
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Add8(uint8_t &r)
+template <class Bus>
+void CZ80CoreT<Bus>::Add8(uint8_t &r)
 {
+#ifdef Z80CORE_LAZY_FLAGS
+    m_LazyFlags.op = eLAZYFLAGS_Add;
+    m_LazyFlags.operand = m_CPURegisters.regs.regA;
+    m_LazyFlags.value = r;
+    m_LazyFlags.result = m_CPURegisters.regs.regA + r;
+    m_CPURegisters.regs.regA = m_LazyFlags.result & 0xff;
+#elif defined(Z80CORE_FLAG_TABLES)
+    m_CPURegisters.regs.regF = AddFlagsTable[0][m_CPURegisters.regs.regA][r];
+    m_CPURegisters.regs.regA += r;
+#else
     static uint8_t halfcarry_lookup[] = { 0, FLAG_H, FLAG_H, FLAG_H, 0, 0, 0, FLAG_H };
     static uint8_t overflow_lookup[] = { 0, 0, 0, FLAG_V, FLAG_V, 0, 0, 0 };
 
@@ -859,13 +1199,28 @@ void CZ80Core::Add8(uint8_t &r)
 
     // Finish the flags
     m_CPURegisters.regs.regF |= (full_answer & 0x100) == 0 ? 0 : FLAG_C;
-    m_CPURegisters.regs.regF |= m_SZ35Table[m_CPURegisters.regs.regA];
+    m_CPURegisters.regs.regF |= SZ35Table[m_CPURegisters.regs.regA];
+#endif
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Adc8(uint8_t &r)
+template <class Bus>
+void CZ80CoreT<Bus>::Adc8(uint8_t &r)
 {
+#ifdef Z80CORE_LAZY_FLAGS
+    uint16_t full_answer = m_CPURegisters.regs.regA + r + GetCarry();
+
+    m_LazyFlags.op = eLAZYFLAGS_Add;
+    m_LazyFlags.operand = m_CPURegisters.regs.regA;
+    m_LazyFlags.value = r;
+    m_LazyFlags.result = full_answer;
+    m_CPURegisters.regs.regA = full_answer & 0xff;
+#elif defined(Z80CORE_FLAG_TABLES)
+    uint8_t carry = m_CPURegisters.regs.regF & FLAG_C;
+    m_CPURegisters.regs.regF = AddFlagsTable[carry][m_CPURegisters.regs.regA][r];
+    m_CPURegisters.regs.regA += r + carry;
+#else
     static uint8_t halfcarry_lookup[] = { 0, FLAG_H, FLAG_H, FLAG_H, 0, 0, 0, FLAG_H };
     static uint8_t overflow_lookup[] = { 0, 0, 0, FLAG_V, FLAG_V, 0, 0, 0 };
 
@@ -882,13 +1237,25 @@ void CZ80Core::Adc8(uint8_t &r)
 
     // Finish the flags
     m_CPURegisters.regs.regF |= (full_answer & 0x100) == 0 ? 0 : FLAG_C;
-    m_CPURegisters.regs.regF |= m_SZ35Table[m_CPURegisters.regs.regA];
+    m_CPURegisters.regs.regF |= SZ35Table[m_CPURegisters.regs.regA];
+#endif
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Sub8(uint8_t &r)
+template <class Bus>
+void CZ80CoreT<Bus>::Sub8(uint8_t &r)
 {
+#ifdef Z80CORE_LAZY_FLAGS
+    m_LazyFlags.op = eLAZYFLAGS_Sub;
+    m_LazyFlags.operand = m_CPURegisters.regs.regA;
+    m_LazyFlags.value = r;
+    m_LazyFlags.result = m_CPURegisters.regs.regA - r;
+    m_CPURegisters.regs.regA = m_LazyFlags.result & 0xff;
+#elif defined(Z80CORE_FLAG_TABLES)
+    m_CPURegisters.regs.regF = SubFlagsTable[0][m_CPURegisters.regs.regA][r];
+    m_CPURegisters.regs.regA -= r;
+#else
     static uint8_t halfcarry_lookup[] = { 0, 0, FLAG_H, 0, FLAG_H, 0, FLAG_H, FLAG_H };
     static uint8_t overflow_lookup[] = { 0, FLAG_V, 0, 0, 0, 0, FLAG_V, 0 };
 
@@ -904,13 +1271,28 @@ void CZ80Core::Sub8(uint8_t &r)
 
     // Finish the flags
     m_CPURegisters.regs.regF |= (full_answer & 0x100) == 0 ? 0 : FLAG_C;
-    m_CPURegisters.regs.regF |= m_SZ35Table[m_CPURegisters.regs.regA];
+    m_CPURegisters.regs.regF |= SZ35Table[m_CPURegisters.regs.regA];
+#endif
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Sbc8(uint8_t &r)
+template <class Bus>
+void CZ80CoreT<Bus>::Sbc8(uint8_t &r)
 {
+#ifdef Z80CORE_LAZY_FLAGS
+    uint16_t full_answer = m_CPURegisters.regs.regA - r - GetCarry();
+
+    m_LazyFlags.op = eLAZYFLAGS_Sub;
+    m_LazyFlags.operand = m_CPURegisters.regs.regA;
+    m_LazyFlags.value = r;
+    m_LazyFlags.result = full_answer;
+    m_CPURegisters.regs.regA = full_answer & 0xff;
+#elif defined(Z80CORE_FLAG_TABLES)
+    uint8_t carry = m_CPURegisters.regs.regF & FLAG_C;
+    m_CPURegisters.regs.regF = SubFlagsTable[carry][m_CPURegisters.regs.regA][r];
+    m_CPURegisters.regs.regA -= r + carry;
+#else
     static uint8_t halfcarry_lookup[] = { 0, 0, FLAG_H, 0, FLAG_H, 0, FLAG_H, FLAG_H };
     static uint8_t overflow_lookup[] = { 0, FLAG_V, 0, 0, 0, 0, FLAG_V, 0 };
 
@@ -927,13 +1309,17 @@ void CZ80Core::Sbc8(uint8_t &r)
 
     // Finish the flags
     m_CPURegisters.regs.regF |= (full_answer & 0x100) == 0 ? 0 : FLAG_C;
-    m_CPURegisters.regs.regF |= m_SZ35Table[m_CPURegisters.regs.regA];
+    m_CPURegisters.regs.regF |= SZ35Table[m_CPURegisters.regs.regA];
+#endif
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Add16(uint16_t &r1, uint16_t &r2)
+template <class Bus>
+void CZ80CoreT<Bus>::Add16(uint16_t &r1, uint16_t &r2)
 {
+    EvaluateFlags();
+
     static uint8_t halfcarry_lookup[] = { 0, FLAG_H, FLAG_H, FLAG_H, 0, 0, 0, FLAG_H };
 
     // Set memptr
@@ -956,8 +1342,11 @@ void CZ80Core::Add16(uint16_t &r1, uint16_t &r2)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Adc16(uint16_t &r1, uint16_t &r2)
+template <class Bus>
+void CZ80CoreT<Bus>::Adc16(uint16_t &r1, uint16_t &r2)
 {
+    EvaluateFlags();
+
     static uint8_t halfcarry_lookup[] = { 0, FLAG_H, FLAG_H, FLAG_H, 0, 0, 0, FLAG_H };
     static uint8_t overflow_lookup[] = { 0, 0, 0, FLAG_V, FLAG_V, 0, 0, 0 };
 
@@ -984,8 +1373,11 @@ void CZ80Core::Adc16(uint16_t &r1, uint16_t &r2)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Sbc16(uint16_t &r1, uint16_t &r2)
+template <class Bus>
+void CZ80CoreT<Bus>::Sbc16(uint16_t &r1, uint16_t &r2)
 {
+    EvaluateFlags();
+
     static uint8_t halfcarry_lookup[] = { 0, 0, FLAG_H, 0, FLAG_H, 0, FLAG_H, FLAG_H };
     static uint8_t overflow_lookup[] = { 0, FLAG_V, 0, 0, 0, 0, FLAG_V, 0 };
 
@@ -1012,35 +1404,66 @@ void CZ80Core::Sbc16(uint16_t &r1, uint16_t &r2)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::And(uint8_t &r)
+template <class Bus>
+void CZ80CoreT<Bus>::And(uint8_t &r)
 {
+#ifdef Z80CORE_LAZY_FLAGS
     m_CPURegisters.regs.regA &= r;
-    m_CPURegisters.regs.regF = m_ParityTable[m_CPURegisters.regs.regA];
-    m_CPURegisters.regs.regF |= m_SZ35Table[m_CPURegisters.regs.regA] | FLAG_H;
+    m_LazyFlags.op = eLAZYFLAGS_And;
+    m_LazyFlags.result = m_CPURegisters.regs.regA;
+#else
+    m_CPURegisters.regs.regA &= r;
+    m_CPURegisters.regs.regF = ParityTable[m_CPURegisters.regs.regA];
+    m_CPURegisters.regs.regF |= SZ35Table[m_CPURegisters.regs.regA] | FLAG_H;
+#endif
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Or(uint8_t &r)
+template <class Bus>
+void CZ80CoreT<Bus>::Or(uint8_t &r)
 {
+#ifdef Z80CORE_LAZY_FLAGS
+    m_CPURegisters.regs.regA |= r;
+    m_LazyFlags.op = eLAZYFLAGS_OrXor;
+    m_LazyFlags.result = m_CPURegisters.regs.regA;
+#else
     m_CPURegisters.regs.regA |= r;
-    m_CPURegisters.regs.regF = m_ParityTable[m_CPURegisters.regs.regA];
-    m_CPURegisters.regs.regF |= m_SZ35Table[m_CPURegisters.regs.regA];
+    m_CPURegisters.regs.regF = ParityTable[m_CPURegisters.regs.regA];
+    m_CPURegisters.regs.regF |= SZ35Table[m_CPURegisters.regs.regA];
+#endif
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Xor(uint8_t &r)
+template <class Bus>
+void CZ80CoreT<Bus>::Xor(uint8_t &r)
 {
+#ifdef Z80CORE_LAZY_FLAGS
+    m_CPURegisters.regs.regA ^= r;
+    m_LazyFlags.op = eLAZYFLAGS_OrXor;
+    m_LazyFlags.result = m_CPURegisters.regs.regA;
+#else
     m_CPURegisters.regs.regA ^= r;
-    m_CPURegisters.regs.regF = m_ParityTable[m_CPURegisters.regs.regA];
-    m_CPURegisters.regs.regF |= m_SZ35Table[m_CPURegisters.regs.regA];
+    m_CPURegisters.regs.regF = ParityTable[m_CPURegisters.regs.regA];
+    m_CPURegisters.regs.regF |= SZ35Table[m_CPURegisters.regs.regA];
+#endif
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Cp(uint8_t &r)
+template <class Bus>
+void CZ80CoreT<Bus>::Cp(uint8_t &r)
 {
+#ifdef Z80CORE_LAZY_FLAGS
+    m_LazyFlags.op = eLAZYFLAGS_Cp;
+    m_LazyFlags.operand = m_CPURegisters.regs.regA;
+    m_LazyFlags.value = r;
+    m_LazyFlags.result = m_CPURegisters.regs.regA - r;
+#elif defined(Z80CORE_FLAG_TABLES)
+    // Bits 3 and 5 come from the value compared rather than the result
+    m_CPURegisters.regs.regF = (SubFlagsTable[0][m_CPURegisters.regs.regA][r] & ~(FLAG_3 | FLAG_5)) | (r & (FLAG_3 | FLAG_5));
+#else
     static uint8_t halfcarry_lookup[] = { 0, 0, FLAG_H, 0, FLAG_H, 0, FLAG_H, FLAG_H };
     static uint8_t overflow_lookup[] = { 0, FLAG_V, 0, 0, 0, 0, FLAG_V, 0 };
 
@@ -1056,98 +1479,126 @@ void CZ80Core::Cp(uint8_t &r)
     m_CPURegisters.regs.regF |= (full_answer == 0x00) ? FLAG_Z : 0;
     m_CPURegisters.regs.regF |= ((full_answer & 0x80) == 0x80) ? FLAG_S : 0;
     m_CPURegisters.regs.regF |= (r & (FLAG_3 | FLAG_5));
+#endif
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RLC(uint8_t &r)
+template <class Bus>
+void CZ80CoreT<Bus>::RLC(uint8_t &r)
 {
+    EvaluateFlags();
+
     r = (r << 1) | (r >> 7);
-    m_CPURegisters.regs.regF = m_ParityTable[r];
+    m_CPURegisters.regs.regF = ParityTable[r];
     m_CPURegisters.regs.regF |= (r & 0x01) ? FLAG_C : 0;
-    m_CPURegisters.regs.regF |= m_SZ35Table[r];
+    m_CPURegisters.regs.regF |= SZ35Table[r];
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RRC(uint8_t &r)
+template <class Bus>
+void CZ80CoreT<Bus>::RRC(uint8_t &r)
 {
+    EvaluateFlags();
+
     r = (r >> 1) | (r << 7);
-    m_CPURegisters.regs.regF = m_ParityTable[r];
+    m_CPURegisters.regs.regF = ParityTable[r];
     m_CPURegisters.regs.regF |= (r & 0x80) ? FLAG_C : 0;
-    m_CPURegisters.regs.regF |= m_SZ35Table[r];
+    m_CPURegisters.regs.regF |= SZ35Table[r];
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RL(uint8_t &r)
+template <class Bus>
+void CZ80CoreT<Bus>::RL(uint8_t &r)
 {
+    EvaluateFlags();
+
     uint8_t old_r = r;
     r = (r << 1) | ((m_CPURegisters.regs.regF & FLAG_C) ? 0x01 : 0x00);
-    m_CPURegisters.regs.regF = m_ParityTable[r];
+    m_CPURegisters.regs.regF = ParityTable[r];
     m_CPURegisters.regs.regF |= (old_r & 0x80) ? FLAG_C : 0;
-    m_CPURegisters.regs.regF |= m_SZ35Table[r];
+    m_CPURegisters.regs.regF |= SZ35Table[r];
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RR(uint8_t &r)
+template <class Bus>
+void CZ80CoreT<Bus>::RR(uint8_t &r)
 {
+    EvaluateFlags();
+
     uint8_t old_r = r;
     r = (r >> 1) | ((m_CPURegisters.regs.regF & FLAG_C) ? 0x80 : 0x00);
-    m_CPURegisters.regs.regF = m_ParityTable[r];
+    m_CPURegisters.regs.regF = ParityTable[r];
     m_CPURegisters.regs.regF |= (old_r & 0x01) ? FLAG_C : 0;
-    m_CPURegisters.regs.regF |= m_SZ35Table[r];
+    m_CPURegisters.regs.regF |= SZ35Table[r];
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SLA(uint8_t &r)
+template <class Bus>
+void CZ80CoreT<Bus>::SLA(uint8_t &r)
 {
+    EvaluateFlags();
+
     uint8_t old_r = r;
     r = (r << 1);
-    m_CPURegisters.regs.regF = m_ParityTable[r];
+    m_CPURegisters.regs.regF = ParityTable[r];
     m_CPURegisters.regs.regF |= (old_r & 0x80) ? FLAG_C : 0;
-    m_CPURegisters.regs.regF |= m_SZ35Table[r];
+    m_CPURegisters.regs.regF |= SZ35Table[r];
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SRA(uint8_t &r)
+template <class Bus>
+void CZ80CoreT<Bus>::SRA(uint8_t &r)
 {
+    EvaluateFlags();
+
     uint8_t old_r = r;
     r = (r & 0x80) | (r >> 1);
-    m_CPURegisters.regs.regF = m_ParityTable[r];
+    m_CPURegisters.regs.regF = ParityTable[r];
     m_CPURegisters.regs.regF |= (old_r & 0x01) ? FLAG_C : 0;
-    m_CPURegisters.regs.regF |= m_SZ35Table[r];
+    m_CPURegisters.regs.regF |= SZ35Table[r];
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SRL(uint8_t &r)
+template <class Bus>
+void CZ80CoreT<Bus>::SRL(uint8_t &r)
 {
+    EvaluateFlags();
+
     uint8_t old_r = r;
     r = (r >> 1);
-    m_CPURegisters.regs.regF = m_ParityTable[r];
+    m_CPURegisters.regs.regF = ParityTable[r];
     m_CPURegisters.regs.regF |= (old_r & 0x01) ? FLAG_C : 0;
-    m_CPURegisters.regs.regF |= m_SZ35Table[r];
+    m_CPURegisters.regs.regF |= SZ35Table[r];
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SLL(uint8_t &r)
+template <class Bus>
+void CZ80CoreT<Bus>::SLL(uint8_t &r)
 {
+    EvaluateFlags();
+
     uint8_t old_r = r;
     r = (r << 1) | 0x01;
-    m_CPURegisters.regs.regF = m_ParityTable[r];
+    m_CPURegisters.regs.regF = ParityTable[r];
     m_CPURegisters.regs.regF |= (old_r & 0x80) ? FLAG_C : 0;
-    m_CPURegisters.regs.regF |= m_SZ35Table[r];
+    m_CPURegisters.regs.regF |= SZ35Table[r];
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Bit(uint8_t &r, uint8_t b)
+template <class Bus>
+void CZ80CoreT<Bus>::Bit(uint8_t &r, uint8_t b)
 {
+    EvaluateFlags();
+
     m_CPURegisters.regs.regF &= FLAG_C;
     m_CPURegisters.regs.regF |= FLAG_H;
     m_CPURegisters.regs.regF |= (r & (FLAG_3 | FLAG_5));
@@ -1157,8 +1608,11 @@ void CZ80Core::Bit(uint8_t &r, uint8_t b)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BitWithMemptr(uint8_t &r, uint8_t b)
+template <class Bus>
+void CZ80CoreT<Bus>::BitWithMemptr(uint8_t &r, uint8_t b)
 {
+    EvaluateFlags();
+
     m_CPURegisters.regs.regF &= FLAG_C;
     m_CPURegisters.regs.regF |= FLAG_H;
     m_CPURegisters.regs.regF |= (m_MEMPTR >> 8) & (FLAG_3 | FLAG_5);
@@ -1168,17 +1622,21 @@ void CZ80Core::BitWithMemptr(uint8_t &r, uint8_t b)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Set(uint8_t &r, uint8_t b)
+template <class Bus>
+void CZ80CoreT<Bus>::Set(uint8_t &r, uint8_t b)
 {
     r |= (1 << b);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::Res(uint8_t &r, uint8_t b)
+template <class Bus>
+void CZ80CoreT<Bus>::Res(uint8_t &r, uint8_t b)
 {
     r &= ~(1 << b);
 }
 
 //-----------------------------------------------------------------------------------------
 
+
+#include "Z80CoreInstances.h"
@@ -6,6 +6,11 @@
 #define Z80CORE_H
 
 #include <cstdint>
+#include <type_traits>
+
+#if defined(Z80CORE_DECODE_CACHE) || defined(Z80CORE_BUS_EVENTS)
+#include <vector>
+#endif
 
 //-----------------------------------------------------------------------------------------
 
@@ -17,6 +22,53 @@
 #endif
 #endif
 
+// Define Z80CORE_DECODE_CACHE to have Execute() keep the decoded prefix, opcode table, opcode and DDCB/FDCB offset of
+// each instruction it runs, keyed by its address and where in the machine's memory it was fetched from. When the same
+// instruction is run again the opcode fetches are replayed for their contention, R and T-states without reading or
+// decoding the bytes again. Any write to memory drops the decoded instructions the byte written may be part of, and a
+// bitmap of the 256 byte blocks holding decoded instructions keeps this to a single bit test for data and screen writes.
+// Memory changed by anything other than the CPU or Z80CoreDebugMemWrite needs InvalidateDecodeCache() to be called.
+
+// Define Z80CORE_FLAG_TABLES to have Add8, Adc8, Sub8, Sbc8 and Cp look F up in tables indexed by the carry in, A and
+// the value, rather than working out the half carry and overflow. The ADD/ADC and SUB/SBC tables are 128K each and are
+// shared by every core. With Z80CORE_LAZY_FLAGS the tables are used when F is worked out.
+
+// Define Z80CORE_LAZY_FLAGS to have the 8 bit arithmetic and logic helpers (Add8, Adc8, Sub8, Sbc8, Cp, Inc, Dec, And,
+// Or and Xor) record their operands and result rather than working out F, as it is usually replaced by the next
+// instruction that alters the flags before anything looks at it. Any code that reads or changes F must call
+// EvaluateFlags() first, and code outside the opcodes should use GetFlags(). Without the define both just use F.
+
+// Define Z80CORE_BUS_EVENTS to have the core record each bus cycle it runs, which are opcode fetches, memory reads and
+// writes, IO reads and writes and interrupt acknowledges, along with the T-state the cycle started on after any
+// contention. The events are passed in batches to the callbacks registered with AddBusEventCallback(), whenever the
+// buffer fills and before ExecuteUntil() returns. Nothing is recorded while no callbacks are registered and without
+// the define none of this is built.
+
+// The core is a template, CZ80CoreT<Bus>, where Bus supplies memory, IO and memory contention handling. A Bus
+// is a class of static functions that are passed the core so they can get to its state:
+//
+//      static uint8_t  MemRead(CZ80CoreT<Bus> &core, uint16_t address);
+//      static void     MemWrite(CZ80CoreT<Bus> &core, uint16_t address, uint8_t data);
+//      static void     MemContention(CZ80CoreT<Bus> &core, uint16_t address, uint32_t tstates);
+//      static uint8_t  IORead(CZ80CoreT<Bus> &core, uint16_t address);
+//      static void     IOWrite(CZ80CoreT<Bus> &core, uint16_t address, uint8_t data);
+//      static const uint8_t *CodePointer(CZ80CoreT<Bus> &core, uint16_t address);
+//
+// CodePointer is only used by the decode cache. It returns where the byte at address is held, or nullptr if reading
+// it can do more than return the byte or the same memory can also be seen at another address. The pointer must stay
+// valid for the 256 byte block address is in until the memory is paged out.
+//
+// As the bus is known at compile time these are inlined into every opcode. CZ80Core is the core built with
+// CZ80CoreCallbackBus which calls through the function pointers passed to Initialise(). Every bus the core is
+// built for is listed in Z80CoreInstances.h.
+//
+// Threads: every core keeps all of its state in the instance, so any number of cores can be run at the same time on
+// different threads. A single core is not thread safe and must only be used by one thread at a time, and the bus,
+// opcode and bus event callbacks are called on whichever thread is running it. The only state shared between cores
+// is the opcode, parity and SZ35 tables, which are const and built by the compiler, and the Z80CORE_FLAG_TABLES
+// tables. Those are too large to build at compile time so they are built once by the first call to Initialise()
+// using a function local static, so cores can be initialised from several threads at once.
+
 //-----------------------------------------------------------------------------------------
 
 typedef uint8_t (*Z80CoreRead)(uint16_t address, void *param);
@@ -29,7 +81,8 @@ typedef char *(*Z80DebugCallback)(char *buffer, uint32_t variableType, uint16_t
 
 //-----------------------------------------------------------------------------------------
 
-class CZ80Core
+// Types and constants shared by every CZ80CoreT so they can be used as CZ80Core::eREG_PC etc. whatever the bus
+class CZ80CoreBase
 {
 public:
     typedef enum
@@ -88,20 +141,6 @@ public:
         eVARIABLETYPE_RelativeOffset,
     } eVARIABLETYPE;
 
-    static const uint8_t FLAG_C = 0x01;
-    static const uint8_t FLAG_N = 0x02;
-    static const uint8_t FLAG_P = 0x04;
-    static const uint8_t FLAG_V = FLAG_P;
-    static const uint8_t FLAG_3 = 0x08;
-    static const uint8_t FLAG_H = 0x10;
-    static const uint8_t FLAG_5 = 0x20;
-    static const uint8_t FLAG_Z = 0x40;
-    static const uint8_t FLAG_S = 0x80;
-
-private:
-
-    static const uint32_t OPCODEFLAG_AltersFlags = (1 << 0);
-
     typedef struct
     {
         union
@@ -168,11 +207,96 @@ private:
         bool            DDFDmultiByte;
 
         uint32_t	TStates;
+    } Z80Registers;
+
+    // Everything needed to put a core back exactly as it was, including the state GetRegister/SetRegister can't reach.
+    // It is plain data so it can be copied with memcpy, held in a ring buffer for rewind or compared with memcmp, as
+    // GetState clears the padding. F is always held evaluated so a state is the same whichever options the core was
+    // built with. The version is bumped whenever the layout changes and SetState rejects any other version
+    static const uint32_t Z80STATE_VERSION = 1;
+
+    typedef struct
+    {
+        uint32_t            version;
+        Z80Registers        registers;
+        uint16_t            MEMPTR;
+        uint32_t            prevOpcodeFlags;
+        bool                iff2Read;
+        bool                LD_I_A;
     } Z80State;
 
+    static const uint8_t FLAG_C = 0x01;
+    static const uint8_t FLAG_N = 0x02;
+    static const uint8_t FLAG_P = 0x04;
+    static const uint8_t FLAG_V = FLAG_P;
+    static const uint8_t FLAG_3 = 0x08;
+    static const uint8_t FLAG_H = 0x10;
+    static const uint8_t FLAG_5 = 0x20;
+    static const uint8_t FLAG_Z = 0x40;
+    static const uint8_t FLAG_S = 0x80;
+
+    // The bus events are only recorded when Z80CORE_BUS_EVENTS is defined
+    typedef enum
+    {
+        eBUSEVENT_Fetch,
+        eBUSEVENT_MemRead,
+        eBUSEVENT_MemWrite,
+        eBUSEVENT_IORead,
+        eBUSEVENT_IOWrite,
+        eBUSEVENT_IntAck,       // Address is the PC being pushed
+        eBUSEVENT_NMIAck,
+    } eBUSEVENT;
+
+    typedef struct
+    {
+        uint32_t            tstates;    // When the cycle started, after any contention
+        uint16_t            address;
+        uint8_t             data;
+        uint8_t             type;       // eBUSEVENT
+    } Z80BusEvent;
+
+    typedef void (*Z80BusEventCallback)(const Z80BusEvent *events, uint32_t count, void *param);
+
+protected:
     typedef struct
     {
-        void (CZ80Core::*function)(uint8_t opcode);
+        uint8_t             values[256];
+
+        constexpr uint8_t   operator[](uint32_t index) const { return values[index]; }
+    } Z80ByteTable;
+
+    // Built by the compiler so there is nothing to set up when a core is created
+    static constexpr Z80ByteTable BuildSZ35Table();
+    static constexpr Z80ByteTable BuildParityTable();
+
+    static const Z80ByteTable SZ35Table;                    // S, Z, 3 and 5 flags for a result
+    static const Z80ByteTable ParityTable;                  // P flag for a result with even parity
+
+#ifdef Z80CORE_FLAG_TABLES
+protected:
+    static void             BuildFlagTables();
+
+    static uint8_t          AddFlagsTable[2][256][256];     // [carry in][A][value]
+    static uint8_t          SubFlagsTable[2][256][256];
+#endif
+};
+
+static_assert(std::is_trivially_copyable<CZ80CoreBase::Z80State>::value, "Z80State must be safe to copy with memcpy");
+
+//-----------------------------------------------------------------------------------------
+
+template <class Bus>
+class CZ80CoreT : public CZ80CoreBase
+{
+    friend Bus;
+
+private:
+
+    static const uint32_t OPCODEFLAG_AltersFlags = (1 << 0);
+
+    typedef struct
+    {
+        void (CZ80CoreT::*function)(uint8_t opcode);
         uint32_t flags;
         const char* format;
     } Z80Opcode;
@@ -182,10 +306,44 @@ private:
         Z80Opcode entries[256];
     } Z80OpcodeTable;
 
+#ifdef Z80CORE_LAZY_FLAGS
+    typedef enum
+    {
+        eLAZYFLAGS_None,
+        eLAZYFLAGS_Add,
+        eLAZYFLAGS_Sub,
+        eLAZYFLAGS_Cp,
+        eLAZYFLAGS_Inc,
+        eLAZYFLAGS_Dec,
+        eLAZYFLAGS_And,
+        eLAZYFLAGS_OrXor,
+    } eLAZYFLAGS;
+
+    typedef struct
+    {
+        uint8_t             op;         // eLAZYFLAGS_None when F is up to date
+        uint8_t             operand;    // A before the operation, or the carry flag before INC/DEC
+        uint8_t             value;      // What was added to, subtracted from or compared with A
+        uint16_t            result;     // Full result including any carry or borrow out of bit 7
+    } Z80LazyFlags;
+#endif
+
+#ifdef Z80CORE_DECODE_CACHE
+    typedef struct
+    {
+        const uint8_t       *code;      // Where the first byte was fetched from, nullptr if the entry is empty
+        const Z80OpcodeTable *table;
+        uint16_t            epoch;
+        uint8_t             opcode;
+        uint8_t             length;     // Number of bytes fetched, 1 - 4
+        int8_t              offset;     // DDCB/FDCB index offset
+    } Z80DecodeEntry;
+#endif
+
 
 public:
-    CZ80Core();
-    ~CZ80Core();
+    CZ80CoreT();
+    ~CZ80CoreT();
 
 public:
     void					Initialise(Z80CoreRead mem_read, Z80CoreWrite mem_write, Z80CoreRead io_read, Z80CoreWrite io_write,Z80CoreContention mem_contention_handling, Z80CoreDebugRead debug_read_handler, Z80CoreDebugWrite debug_write_handler,void *member_class);
@@ -196,9 +354,29 @@ public:
     bool					Debug_HasValidOpcode(uint16_t address, void *data);
     uint32_t 			    Execute(uint32_t num_tstates = 0, uint32_t int_t_states = 32);
 
+    // Runs instructions until the T-state count reaches tstates_horizon, which the caller sets to the T-state of the next
+    // event it has to handle. At least one instruction is always run and the run ends early after an instruction that
+    // has been trapped so the caller can act on what the opcode callback did. Returns the number of T-states run
+    uint32_t 			    ExecuteUntil(uint32_t tstates_horizon, uint32_t int_t_states = 32);
+
     void					RegisterOpcodeCallback(Z80OpcodeCallback callback);
     void					RegisterDebugCallback(Z80DebugCallback callback);
 
+    // The opcode callback is only called for addresses that have been registered as traps
+    void					AddOpcodeTrap(uint16_t address);
+    void					RemoveOpcodeTrap(uint16_t address);
+    void					ClearOpcodeTraps();
+    bool					IsOpcodeTrap(uint16_t address) const { return (m_OpcodeTraps[address >> 5] & (1u << (address & 31))) != 0; }
+
+    // Drops every decoded instruction. Does nothing unless Z80CORE_DECODE_CACHE is defined
+    void					InvalidateDecodeCache();
+
+#ifdef Z80CORE_BUS_EVENTS
+    void					AddBusEventCallback(Z80BusEventCallback callback, void *param);
+    void					RemoveBusEventCallback(Z80BusEventCallback callback, void *param);
+    void					FlushBusEvents();
+#endif
+
     void					SignalInterrupt();
 
     bool					IsInterruptRequesting() const { return (m_CPURegisters.IntReq != 0); }
@@ -207,6 +385,12 @@ public:
     uint16_t			    GetRegister(eZ80WORDREGISTERS reg) const;
     void					SetRegister(eZ80BYTEREGISTERS reg, uint8_t data);
     void					SetRegister(eZ80WORDREGISTERS reg, uint16_t data);
+    uint8_t			        GetFlags() const;
+
+    // Copies the whole of the CPU state out of or back into the core. SetState returns false, leaving the core as it
+    // was, if the state is from a different Z80STATE_VERSION
+    void					GetState(Z80State &state) const;
+    bool					SetState(const Z80State &state);
 
     void					SetIMMode(uint8_t im) { m_CPURegisters.IM = im; m_CPURegisters.IntReq = 0; }
     uint8_t			        GetIMMode() const { return m_CPURegisters.IM; }
@@ -220,6 +404,11 @@ public:
 
     bool                    isLD_I_A() { return m_LD_I_A; }
 
+    // Memory contention is only passed to the contention handler for addresses in an 8K page with its bit set in
+    // page_mask, while the T-state count is within [tstates_start, tstates_end). By default every access is passed on.
+    // Only used by CZ80Core, other buses handle contention themselves
+    void					SetContention(uint8_t page_mask, uint32_t tstates_start, uint32_t tstates_end);
+
     void					AddContentionTStates(uint32_t extra_tstates) { m_CPURegisters.TStates += extra_tstates; }
     void					AddTStates(uint32_t extra_tstates) { m_CPURegisters.TStates += extra_tstates; }
 
@@ -236,6 +425,10 @@ public:
     uint8_t			        Z80CoreDebugMemRead(uint16_t address, void *data);
     void                    Z80CoreDebugMemWrite(uint16_t address, uint8_t byte, void *data);
 protected:
+    uint8_t			        Z80CoreFetch(uint16_t address);
+    void					RecordBusEvent(uint8_t type, uint16_t address, uint8_t data, uint32_t tstates);
+
+
     #include "Z80Core_MainOpcodes.h"
     #include "Z80Core_CBOpcodes.h"
     #include "Z80Core_DDOpcodes.h"
@@ -269,25 +462,35 @@ protected:
     void					Set(uint8_t &r, uint8_t b);
     void					Res(uint8_t &r, uint8_t b);
 
+    void					EvaluateFlags();
+    uint8_t			        GetCarry() const;
+
+    void					HaltUntil(uint32_t tstates_horizon, uint32_t int_t_states);
+
+#ifdef Z80CORE_DECODE_CACHE
+    void					InvalidateDecode(uint16_t address);
+#endif
+
     const char			*	Debug_GetOpcodeDetails(uint16_t &address, void *data);
     char				*	Debug_WriteData(uint32_t variableType, char *pStr, uint32_t &StrLen, uint16_t address, bool hexFormat, void *data);
 
 protected:
-    static Z80OpcodeTable	Main_Opcodes;
-    static Z80OpcodeTable	CB_Opcodes;
-    static Z80OpcodeTable	DD_Opcodes;
-    static Z80OpcodeTable	ED_Opcodes;
-    static Z80OpcodeTable	FD_Opcodes;
-    static Z80OpcodeTable	DDCB_Opcodes;
-    static Z80OpcodeTable	FDCB_Opcodes;
-
-    Z80State				m_CPURegisters;
-    uint8_t			        m_ParityTable[256];
-    uint8_t			        m_SZ35Table[256];
+    static const Z80OpcodeTable Main_Opcodes;
+    static const Z80OpcodeTable CB_Opcodes;
+    static const Z80OpcodeTable DD_Opcodes;
+    static const Z80OpcodeTable ED_Opcodes;
+    static const Z80OpcodeTable FD_Opcodes;
+    static const Z80OpcodeTable DDCB_Opcodes;
+    static const Z80OpcodeTable FDCB_Opcodes;
+
+    Z80Registers			m_CPURegisters;
     uint16_t			    m_MEMPTR;
     eCPUTYPE				m_CPUType;
     uint32_t			m_PrevOpcodeFlags;
     bool                    m_Iff2_read = false;
+#ifdef Z80CORE_LAZY_FLAGS
+    Z80LazyFlags            m_LazyFlags = { eLAZYFLAGS_None, 0, 0, 0 };
+#endif
     bool                    m_LD_I_A = false;
 
     bool                    paused = false;
@@ -298,13 +501,297 @@ protected:
     Z80CoreRead				m_IORead;
     Z80CoreWrite			m_IOWrite;
     Z80CoreContention		m_MemContentionHandling;
+    uint8_t                 m_ContendedPages;
+    uint32_t                m_ContentionStart;
+    uint32_t                m_ContentionLength;
     Z80CoreDebugRead		m_DebugRead;
     Z80CoreDebugWrite       m_Debugwrite;
 
     Z80OpcodeCallback		m_OpcodeCallback;
     Z80DebugCallback		m_DebugCallback;
+
+    // One bit per address, set when the opcode callback should be called for an opcode at that address
+    uint32_t                m_OpcodeTraps[65536 / 32];
+
+#ifdef Z80CORE_DECODE_CACHE
+    // One entry per address, valid when its code pointer matches the bus and its epoch matches m_DecodeEpoch
+    std::vector<Z80DecodeEntry> m_DecodeCache;
+    uint16_t                m_DecodeEpoch;
+
+    // One bit per 256 byte block, set when the block holds a decoded instruction
+    uint32_t                m_DecodeBlocks[256 / 32];
+#endif
+
+#ifdef Z80CORE_BUS_EVENTS
+    static const uint32_t   BUSEVENT_BATCH = 256;
+
+    typedef struct
+    {
+        Z80BusEventCallback callback;
+        void                *param;
+    } Z80BusEventSubscriber;
+
+    std::vector<Z80BusEventSubscriber> m_BusEventSubscribers;
+    Z80BusEvent             m_BusEvents[BUSEVENT_BATCH];
+    uint32_t                m_BusEventCount = 0;
+#endif
 };
 
+//-----------------------------------------------------------------------------------------
+// Memory and IO access go through the bus. These are defined here so they can be inlined into the opcodes
+
+template <class Bus>
+inline uint8_t CZ80CoreT<Bus>::Z80CoreMemRead(uint16_t address, uint32_t tstates)
+{
+    // First handle the contention
+    Z80CoreMemoryContention(address, tstates);
+
+    uint8_t data = Bus::MemRead(*this, address);
+    RecordBusEvent(eBUSEVENT_MemRead, address, data, m_CPURegisters.TStates - tstates);
+    return data;
+}
+
+//-----------------------------------------------------------------------------------------
+
+// An opcode fetch, which is a 4 T-state memory read
+template <class Bus>
+inline uint8_t CZ80CoreT<Bus>::Z80CoreFetch(uint16_t address)
+{
+    Z80CoreMemoryContention(address, 4);
+
+    uint8_t data = Bus::MemRead(*this, address);
+    RecordBusEvent(eBUSEVENT_Fetch, address, data, m_CPURegisters.TStates - 4);
+    return data;
+}
+
+//-----------------------------------------------------------------------------------------
+
+template <class Bus>
+inline void CZ80CoreT<Bus>::Z80CoreMemWrite(uint16_t address, uint8_t data, uint32_t tstates)
+{
+    // First handle the contention
+    Z80CoreMemoryContention(address, tstates);
+
+#ifdef Z80CORE_DECODE_CACHE
+    if (m_DecodeBlocks[address >> 13] & (1u << ((address >> 8) & 31)))
+    {
+        InvalidateDecode(address);
+    }
+#endif
+
+    RecordBusEvent(eBUSEVENT_MemWrite, address, data, m_CPURegisters.TStates - tstates);
+    Bus::MemWrite(*this, address, data);
+}
+
+//-----------------------------------------------------------------------------------------
+
+template <class Bus>
+inline uint8_t CZ80CoreT<Bus>::Z80CoreIORead(uint16_t address)
+{
+    uint32_t tstates = m_CPURegisters.TStates;
+    uint8_t data = Bus::IORead(*this, address);
+    RecordBusEvent(eBUSEVENT_IORead, address, data, tstates);
+    return data;
+}
+
+//-----------------------------------------------------------------------------------------
+
+template <class Bus>
+inline void CZ80CoreT<Bus>::Z80CoreIOWrite(uint16_t address, uint8_t data)
+{
+    RecordBusEvent(eBUSEVENT_IOWrite, address, data, m_CPURegisters.TStates);
+    Bus::IOWrite(*this, address, data);
+}
+
+//-----------------------------------------------------------------------------------------
+
+// Does nothing unless Z80CORE_BUS_EVENTS is defined and something has registered for the events
+template <class Bus>
+inline void CZ80CoreT<Bus>::RecordBusEvent(uint8_t type, uint16_t address, uint8_t data, uint32_t tstates)
+{
+#ifdef Z80CORE_BUS_EVENTS
+    if (!m_BusEventSubscribers.empty())
+    {
+        Z80BusEvent &event = m_BusEvents[m_BusEventCount++];
+        event.tstates = tstates;
+        event.address = address;
+        event.data = data;
+        event.type = type;
+
+        if (m_BusEventCount == BUSEVENT_BATCH)
+        {
+            FlushBusEvents();
+        }
+    }
+#else
+    (void)type; (void)address; (void)data; (void)tstates;
+#endif
+}
+
+//-----------------------------------------------------------------------------------------
+
+template <class Bus>
+inline void CZ80CoreT<Bus>::Z80CoreMemoryContention(uint16_t address, uint32_t t_states)
+{
+    Bus::MemContention(*this, address, t_states);
+
+    m_CPURegisters.TStates += t_states;
+}
+
+//-----------------------------------------------------------------------------------------
+
+template <class Bus>
+inline uint8_t CZ80CoreT<Bus>::GetFlags() const
+{
+#ifdef Z80CORE_LAZY_FLAGS
+#ifndef Z80CORE_FLAG_TABLES
+    static const uint8_t add_halfcarry_lookup[] = { 0, FLAG_H, FLAG_H, FLAG_H, 0, 0, 0, FLAG_H };
+    static const uint8_t add_overflow_lookup[] = { 0, 0, 0, FLAG_V, FLAG_V, 0, 0, 0 };
+    static const uint8_t sub_halfcarry_lookup[] = { 0, 0, FLAG_H, 0, FLAG_H, 0, FLAG_H, FLAG_H };
+    static const uint8_t sub_overflow_lookup[] = { 0, FLAG_V, 0, 0, 0, 0, FLAG_V, 0 };
+#endif
+
+    const Z80LazyFlags &lazy = m_LazyFlags;
+    uint8_t r = lazy.result & 0xff;
+#ifndef Z80CORE_FLAG_TABLES
+    uint8_t carry = (lazy.result & 0x100) ? FLAG_C : 0;
+    int lookup = ((lazy.operand & 0x88) >> 3) | ((lazy.value & 0x88) >> 2) | ((lazy.result & 0x88) >> 1);
+#endif
+
+    switch (lazy.op)
+    {
+#ifdef Z80CORE_FLAG_TABLES
+        // The carry in is whatever is left over once the operand and value have been taken away from the result
+        case eLAZYFLAGS_Add:
+            return AddFlagsTable[(lazy.result - lazy.operand - lazy.value) & 1][lazy.operand][lazy.value];
+
+        case eLAZYFLAGS_Sub:
+            return SubFlagsTable[(lazy.operand - lazy.value - lazy.result) & 1][lazy.operand][lazy.value];
+
+        case eLAZYFLAGS_Cp:
+            return (SubFlagsTable[0][lazy.operand][lazy.value] & ~(FLAG_3 | FLAG_5)) | (lazy.value & (FLAG_3 | FLAG_5));
+#else
+        case eLAZYFLAGS_Add:
+            return add_halfcarry_lookup[lookup & 7] | add_overflow_lookup[lookup >> 4] | carry | SZ35Table[r];
+
+        case eLAZYFLAGS_Sub:
+            return sub_halfcarry_lookup[lookup & 7] | sub_overflow_lookup[lookup >> 4] | FLAG_N | carry | SZ35Table[r];
+
+        case eLAZYFLAGS_Cp:
+            // Bits 3 and 5 come from the value compared rather than the result
+            return sub_halfcarry_lookup[lookup & 7] | sub_overflow_lookup[lookup >> 4] | FLAG_N | carry |
+                   ((lazy.result == 0x00) ? FLAG_Z : 0) | (r & FLAG_S) | (lazy.value & (FLAG_3 | FLAG_5));
+#endif
+
+        case eLAZYFLAGS_Inc:
+            return lazy.operand | ((r == 0x80) ? FLAG_V : 0) | (((r & 0x0f) == 0x00) ? FLAG_H : 0) | SZ35Table[r];
+
+        case eLAZYFLAGS_Dec:
+            return lazy.operand | FLAG_N | (((r & 0x0f) == 0x0f) ? FLAG_H : 0) | ((r == 0x7f) ? FLAG_V : 0) | SZ35Table[r];
+
+        case eLAZYFLAGS_And:
+            return ParityTable[r] | SZ35Table[r] | FLAG_H;
+
+        case eLAZYFLAGS_OrXor:
+            return ParityTable[r] | SZ35Table[r];
+    }
+#endif
+
+    return m_CPURegisters.regs.regF;
+}
+
+//-----------------------------------------------------------------------------------------
+
+template <class Bus>
+inline void CZ80CoreT<Bus>::EvaluateFlags()
+{
+#ifdef Z80CORE_LAZY_FLAGS
+    if (m_LazyFlags.op != eLAZYFLAGS_None)
+    {
+        m_CPURegisters.regs.regF = GetFlags();
+        m_LazyFlags.op = eLAZYFLAGS_None;
+    }
+#endif
+}
+
+//-----------------------------------------------------------------------------------------
+
+// Returns the carry flag as 0 or 1
+template <class Bus>
+inline uint8_t CZ80CoreT<Bus>::GetCarry() const
+{
+#ifdef Z80CORE_LAZY_FLAGS
+    switch (m_LazyFlags.op)
+    {
+        case eLAZYFLAGS_None:
+            break;
+
+        case eLAZYFLAGS_Inc:
+        case eLAZYFLAGS_Dec:
+            return m_LazyFlags.operand;
+
+        case eLAZYFLAGS_And:
+        case eLAZYFLAGS_OrXor:
+            return 0;
+
+        default:
+            return (m_LazyFlags.result >> 8) & 1;
+    }
+#endif
+
+    return m_CPURegisters.regs.regF & FLAG_C;
+}
+
+//-----------------------------------------------------------------------------------------
+
+// Calls through the function pointers passed to CZ80CoreT::Initialise()
+class CZ80CoreCallbackBus
+{
+public:
+    static uint8_t MemRead(CZ80CoreT<CZ80CoreCallbackBus> &core, uint16_t address)
+    {
+        return (core.m_MemRead != nullptr) ? core.m_MemRead(address, core.m_Param) : 0;
+    }
+
+    static void MemWrite(CZ80CoreT<CZ80CoreCallbackBus> &core, uint16_t address, uint8_t data)
+    {
+        if (core.m_MemWrite != nullptr)
+        {
+            core.m_MemWrite(address, data, core.m_Param);
+        }
+    }
+
+    static void MemContention(CZ80CoreT<CZ80CoreCallbackBus> &core, uint16_t address, uint32_t tstates)
+    {
+        if (core.m_MemContentionHandling != nullptr && (core.m_ContendedPages & (1 << (address >> 13)))
+            && core.m_CPURegisters.TStates - core.m_ContentionStart < core.m_ContentionLength)
+        {
+            core.m_MemContentionHandling(address, tstates, core.m_Param);
+        }
+    }
+
+    static uint8_t IORead(CZ80CoreT<CZ80CoreCallbackBus> &core, uint16_t address)
+    {
+        return (core.m_IORead != nullptr) ? core.m_IORead(address, core.m_Param) : 0;
+    }
+
+    static void IOWrite(CZ80CoreT<CZ80CoreCallbackBus> &core, uint16_t address, uint8_t data)
+    {
+        if (core.m_IOWrite != nullptr)
+        {
+            core.m_IOWrite(address, data, core.m_Param);
+        }
+    }
+
+    // Memory is only reached through the callbacks so nothing can be decoded ahead of time
+    static const uint8_t *CodePointer(CZ80CoreT<CZ80CoreCallbackBus> &, uint16_t)
+    {
+        return nullptr;
+    }
+};
+
+typedef CZ80CoreT<CZ80CoreCallbackBus> CZ80Core;
+
 
 //-----------------------------------------------------------------------------------------
 
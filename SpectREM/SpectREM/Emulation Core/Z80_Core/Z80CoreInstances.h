@@ -0,0 +1,21 @@
+//
+// TZT ZX Spectrum Emulator
+//
+
+// The buses the Z80 core is built for. Every Z80 core source file includes this as its last line so that the
+// functions it defines are instantiated for each bus. It has no include guard as it must only be included once
+// per source file, at the end. Define Z80CORE_CALLBACK_BUS_ONLY to build just CZ80Core, for tools that use the core
+// without the ZX Spectrum machines.
+
+//-----------------------------------------------------------------------------------------
+
+#ifndef Z80CORE_CALLBACK_BUS_ONLY
+#include "../ZX_Spectrum_Core/ZXSpectrum.hpp"
+#endif
+
+//-----------------------------------------------------------------------------------------
+
+template class CZ80CoreT<CZ80CoreCallbackBus>;
+#ifndef Z80CORE_CALLBACK_BUS_ONLY
+template class CZ80CoreT<ZXSpectrumBus>;
+#endif
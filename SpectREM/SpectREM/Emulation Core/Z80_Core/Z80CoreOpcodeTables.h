@@ -1,527 +1,530 @@
 #include "Z80Core.h"
 
-CZ80Core::Z80OpcodeTable CZ80Core::FDCB_Opcodes = {
+template <class Bus>
+const typename CZ80CoreT<Bus>::Z80OpcodeTable CZ80CoreT<Bus>::FDCB_Opcodes = {
 {
-	{ &CZ80Core::LD_B_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   B, RLC (IY + %O)" },
-	{ &CZ80Core::LD_C_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   C, RLC (IY + %O)" },
-	{ &CZ80Core::LD_D_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   D, RLC (IY + %O)" },
-	{ &CZ80Core::LD_E_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   E, RLC (IY + %O)" },
-	{ &CZ80Core::LD_H_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   H, RLC (IY + %O)" },
-	{ &CZ80Core::LD_L_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   L, RLC (IY + %O)" },
-	{ &CZ80Core::RLC_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,	"RLC (IY + %O)"	  },
-	{ &CZ80Core::LD_A_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   A,RLC (IY + %O)" },
-	{ &CZ80Core::LD_B_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   B, RRC (IY + %O)" },
-	{ &CZ80Core::LD_C_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   C, RRC (IY + %O)" },
-	{ &CZ80Core::LD_D_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   D, RRC (IY + %O)" },
-	{ &CZ80Core::LD_E_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   E, RRC (IY + %O)" },
-	{ &CZ80Core::LD_H_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   H, RRC (IY + %O)" },
-	{ &CZ80Core::LD_L_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   L, RRC (IY + %O)" },
-	{ &CZ80Core::RRC_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,	"RRC  (IY + %O)"	  },
-	{ &CZ80Core::LD_A_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   A, RRC (IY + %O)" },
-	{ &CZ80Core::LD_B_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   B, RL (IY + %O)"  },
-	{ &CZ80Core::LD_C_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   C, RL (IY + %O)"  },
-	{ &CZ80Core::LD_D_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   D, RL (IY + %O)"  },
-	{ &CZ80Core::LD_E_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   E, RL (IY + %O)"  },
-	{ &CZ80Core::LD_H_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   H, RL (IY + %O)"  },
-	{ &CZ80Core::LD_L_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   L, RL (IY + %O)"  },
-	{ &CZ80Core::RL_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags,	"RL  (IY + %O)"       },
-	{ &CZ80Core::LD_A_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   A, RL (IY + %O)"  },
-	{ &CZ80Core::LD_B_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   B, RR (IY + %O)"  },
-	{ &CZ80Core::LD_C_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   C, RR (IY + %O)"  },
-	{ &CZ80Core::LD_D_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   D, RR (IY + %O)"  },
-	{ &CZ80Core::LD_E_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   E, RR (IY + %O)"  },
-	{ &CZ80Core::LD_H_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   H, RR (IY + %O)"  },
-	{ &CZ80Core::LD_L_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   L, RR (IY + %O)"  },
-	{ &CZ80Core::RR_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags,	"RR  (IY + %O)"       },
-	{ &CZ80Core::LD_A_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   A, RR (IY + %O)"  },
-	{ &CZ80Core::LD_B_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   B, SLA (IY + %O)" },
-	{ &CZ80Core::LD_C_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   C, SLA (IY + %O)" },
-	{ &CZ80Core::LD_D_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   D, SLA (IY + %O)" },
-	{ &CZ80Core::LD_E_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   E, SLA (IY + %O)" },
-	{ &CZ80Core::LD_H_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   H, SLA (IY + %O)" },
-	{ &CZ80Core::LD_L_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   L, SLA (IY + %O)" },
-	{ &CZ80Core::SLA_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,	"SLA  (IY + %O)"      },
-	{ &CZ80Core::LD_A_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   A, SLA (IY + %O)" },
-	{ &CZ80Core::LD_B_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   B, SRA (IY + %O)" },
-	{ &CZ80Core::LD_C_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   C, SRA (IY + %O)" },
-	{ &CZ80Core::LD_D_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   D, SRA (IY + %O)" },
-	{ &CZ80Core::LD_E_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   E, SRA (IY + %O)" },
-	{ &CZ80Core::LD_H_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   H, SRA (IY + %O)" },
-	{ &CZ80Core::LD_L_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   L, SRA (IY + %O)" },
-	{ &CZ80Core::SRA_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,	"SRA  (IY + %O)"      },
-	{ &CZ80Core::LD_A_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   A, SRA (IY + %O)" },
-	{ &CZ80Core::LD_B_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   B, SLL  (IY + %O)" },
-	{ &CZ80Core::LD_C_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   C, SLL  (IY + %O)" },
-	{ &CZ80Core::LD_D_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   D, SLL  (IY + %O)" },
-	{ &CZ80Core::LD_E_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   E, SLL  (IY + %O)" },
-	{ &CZ80Core::LD_H_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   H, SLL  (IY + %O)" },
-	{ &CZ80Core::LD_L_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   L, SLL  (IY + %O)" },
-	{ &CZ80Core::SLL_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,	"SLL  (IY + %O)"      },
-	{ &CZ80Core::LD_A_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   A, SLL  (IY + %O)" },
-	{ &CZ80Core::LD_B_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   B, SRL (IY + %O)" },
-	{ &CZ80Core::LD_C_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   C, SRL (IY + %O)" },
-	{ &CZ80Core::LD_D_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   D, SRL (IY + %O)" },
-	{ &CZ80Core::LD_E_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   E, SRL (IY + %O)" },
-	{ &CZ80Core::LD_H_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   H, SRL (IY + %O)" },
-	{ &CZ80Core::LD_L_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   L, SRL (IY + %O)" },
-	{ &CZ80Core::SRL_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,	"SRL  (IY + %O)"      },
-	{ &CZ80Core::LD_A_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,	"LD   A, SRL (IY + %O)" },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
-	{ &CZ80Core::LD_B_RES_0_off_IX_IY_d , 0,								"LD   B,RES  0, (IY + %O)" },
-	{ &CZ80Core::LD_C_RES_0_off_IX_IY_d , 0,								"LD   C,RES  0, (IY + %O)" },
-	{ &CZ80Core::LD_D_RES_0_off_IX_IY_d , 0,								"LD   D,RES  0, (IY + %O)" },
-	{ &CZ80Core::LD_E_RES_0_off_IX_IY_d , 0,								"LD   E,RES  0, (IY + %O)" },
-	{ &CZ80Core::LD_H_RES_0_off_IX_IY_d , 0,								"LD   H,RES  0, (IY + %O)" },
-	{ &CZ80Core::LD_L_RES_0_off_IX_IY_d , 0,								"LD   L,RES  0, (IY + %O)" },
-	{ &CZ80Core::RES_0_off_IX_IY_d      , 0,								"RES  0,(IY + %O)"		},
-	{ &CZ80Core::LD_A_RES_0_off_IX_IY_d , 0,								"LD   A,RES  0, (IY + %O)" },
-	{ &CZ80Core::LD_B_RES_1_off_IX_IY_d , 0,								"LD   B,RES  1, (IY + %O)" },
-	{ &CZ80Core::LD_C_RES_1_off_IX_IY_d , 0,								"LD   C,RES  1, (IY + %O)" },
-	{ &CZ80Core::LD_D_RES_1_off_IX_IY_d , 0,								"LD   D,RES  1, (IY + %O)" },
-	{ &CZ80Core::LD_E_RES_1_off_IX_IY_d , 0,								"LD   E,RES  1, (IY + %O)" },
-	{ &CZ80Core::LD_H_RES_1_off_IX_IY_d , 0,								"LD   H,RES  1, (IY + %O)" },
-	{ &CZ80Core::LD_L_RES_1_off_IX_IY_d , 0,								"LD   L,RES  1, (IY + %O)" },
-	{ &CZ80Core::RES_1_off_IX_IY_d      , 0,								"RES  1,(IY + %O)"		},
-	{ &CZ80Core::LD_A_RES_1_off_IX_IY_d , 0,								"LD   A,RES  1, (IY + %O)" },
-	{ &CZ80Core::LD_B_RES_2_off_IX_IY_d , 0,								"LD   B,RES  2, (IY + %O)" },
-	{ &CZ80Core::LD_C_RES_2_off_IX_IY_d , 0,								"LD   C,RES  2, (IY + %O)" },
-	{ &CZ80Core::LD_D_RES_2_off_IX_IY_d , 0,								"LD   D,RES  2, (IY + %O)" },
-	{ &CZ80Core::LD_E_RES_2_off_IX_IY_d , 0,								"LD   E,RES  2, (IY + %O)" },
-	{ &CZ80Core::LD_H_RES_2_off_IX_IY_d , 0,								"LD   H,RES  2, (IY + %O)" },
-	{ &CZ80Core::LD_L_RES_2_off_IX_IY_d , 0,								"LD   L,RES  2, (IY + %O)" },
-	{ &CZ80Core::RES_2_off_IX_IY_d      , 0,								"RES  2,(IY + %O)"		},
-	{ &CZ80Core::LD_A_RES_2_off_IX_IY_d , 0,								"LD   A,RES  2, (IY + %O)" },
-	{ &CZ80Core::LD_B_RES_3_off_IX_IY_d , 0,								"LD   B,RES  3, (IY + %O)" },
-	{ &CZ80Core::LD_C_RES_3_off_IX_IY_d , 0,								"LD   C,RES  3, (IY + %O)" },
-	{ &CZ80Core::LD_D_RES_3_off_IX_IY_d , 0,								"LD   D,RES  3, (IY + %O)" },
-	{ &CZ80Core::LD_E_RES_3_off_IX_IY_d , 0,								"LD   E,RES  3, (IY + %O)" },
-	{ &CZ80Core::LD_H_RES_3_off_IX_IY_d , 0,								"LD   H,RES  3, (IY + %O)" },
-	{ &CZ80Core::LD_L_RES_3_off_IX_IY_d , 0,								"LD   L,RES  3, (IY + %O)" },
-	{ &CZ80Core::RES_3_off_IX_IY_d      , 0,								"RES  3,(IY + %O)"		},
-	{ &CZ80Core::LD_A_RES_3_off_IX_IY_d , 0,								"LD   A,RES  3, (IY + %O)" },
-	{ &CZ80Core::LD_B_RES_4_off_IX_IY_d , 0,								"LD   B,RES  4, (IY + %O)" },
-	{ &CZ80Core::LD_C_RES_4_off_IX_IY_d , 0,								"LD   C,RES  4, (IY + %O)" },
-	{ &CZ80Core::LD_D_RES_4_off_IX_IY_d , 0,								"LD   D,RES  4, (IY + %O)" },
-	{ &CZ80Core::LD_E_RES_4_off_IX_IY_d , 0,								"LD   E,RES  4, (IY + %O)" },
-	{ &CZ80Core::LD_H_RES_4_off_IX_IY_d , 0,								"LD   H,RES  4, (IY + %O)" },
-	{ &CZ80Core::LD_L_RES_4_off_IX_IY_d , 0,								"LD   L,RES  4, (IY + %O)" },
-	{ &CZ80Core::RES_4_off_IX_IY_d      , 0,								"RES  4,(IY + %O)"		},
-	{ &CZ80Core::LD_A_RES_4_off_IX_IY_d , 0,								"LD   A,RES  4, (IY + %O)" },
-	{ &CZ80Core::LD_B_RES_5_off_IX_IY_d , 0,								"LD   B,RES 5, (IY + %O)" },
-	{ &CZ80Core::LD_C_RES_5_off_IX_IY_d , 0,								"LD   C,RES 5, (IY + %O)" },
-	{ &CZ80Core::LD_D_RES_5_off_IX_IY_d , 0,								"LD   D,RES 5, (IY + %O)" },
-	{ &CZ80Core::LD_E_RES_5_off_IX_IY_d , 0,								"LD   E,RES 5, (IY + %O)" },
-	{ &CZ80Core::LD_H_RES_5_off_IX_IY_d , 0,								"LD   H,RES 5, (IY + %O)" },
-	{ &CZ80Core::LD_L_RES_5_off_IX_IY_d , 0,								"LD   L,RES 5,( IY + %O)" },
-	{ &CZ80Core::RES_5_off_IX_IY_d      , 0,								"RES  5,(IY + %O)"		},
-	{ &CZ80Core::LD_A_RES_5_off_IX_IY_d , 0,								"LD   A,RES 5, (IY + %O)" },
-	{ &CZ80Core::LD_B_RES_6_off_IX_IY_d , 0,								"LD   B,RES 6, (IY + %O)" },
-	{ &CZ80Core::LD_C_RES_6_off_IX_IY_d , 0,								"LD   C,RES 6, (IY + %O)" },
-	{ &CZ80Core::LD_D_RES_6_off_IX_IY_d , 0,								"LD   D,RES 6, (IY + %O)" },
-	{ &CZ80Core::LD_E_RES_6_off_IX_IY_d , 0,								"LD   E,RES 6, (IY + %O)" },
-	{ &CZ80Core::LD_H_RES_6_off_IX_IY_d , 0,								"LD   H,RES 6, (IY + %O)" },
-	{ &CZ80Core::LD_L_RES_6_off_IX_IY_d , 0,								"LD   L,RES 6, (IY + %O)" },
-	{ &CZ80Core::RES_6_off_IX_IY_d      , 0,								"RES  6,(IY + %O)"		},
-	{ &CZ80Core::LD_A_RES_6_off_IX_IY_d , 0,								"LD   A,RES 6, (IY + %O)" },
-	{ &CZ80Core::LD_B_RES_7_off_IX_IY_d , 0,								"LD   B,RES 7, (IY + %O)" },
-	{ &CZ80Core::LD_C_RES_7_off_IX_IY_d , 0,								"LD   C,RES 7, (IY + %O)" },
-	{ &CZ80Core::LD_D_RES_7_off_IX_IY_d , 0,								"LD   D,RES 7, (IY + %O)" },
-	{ &CZ80Core::LD_E_RES_7_off_IX_IY_d , 0,								"LD   E,RES 7, (IY + %O)" },
-	{ &CZ80Core::LD_H_RES_7_off_IX_IY_d , 0,								"LD   H,RES 7, (IY + %O)" },
-	{ &CZ80Core::LD_L_RES_7_off_IX_IY_d , 0,								"LD   L,RES 7, (IY + %O)" },
-	{ &CZ80Core::RES_7_off_IX_IY_d      , 0,								"RES  7,(IY + %O)"		},
-	{ &CZ80Core::LD_A_RES_7_off_IX_IY_d , 0,								"LD   A,RES 7, (IY + %O)" },
-	{ &CZ80Core::LD_B_SET_0_off_IX_IY_d , 0,								"LD   B,SET 0, (IY + %O)" },
-	{ &CZ80Core::LD_C_SET_0_off_IX_IY_d , 0,								"LD   C,SET 0, (IY + %O)" },
-	{ &CZ80Core::LD_D_SET_0_off_IX_IY_d , 0,								"LD   D,SET 0, (IY + %O)" },
-	{ &CZ80Core::LD_E_SET_0_off_IX_IY_d , 0,								"LD   E,SET 0, (IY + %O)" },
-	{ &CZ80Core::LD_H_SET_0_off_IX_IY_d , 0,								"LD   H,SET 0, (IY + %O)" },
-	{ &CZ80Core::LD_L_SET_0_off_IX_IY_d , 0,								"LD   L,SET 0, (IY + %O)" },
-	{ &CZ80Core::SET_0_off_IX_IY_d      , 0,								"SET  0,(IY + %O)"		},
-	{ &CZ80Core::LD_A_SET_0_off_IX_IY_d , 0,								"LD   A,SET 0, (IY + %O)" },
-	{ &CZ80Core::LD_B_SET_1_off_IX_IY_d , 0,								"LD   B,SET 1, (IY + %O)" },
-	{ &CZ80Core::LD_C_SET_1_off_IX_IY_d , 0,								"LD   C,SET 1, (IY + %O)" },
-	{ &CZ80Core::LD_D_SET_1_off_IX_IY_d , 0,								"LD   D,SET 1, (IY + %O)" },
-	{ &CZ80Core::LD_E_SET_1_off_IX_IY_d , 0,								"LD   E,SET 1, (IY + %O)" },
-	{ &CZ80Core::LD_H_SET_1_off_IX_IY_d , 0,								"LD   H,SET 1, (IY + %O)" },
-	{ &CZ80Core::LD_L_SET_1_off_IX_IY_d , 0,								"LD   L,SET 1, (IY + %O)" },
-	{ &CZ80Core::SET_1_off_IX_IY_d      , 0,								"SET 1,(IY + %O)"		},
-	{ &CZ80Core::LD_A_SET_1_off_IX_IY_d , 0,								"LD   A,SET 1, (IY + %O)" },
-	{ &CZ80Core::LD_B_SET_2_off_IX_IY_d , 0,								"LD   B,SET 2, (IY + %O)" },
-	{ &CZ80Core::LD_C_SET_2_off_IX_IY_d , 0,								"LD   C,SET 2, (IY + %O)" },
-	{ &CZ80Core::LD_D_SET_2_off_IX_IY_d , 0,								"LD   D,SET 2, (IY + %O)" },
-	{ &CZ80Core::LD_E_SET_2_off_IX_IY_d , 0,								"LD   E,SET 2, (IY + %O)" },
-	{ &CZ80Core::LD_H_SET_2_off_IX_IY_d , 0,								"LD   H,SET 2, (IY + %O)" },
-	{ &CZ80Core::LD_L_SET_2_off_IX_IY_d , 0,								"LD   L,SET 2, (IY + %O)" },
-	{ &CZ80Core::SET_2_off_IX_IY_d      , 0,								"SET  2,(IY + %O)"		},
-	{ &CZ80Core::LD_A_SET_2_off_IX_IY_d , 0,								"LD   A,SET 2, (IY + %O)" },
-	{ &CZ80Core::LD_B_SET_3_off_IX_IY_d , 0,								"LD   B,SET 3, (IY + %O)" },
-	{ &CZ80Core::LD_C_SET_3_off_IX_IY_d , 0,								"LD   C,SET 3, (IY + %O)" },
-	{ &CZ80Core::LD_D_SET_3_off_IX_IY_d , 0,								"LD   D,SET 3, (IY + %O)" },
-	{ &CZ80Core::LD_E_SET_3_off_IX_IY_d , 0,								"LD   E,SET 3, (IY + %O)" },
-	{ &CZ80Core::LD_H_SET_3_off_IX_IY_d , 0,								"LD   H,SET 3, (IY + %O)" },
-	{ &CZ80Core::LD_L_SET_3_off_IX_IY_d , 0,								"LD   L,SET 3, (IY + %O)" },
-	{ &CZ80Core::SET_3_off_IX_IY_d      , 0,								"SET  3,(IY + %O)"		},
-	{ &CZ80Core::LD_A_SET_3_off_IX_IY_d , 0,								"LD   A,SET 3, (IY + %O)" },
-	{ &CZ80Core::LD_B_SET_4_off_IX_IY_d , 0,								"LD   B,SET 4, (IY + %O)" },
-	{ &CZ80Core::LD_C_SET_4_off_IX_IY_d , 0,								"LD   C,SET 4, (IY + %O)" },
-	{ &CZ80Core::LD_D_SET_4_off_IX_IY_d , 0,								"LD   D,SET 4, (IY + %O)" },
-	{ &CZ80Core::LD_E_SET_4_off_IX_IY_d , 0,								"LD   E,SET 4, (IY + %O)" },
-	{ &CZ80Core::LD_H_SET_4_off_IX_IY_d , 0,								"LD   H,SET 4, (IY + %O)" },
-	{ &CZ80Core::LD_L_SET_4_off_IX_IY_d , 0,								"LD   L,SET 4, (IY + %O)" },
-	{ &CZ80Core::SET_4_off_IX_IY_d      , 0,								"SET  4,(IY + %O)"		},
-	{ &CZ80Core::LD_A_SET_4_off_IX_IY_d , 0,								"LD   A,SET 4, (IY + %O)" },
-	{ &CZ80Core::LD_B_SET_5_off_IX_IY_d , 0,								"LD   B,SET 5, (IY + %O)" },
-	{ &CZ80Core::LD_C_SET_5_off_IX_IY_d , 0,								"LD   C,SET 5, (IY + %O)" },
-	{ &CZ80Core::LD_D_SET_5_off_IX_IY_d , 0,								"LD   D,SET 5, (IY + %O)" },
-	{ &CZ80Core::LD_E_SET_5_off_IX_IY_d , 0,								"LD   E,SET 5, (IY + %O)" },
-	{ &CZ80Core::LD_H_SET_5_off_IX_IY_d , 0,								"LD   H,SET 5, (IY + %O)" },
-	{ &CZ80Core::LD_L_SET_5_off_IX_IY_d , 0,								"LD   L,SET 5, (IY + %O)" },
-	{ &CZ80Core::SET_5_off_IX_IY_d      , 0,								"SET  5,(IY + %O)"		},
-	{ &CZ80Core::LD_A_SET_5_off_IX_IY_d , 0,								"LD   A,SET 5, (IY + %O)" },
-	{ &CZ80Core::LD_B_SET_6_off_IX_IY_d , 0,								"LD   B,SET 6, (IY + %O)" },
-	{ &CZ80Core::LD_C_SET_6_off_IX_IY_d , 0,								"LD   C,SET 6, (IY + %O)" },
-	{ &CZ80Core::LD_D_SET_6_off_IX_IY_d , 0,								"LD   D,SET 6, (IY + %O)" },
-	{ &CZ80Core::LD_E_SET_6_off_IX_IY_d , 0,								"LD   E,SET 6, (IY + %O)" },
-	{ &CZ80Core::LD_H_SET_6_off_IX_IY_d , 0,								"LD   H,SET 6, (IY + %O)" },
-	{ &CZ80Core::LD_L_SET_6_off_IX_IY_d , 0,								"LD   L,SET 6, (IY + %O)" },
-	{ &CZ80Core::SET_6_off_IX_IY_d      , 0,								"SET  6,(IY + %O)"		},
-	{ &CZ80Core::LD_A_SET_6_off_IX_IY_d , 0,								"LD   A,SET 6, (IY + %O)" },
-	{ &CZ80Core::LD_B_SET_7_off_IX_IY_d , 0,								"LD   B,SET 7, (IY + %O)" },
-	{ &CZ80Core::LD_C_SET_7_off_IX_IY_d , 0,								"LD   C,SET 7, (IY + %O)" },
-	{ &CZ80Core::LD_D_SET_7_off_IX_IY_d , 0,								"LD   D,SET 7, (IY + %O)" },
-	{ &CZ80Core::LD_E_SET_7_off_IX_IY_d , 0,								"LD   E,SET 7, (IY + %O)" },
-	{ &CZ80Core::LD_H_SET_7_off_IX_IY_d , 0,								"LD   H,SET 7, (IY + %O)" },
-	{ &CZ80Core::LD_L_SET_7_off_IX_IY_d , 0,								"LD   L,SET 7, (IY + %O)" },
-	{ &CZ80Core::SET_7_off_IX_IY_d      , 0,								"SET  7,(IY + %O)"		},
-	{ &CZ80Core::LD_A_SET_7_off_IX_IY_d , 0,								"LD   A,SET 7, (IY + %O)" }
+	{ &CZ80CoreT<Bus>::LD_B_RLC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   B, RLC (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_RLC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   C, RLC (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_RLC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   D, RLC (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_RLC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   E, RLC (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_RLC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   H, RLC (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_RLC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   L, RLC (IY + %O)" },
+	{ &CZ80CoreT<Bus>::RLC_off_IX_IY_d        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"RLC (IY + %O)"	  },
+	{ &CZ80CoreT<Bus>::LD_A_RLC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   A,RLC (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_RRC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   B, RRC (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_RRC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   C, RRC (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_RRC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   D, RRC (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_RRC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   E, RRC (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_RRC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   H, RRC (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_RRC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   L, RRC (IY + %O)" },
+	{ &CZ80CoreT<Bus>::RRC_off_IX_IY_d        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"RRC  (IY + %O)"	  },
+	{ &CZ80CoreT<Bus>::LD_A_RRC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   A, RRC (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_RL_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   B, RL (IY + %O)"  },
+	{ &CZ80CoreT<Bus>::LD_C_RL_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   C, RL (IY + %O)"  },
+	{ &CZ80CoreT<Bus>::LD_D_RL_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   D, RL (IY + %O)"  },
+	{ &CZ80CoreT<Bus>::LD_E_RL_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   E, RL (IY + %O)"  },
+	{ &CZ80CoreT<Bus>::LD_H_RL_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   H, RL (IY + %O)"  },
+	{ &CZ80CoreT<Bus>::LD_L_RL_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   L, RL (IY + %O)"  },
+	{ &CZ80CoreT<Bus>::RL_off_IX_IY_d         , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"RL  (IY + %O)"       },
+	{ &CZ80CoreT<Bus>::LD_A_RL_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   A, RL (IY + %O)"  },
+	{ &CZ80CoreT<Bus>::LD_B_RR_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   B, RR (IY + %O)"  },
+	{ &CZ80CoreT<Bus>::LD_C_RR_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   C, RR (IY + %O)"  },
+	{ &CZ80CoreT<Bus>::LD_D_RR_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   D, RR (IY + %O)"  },
+	{ &CZ80CoreT<Bus>::LD_E_RR_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   E, RR (IY + %O)"  },
+	{ &CZ80CoreT<Bus>::LD_H_RR_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   H, RR (IY + %O)"  },
+	{ &CZ80CoreT<Bus>::LD_L_RR_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   L, RR (IY + %O)"  },
+	{ &CZ80CoreT<Bus>::RR_off_IX_IY_d         , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"RR  (IY + %O)"       },
+	{ &CZ80CoreT<Bus>::LD_A_RR_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   A, RR (IY + %O)"  },
+	{ &CZ80CoreT<Bus>::LD_B_SLA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   B, SLA (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SLA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   C, SLA (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SLA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   D, SLA (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SLA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   E, SLA (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SLA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   H, SLA (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SLA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   L, SLA (IY + %O)" },
+	{ &CZ80CoreT<Bus>::SLA_off_IX_IY_d        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"SLA  (IY + %O)"      },
+	{ &CZ80CoreT<Bus>::LD_A_SLA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   A, SLA (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_SRA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   B, SRA (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SRA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   C, SRA (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SRA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   D, SRA (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SRA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   E, SRA (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SRA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   H, SRA (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SRA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   L, SRA (IY + %O)" },
+	{ &CZ80CoreT<Bus>::SRA_off_IX_IY_d        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"SRA  (IY + %O)"      },
+	{ &CZ80CoreT<Bus>::LD_A_SRA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   A, SRA (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_SLL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   B, SLL  (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SLL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   C, SLL  (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SLL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   D, SLL  (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SLL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   E, SLL  (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SLL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   H, SLL  (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SLL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   L, SLL  (IY + %O)" },
+	{ &CZ80CoreT<Bus>::SLL_off_IX_IY_d        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"SLL  (IY + %O)"      },
+	{ &CZ80CoreT<Bus>::LD_A_SLL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   A, SLL  (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_SRL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   B, SRL (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SRL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   C, SRL (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SRL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   D, SRL (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SRL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   E, SRL (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SRL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   H, SRL (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SRL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   L, SRL (IY + %O)" },
+	{ &CZ80CoreT<Bus>::SRL_off_IX_IY_d        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"SRL  (IY + %O)"      },
+	{ &CZ80CoreT<Bus>::LD_A_SRL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"LD   A, SRL (IY + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_0_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_0_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_0_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_0_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_0_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_0_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_0_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_0_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  0, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_1_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_1_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_1_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_1_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_1_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_1_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_1_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_1_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  1, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_2_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_2_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_2_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_2_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_2_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_2_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_2_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_2_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  2, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_3_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_3_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_3_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_3_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_3_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_3_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_3_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_3_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  3, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_4_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_4_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_4_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_4_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_4_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_4_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_4_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_4_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  4, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_5_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_5_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_5_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_5_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_5_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_5_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_5_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_5_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  5, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_6_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_6_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_6_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_6_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_6_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_6_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_6_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_6_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  6, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_7_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_7_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_7_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_7_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_7_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_7_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_7_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::BIT_7_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"BIT  7, (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::LD_B_RES_0_off_IX_IY_d , 0,								"LD   B,RES  0, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_RES_0_off_IX_IY_d , 0,								"LD   C,RES  0, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_RES_0_off_IX_IY_d , 0,								"LD   D,RES  0, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_RES_0_off_IX_IY_d , 0,								"LD   E,RES  0, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_RES_0_off_IX_IY_d , 0,								"LD   H,RES  0, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_RES_0_off_IX_IY_d , 0,								"LD   L,RES  0, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::RES_0_off_IX_IY_d      , 0,								"RES  0,(IY + %O)"		},
+	{ &CZ80CoreT<Bus>::LD_A_RES_0_off_IX_IY_d , 0,								"LD   A,RES  0, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_RES_1_off_IX_IY_d , 0,								"LD   B,RES  1, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_RES_1_off_IX_IY_d , 0,								"LD   C,RES  1, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_RES_1_off_IX_IY_d , 0,								"LD   D,RES  1, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_RES_1_off_IX_IY_d , 0,								"LD   E,RES  1, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_RES_1_off_IX_IY_d , 0,								"LD   H,RES  1, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_RES_1_off_IX_IY_d , 0,								"LD   L,RES  1, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::RES_1_off_IX_IY_d      , 0,								"RES  1,(IY + %O)"		},
+	{ &CZ80CoreT<Bus>::LD_A_RES_1_off_IX_IY_d , 0,								"LD   A,RES  1, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_RES_2_off_IX_IY_d , 0,								"LD   B,RES  2, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_RES_2_off_IX_IY_d , 0,								"LD   C,RES  2, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_RES_2_off_IX_IY_d , 0,								"LD   D,RES  2, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_RES_2_off_IX_IY_d , 0,								"LD   E,RES  2, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_RES_2_off_IX_IY_d , 0,								"LD   H,RES  2, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_RES_2_off_IX_IY_d , 0,								"LD   L,RES  2, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::RES_2_off_IX_IY_d      , 0,								"RES  2,(IY + %O)"		},
+	{ &CZ80CoreT<Bus>::LD_A_RES_2_off_IX_IY_d , 0,								"LD   A,RES  2, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_RES_3_off_IX_IY_d , 0,								"LD   B,RES  3, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_RES_3_off_IX_IY_d , 0,								"LD   C,RES  3, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_RES_3_off_IX_IY_d , 0,								"LD   D,RES  3, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_RES_3_off_IX_IY_d , 0,								"LD   E,RES  3, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_RES_3_off_IX_IY_d , 0,								"LD   H,RES  3, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_RES_3_off_IX_IY_d , 0,								"LD   L,RES  3, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::RES_3_off_IX_IY_d      , 0,								"RES  3,(IY + %O)"		},
+	{ &CZ80CoreT<Bus>::LD_A_RES_3_off_IX_IY_d , 0,								"LD   A,RES  3, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_RES_4_off_IX_IY_d , 0,								"LD   B,RES  4, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_RES_4_off_IX_IY_d , 0,								"LD   C,RES  4, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_RES_4_off_IX_IY_d , 0,								"LD   D,RES  4, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_RES_4_off_IX_IY_d , 0,								"LD   E,RES  4, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_RES_4_off_IX_IY_d , 0,								"LD   H,RES  4, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_RES_4_off_IX_IY_d , 0,								"LD   L,RES  4, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::RES_4_off_IX_IY_d      , 0,								"RES  4,(IY + %O)"		},
+	{ &CZ80CoreT<Bus>::LD_A_RES_4_off_IX_IY_d , 0,								"LD   A,RES  4, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_RES_5_off_IX_IY_d , 0,								"LD   B,RES 5, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_RES_5_off_IX_IY_d , 0,								"LD   C,RES 5, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_RES_5_off_IX_IY_d , 0,								"LD   D,RES 5, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_RES_5_off_IX_IY_d , 0,								"LD   E,RES 5, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_RES_5_off_IX_IY_d , 0,								"LD   H,RES 5, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_RES_5_off_IX_IY_d , 0,								"LD   L,RES 5,( IY + %O)" },
+	{ &CZ80CoreT<Bus>::RES_5_off_IX_IY_d      , 0,								"RES  5,(IY + %O)"		},
+	{ &CZ80CoreT<Bus>::LD_A_RES_5_off_IX_IY_d , 0,								"LD   A,RES 5, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_RES_6_off_IX_IY_d , 0,								"LD   B,RES 6, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_RES_6_off_IX_IY_d , 0,								"LD   C,RES 6, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_RES_6_off_IX_IY_d , 0,								"LD   D,RES 6, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_RES_6_off_IX_IY_d , 0,								"LD   E,RES 6, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_RES_6_off_IX_IY_d , 0,								"LD   H,RES 6, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_RES_6_off_IX_IY_d , 0,								"LD   L,RES 6, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::RES_6_off_IX_IY_d      , 0,								"RES  6,(IY + %O)"		},
+	{ &CZ80CoreT<Bus>::LD_A_RES_6_off_IX_IY_d , 0,								"LD   A,RES 6, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_RES_7_off_IX_IY_d , 0,								"LD   B,RES 7, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_RES_7_off_IX_IY_d , 0,								"LD   C,RES 7, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_RES_7_off_IX_IY_d , 0,								"LD   D,RES 7, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_RES_7_off_IX_IY_d , 0,								"LD   E,RES 7, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_RES_7_off_IX_IY_d , 0,								"LD   H,RES 7, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_RES_7_off_IX_IY_d , 0,								"LD   L,RES 7, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::RES_7_off_IX_IY_d      , 0,								"RES  7,(IY + %O)"		},
+	{ &CZ80CoreT<Bus>::LD_A_RES_7_off_IX_IY_d , 0,								"LD   A,RES 7, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_SET_0_off_IX_IY_d , 0,								"LD   B,SET 0, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SET_0_off_IX_IY_d , 0,								"LD   C,SET 0, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SET_0_off_IX_IY_d , 0,								"LD   D,SET 0, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SET_0_off_IX_IY_d , 0,								"LD   E,SET 0, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SET_0_off_IX_IY_d , 0,								"LD   H,SET 0, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SET_0_off_IX_IY_d , 0,								"LD   L,SET 0, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::SET_0_off_IX_IY_d      , 0,								"SET  0,(IY + %O)"		},
+	{ &CZ80CoreT<Bus>::LD_A_SET_0_off_IX_IY_d , 0,								"LD   A,SET 0, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_SET_1_off_IX_IY_d , 0,								"LD   B,SET 1, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SET_1_off_IX_IY_d , 0,								"LD   C,SET 1, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SET_1_off_IX_IY_d , 0,								"LD   D,SET 1, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SET_1_off_IX_IY_d , 0,								"LD   E,SET 1, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SET_1_off_IX_IY_d , 0,								"LD   H,SET 1, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SET_1_off_IX_IY_d , 0,								"LD   L,SET 1, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::SET_1_off_IX_IY_d      , 0,								"SET 1,(IY + %O)"		},
+	{ &CZ80CoreT<Bus>::LD_A_SET_1_off_IX_IY_d , 0,								"LD   A,SET 1, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_SET_2_off_IX_IY_d , 0,								"LD   B,SET 2, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SET_2_off_IX_IY_d , 0,								"LD   C,SET 2, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SET_2_off_IX_IY_d , 0,								"LD   D,SET 2, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SET_2_off_IX_IY_d , 0,								"LD   E,SET 2, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SET_2_off_IX_IY_d , 0,								"LD   H,SET 2, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SET_2_off_IX_IY_d , 0,								"LD   L,SET 2, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::SET_2_off_IX_IY_d      , 0,								"SET  2,(IY + %O)"		},
+	{ &CZ80CoreT<Bus>::LD_A_SET_2_off_IX_IY_d , 0,								"LD   A,SET 2, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_SET_3_off_IX_IY_d , 0,								"LD   B,SET 3, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SET_3_off_IX_IY_d , 0,								"LD   C,SET 3, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SET_3_off_IX_IY_d , 0,								"LD   D,SET 3, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SET_3_off_IX_IY_d , 0,								"LD   E,SET 3, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SET_3_off_IX_IY_d , 0,								"LD   H,SET 3, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SET_3_off_IX_IY_d , 0,								"LD   L,SET 3, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::SET_3_off_IX_IY_d      , 0,								"SET  3,(IY + %O)"		},
+	{ &CZ80CoreT<Bus>::LD_A_SET_3_off_IX_IY_d , 0,								"LD   A,SET 3, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_SET_4_off_IX_IY_d , 0,								"LD   B,SET 4, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SET_4_off_IX_IY_d , 0,								"LD   C,SET 4, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SET_4_off_IX_IY_d , 0,								"LD   D,SET 4, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SET_4_off_IX_IY_d , 0,								"LD   E,SET 4, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SET_4_off_IX_IY_d , 0,								"LD   H,SET 4, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SET_4_off_IX_IY_d , 0,								"LD   L,SET 4, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::SET_4_off_IX_IY_d      , 0,								"SET  4,(IY + %O)"		},
+	{ &CZ80CoreT<Bus>::LD_A_SET_4_off_IX_IY_d , 0,								"LD   A,SET 4, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_SET_5_off_IX_IY_d , 0,								"LD   B,SET 5, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SET_5_off_IX_IY_d , 0,								"LD   C,SET 5, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SET_5_off_IX_IY_d , 0,								"LD   D,SET 5, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SET_5_off_IX_IY_d , 0,								"LD   E,SET 5, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SET_5_off_IX_IY_d , 0,								"LD   H,SET 5, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SET_5_off_IX_IY_d , 0,								"LD   L,SET 5, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::SET_5_off_IX_IY_d      , 0,								"SET  5,(IY + %O)"		},
+	{ &CZ80CoreT<Bus>::LD_A_SET_5_off_IX_IY_d , 0,								"LD   A,SET 5, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_SET_6_off_IX_IY_d , 0,								"LD   B,SET 6, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SET_6_off_IX_IY_d , 0,								"LD   C,SET 6, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SET_6_off_IX_IY_d , 0,								"LD   D,SET 6, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SET_6_off_IX_IY_d , 0,								"LD   E,SET 6, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SET_6_off_IX_IY_d , 0,								"LD   H,SET 6, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SET_6_off_IX_IY_d , 0,								"LD   L,SET 6, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::SET_6_off_IX_IY_d      , 0,								"SET  6,(IY + %O)"		},
+	{ &CZ80CoreT<Bus>::LD_A_SET_6_off_IX_IY_d , 0,								"LD   A,SET 6, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_SET_7_off_IX_IY_d , 0,								"LD   B,SET 7, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SET_7_off_IX_IY_d , 0,								"LD   C,SET 7, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SET_7_off_IX_IY_d , 0,								"LD   D,SET 7, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SET_7_off_IX_IY_d , 0,								"LD   E,SET 7, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SET_7_off_IX_IY_d , 0,								"LD   H,SET 7, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SET_7_off_IX_IY_d , 0,								"LD   L,SET 7, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::SET_7_off_IX_IY_d      , 0,								"SET  7,(IY + %O)"		},
+	{ &CZ80CoreT<Bus>::LD_A_SET_7_off_IX_IY_d , 0,								"LD   A,SET 7, (IY + %O)" }
 } };
 
-CZ80Core::Z80OpcodeTable CZ80Core::CB_Opcodes = {
+template <class Bus>
+const typename CZ80CoreT<Bus>::Z80OpcodeTable CZ80CoreT<Bus>::CB_Opcodes = {
 {
-	{ &CZ80Core::RLC_B               , CZ80Core::OPCODEFLAG_AltersFlags,		"RLC  B"             },
-	{ &CZ80Core::RLC_C               , CZ80Core::OPCODEFLAG_AltersFlags,		"RLC  C"             },
-	{ &CZ80Core::RLC_D               , CZ80Core::OPCODEFLAG_AltersFlags,		"RLC  D"             },
-	{ &CZ80Core::RLC_E               , CZ80Core::OPCODEFLAG_AltersFlags,		"RLC  E"             },
-	{ &CZ80Core::RLC_H               , CZ80Core::OPCODEFLAG_AltersFlags,		"RLC  H"             },
-	{ &CZ80Core::RLC_L               , CZ80Core::OPCODEFLAG_AltersFlags,		"RLC  L"             },
-	{ &CZ80Core::RLC_off_HL          , CZ80Core::OPCODEFLAG_AltersFlags,		"RLC  (HL)"          },
-	{ &CZ80Core::RLC_A               , CZ80Core::OPCODEFLAG_AltersFlags,		"RLC  A"             },
-	{ &CZ80Core::RRC_B               , CZ80Core::OPCODEFLAG_AltersFlags,		"RRC  B"             },
-	{ &CZ80Core::RRC_C               , CZ80Core::OPCODEFLAG_AltersFlags,		"RRC  C"             },
-	{ &CZ80Core::RRC_D               , CZ80Core::OPCODEFLAG_AltersFlags,		"RRC  D"             },
-	{ &CZ80Core::RRC_E               , CZ80Core::OPCODEFLAG_AltersFlags,		"RRC  E"             },
-	{ &CZ80Core::RRC_H               , CZ80Core::OPCODEFLAG_AltersFlags,		"RRC  H"             },
-	{ &CZ80Core::RRC_L               , CZ80Core::OPCODEFLAG_AltersFlags,		"RRC  L"             },
-	{ &CZ80Core::RRC_off_HL          , CZ80Core::OPCODEFLAG_AltersFlags,		"RRC  (HL)"          },
-	{ &CZ80Core::RRC_A               , CZ80Core::OPCODEFLAG_AltersFlags,		"RRC  A"             },
-	{ &CZ80Core::RL_B                , CZ80Core::OPCODEFLAG_AltersFlags,		"RL   B"              },
-	{ &CZ80Core::RL_C                , CZ80Core::OPCODEFLAG_AltersFlags,		"RL   C"              },
-	{ &CZ80Core::RL_D                , CZ80Core::OPCODEFLAG_AltersFlags,		"RL   D"              },
-	{ &CZ80Core::RL_E                , CZ80Core::OPCODEFLAG_AltersFlags,		"RL   E"              },
-	{ &CZ80Core::RL_H                , CZ80Core::OPCODEFLAG_AltersFlags,		"RL   H"              },
-	{ &CZ80Core::RL_L                , CZ80Core::OPCODEFLAG_AltersFlags,		"RL   L"              },
-	{ &CZ80Core::RL_off_HL           , CZ80Core::OPCODEFLAG_AltersFlags,		"RL   (HL)"           },
-	{ &CZ80Core::RL_A                , CZ80Core::OPCODEFLAG_AltersFlags,		"RL   A"              },
-	{ &CZ80Core::RR_B                , CZ80Core::OPCODEFLAG_AltersFlags,		"RR   B"              },
-	{ &CZ80Core::RR_C                , CZ80Core::OPCODEFLAG_AltersFlags,		"RR   C"              },
-	{ &CZ80Core::RR_D                , CZ80Core::OPCODEFLAG_AltersFlags,		"RR   D"              },
-	{ &CZ80Core::RR_E                , CZ80Core::OPCODEFLAG_AltersFlags,		"RR   E"              },
-	{ &CZ80Core::RR_H                , CZ80Core::OPCODEFLAG_AltersFlags,		"RR   H"              },
-	{ &CZ80Core::RR_L                , CZ80Core::OPCODEFLAG_AltersFlags,		"RR   L"              },
-	{ &CZ80Core::RR_off_HL           , CZ80Core::OPCODEFLAG_AltersFlags,		"RR   (HL)"           },
-	{ &CZ80Core::RR_A                , CZ80Core::OPCODEFLAG_AltersFlags,		"RR   A"              },
-	{ &CZ80Core::SLA_B               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLA  B"             },
-	{ &CZ80Core::SLA_C               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLA  C"             },
-	{ &CZ80Core::SLA_D               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLA  D"             },
-	{ &CZ80Core::SLA_E               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLA  E"             },
-	{ &CZ80Core::SLA_H               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLA  H"             },
-	{ &CZ80Core::SLA_L               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLA  L"             },
-	{ &CZ80Core::SLA_off_HL          , CZ80Core::OPCODEFLAG_AltersFlags,		"SLA  (HL)"          },
-	{ &CZ80Core::SLA_A               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLA  A"             },
-	{ &CZ80Core::SRA_B               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRA  B"             },
-	{ &CZ80Core::SRA_C               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRA  C"             },
-	{ &CZ80Core::SRA_D               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRA  D"             },
-	{ &CZ80Core::SRA_E               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRA  E"             },
-	{ &CZ80Core::SRA_H               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRA  H"             },
-	{ &CZ80Core::SRA_L               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRA  L"             },
-	{ &CZ80Core::SRA_off_HL          , CZ80Core::OPCODEFLAG_AltersFlags,		"SRA  (HL)"          },
-	{ &CZ80Core::SRA_A               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRA  A"             },
-	{ &CZ80Core::SLL_B               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLL  B"             },
-	{ &CZ80Core::SLL_C               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLL  C"             },
-	{ &CZ80Core::SLL_D               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLL  D"             },
-	{ &CZ80Core::SLL_E               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLL  E"             },
-	{ &CZ80Core::SLL_H               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLL  H"             },
-	{ &CZ80Core::SLL_L               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLL  L"             },
-	{ &CZ80Core::SLL_off_HL          , CZ80Core::OPCODEFLAG_AltersFlags,		"SLL  (HL)"          },
-	{ &CZ80Core::SLL_A               , CZ80Core::OPCODEFLAG_AltersFlags,		"SLL  A"             },
-	{ &CZ80Core::SRL_B               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRL  B"             },
-	{ &CZ80Core::SRL_C               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRL  C"             },
-	{ &CZ80Core::SRL_D               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRL  D"             },
-	{ &CZ80Core::SRL_E               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRL  E"             },
-	{ &CZ80Core::SRL_H               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRL  H"             },
-	{ &CZ80Core::SRL_L               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRL  L"             },
-	{ &CZ80Core::SRL_off_HL          , CZ80Core::OPCODEFLAG_AltersFlags,		"SRL  (HL)"          },
-	{ &CZ80Core::SRL_A               , CZ80Core::OPCODEFLAG_AltersFlags,		"SRL  A"             },
-	{ &CZ80Core::BIT_0_B             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, B"           },
-	{ &CZ80Core::BIT_0_C             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, C"           },
-	{ &CZ80Core::BIT_0_D             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, D"           },
-	{ &CZ80Core::BIT_0_E             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, E"           },
-	{ &CZ80Core::BIT_0_H             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, H"           },
-	{ &CZ80Core::BIT_0_L             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, L"           },
-	{ &CZ80Core::BIT_0_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, (HL)"        },
-	{ &CZ80Core::BIT_0_A             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, A"           },
-	{ &CZ80Core::BIT_1_B             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, B"           },
-	{ &CZ80Core::BIT_1_C             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, C"           },
-	{ &CZ80Core::BIT_1_D             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, D"           },
-	{ &CZ80Core::BIT_1_E             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, E"           },
-	{ &CZ80Core::BIT_1_H             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, H"           },
-	{ &CZ80Core::BIT_1_L             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, L"           },
-	{ &CZ80Core::BIT_1_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, (HL)"        },
-	{ &CZ80Core::BIT_1_A             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, A"           },
-	{ &CZ80Core::BIT_2_B             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, B"           },
-	{ &CZ80Core::BIT_2_C             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, C"           },
-	{ &CZ80Core::BIT_2_D             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, D"           },
-	{ &CZ80Core::BIT_2_E             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, E"           },
-	{ &CZ80Core::BIT_2_H             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, H"           },
-	{ &CZ80Core::BIT_2_L             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, L"           },
-	{ &CZ80Core::BIT_2_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, (HL)"        },
-	{ &CZ80Core::BIT_2_A             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, A"           },
-	{ &CZ80Core::BIT_3_B             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, B"           },
-	{ &CZ80Core::BIT_3_C             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, C"           },
-	{ &CZ80Core::BIT_3_D             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, D"           },
-	{ &CZ80Core::BIT_3_E             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, E"           },
-	{ &CZ80Core::BIT_3_H             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, H"           },
-	{ &CZ80Core::BIT_3_L             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, L"           },
-	{ &CZ80Core::BIT_3_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, (HL)"        },
-	{ &CZ80Core::BIT_3_A             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, A"           },
-	{ &CZ80Core::BIT_4_B             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, B"           },
-	{ &CZ80Core::BIT_4_C             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, C"           },
-	{ &CZ80Core::BIT_4_D             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, D"           },
-	{ &CZ80Core::BIT_4_E             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, E"           },
-	{ &CZ80Core::BIT_4_H             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, H"           },
-	{ &CZ80Core::BIT_4_L             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, L"           },
-	{ &CZ80Core::BIT_4_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, (HL)"        },
-	{ &CZ80Core::BIT_4_A             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, A"           },
-	{ &CZ80Core::BIT_5_B             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, B"           },
-	{ &CZ80Core::BIT_5_C             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, C"           },
-	{ &CZ80Core::BIT_5_D             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, D"           },
-	{ &CZ80Core::BIT_5_E             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, E"           },
-	{ &CZ80Core::BIT_5_H             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, H"           },
-	{ &CZ80Core::BIT_5_L             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, L"           },
-	{ &CZ80Core::BIT_5_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, (HL)"        },
-	{ &CZ80Core::BIT_5_A             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, A"           },
-	{ &CZ80Core::BIT_6_B             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, B"           },
-	{ &CZ80Core::BIT_6_C             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, C"           },
-	{ &CZ80Core::BIT_6_D             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, D"           },
-	{ &CZ80Core::BIT_6_E             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, E"           },
-	{ &CZ80Core::BIT_6_H             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, H"           },
-	{ &CZ80Core::BIT_6_L             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, L"           },
-	{ &CZ80Core::BIT_6_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, (HL)"        },
-	{ &CZ80Core::BIT_6_A             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, A"           },
-	{ &CZ80Core::BIT_7_B             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, B"           },
-	{ &CZ80Core::BIT_7_C             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, C"           },
-	{ &CZ80Core::BIT_7_D             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, D"           },
-	{ &CZ80Core::BIT_7_E             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, E"           },
-	{ &CZ80Core::BIT_7_H             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, H"           },
-	{ &CZ80Core::BIT_7_L             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, L"           },
-	{ &CZ80Core::BIT_7_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, (HL)"        },
-	{ &CZ80Core::BIT_7_A             , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, A"           },
-	{ &CZ80Core::RES_0_B             , 0,										"RES  0, B"           },
-	{ &CZ80Core::RES_0_C             , 0,										"RES  0, C"           },
-	{ &CZ80Core::RES_0_D             , 0,										"RES  0, D"           },
-	{ &CZ80Core::RES_0_E             , 0,										"RES  0, E"           },
-	{ &CZ80Core::RES_0_H             , 0,										"RES  0, H"           },
-	{ &CZ80Core::RES_0_L             , 0,										"RES  0, L"           },
-	{ &CZ80Core::RES_0_off_HL        , 0,										"RES  0, (HL)"        },
-	{ &CZ80Core::RES_0_A             , 0,										"RES  0, A"           },
-	{ &CZ80Core::RES_1_B             , 0,										"RES  1, B"           },
-	{ &CZ80Core::RES_1_C             , 0,										"RES  1, C"           },
-	{ &CZ80Core::RES_1_D             , 0,										"RES  1, D"           },
-	{ &CZ80Core::RES_1_E             , 0,										"RES  1, E"           },
-	{ &CZ80Core::RES_1_H             , 0,										"RES  1, H"           },
-	{ &CZ80Core::RES_1_L             , 0,										"RES  1, L"           },
-	{ &CZ80Core::RES_1_off_HL        , 0,										"RES  1, (HL)"        },
-	{ &CZ80Core::RES_1_A             , 0,										"RES  1, A"           },
-	{ &CZ80Core::RES_2_B             , 0,										"RES  2, B"           },
-	{ &CZ80Core::RES_2_C             , 0,										"RES  2, C"           },
-	{ &CZ80Core::RES_2_D             , 0,										"RES  2, D"           },
-	{ &CZ80Core::RES_2_E             , 0,										"RES  2, E"           },
-	{ &CZ80Core::RES_2_H             , 0,										"RES  2, H"           },
-	{ &CZ80Core::RES_2_L             , 0,										"RES  2, L"           },
-	{ &CZ80Core::RES_2_off_HL        , 0,										"RES  2, (HL)"        },
-	{ &CZ80Core::RES_2_A             , 0,										"RES  2, A"           },
-	{ &CZ80Core::RES_3_B             , 0,										"RES  3, B"           },
-	{ &CZ80Core::RES_3_C             , 0,										"RES  3, C"           },
-	{ &CZ80Core::RES_3_D             , 0,										"RES  3, D"           },
-	{ &CZ80Core::RES_3_E             , 0,										"RES  3, E"           },
-	{ &CZ80Core::RES_3_H             , 0,										"RES  3, H"           },
-	{ &CZ80Core::RES_3_L             , 0,										"RES  3, L"           },
-	{ &CZ80Core::RES_3_off_HL        , 0,										"RES  3, (HL)"        },
-	{ &CZ80Core::RES_3_A             , 0,										"RES  3, A"           },
-	{ &CZ80Core::RES_4_B             , 0,										"RES  4, B"           },
-	{ &CZ80Core::RES_4_C             , 0,										"RES  4, C"           },
-	{ &CZ80Core::RES_4_D             , 0,										"RES  4, D"           },
-	{ &CZ80Core::RES_4_E             , 0,										"RES  4, E"           },
-	{ &CZ80Core::RES_4_H             , 0,										"RES  4, H"           },
-	{ &CZ80Core::RES_4_L             , 0,										"RES  4, L"           },
-	{ &CZ80Core::RES_4_off_HL        , 0,										"RES  4, (HL)"        },
-	{ &CZ80Core::RES_4_A             , 0,										"RES  4, A"           },
-	{ &CZ80Core::RES_5_B             , 0,										"RES  5, B"           },
-	{ &CZ80Core::RES_5_C             , 0,										"RES  5, C"           },
-	{ &CZ80Core::RES_5_D             , 0,										"RES  5, D"           },
-	{ &CZ80Core::RES_5_E             , 0,										"RES  5, E"           },
-	{ &CZ80Core::RES_5_H             , 0,										"RES  5, H"           },
-	{ &CZ80Core::RES_5_L             , 0,										"RES  5, L"           },
-	{ &CZ80Core::RES_5_off_HL        , 0,										"RES  5, (HL)"        },
-	{ &CZ80Core::RES_5_A             , 0,										"RES  5, A"           },
-	{ &CZ80Core::RES_6_B             , 0,										"RES  6, B"           },
-	{ &CZ80Core::RES_6_C             , 0,										"RES  6, C"           },
-	{ &CZ80Core::RES_6_D             , 0,										"RES  6, D"           },
-	{ &CZ80Core::RES_6_E             , 0,										"RES  6, E"           },
-	{ &CZ80Core::RES_6_H             , 0,										"RES  6, H"           },
-	{ &CZ80Core::RES_6_L             , 0,										"RES  6, L"           },
-	{ &CZ80Core::RES_6_off_HL        , 0,										"RES  6, (HL)"        },
-	{ &CZ80Core::RES_6_A             , 0,										"RES  6, A"           },
-	{ &CZ80Core::RES_7_B             , 0,										"RES  7, B"           },
-	{ &CZ80Core::RES_7_C             , 0,										"RES  7, C"           },
-	{ &CZ80Core::RES_7_D             , 0,										"RES  7, D"           },
-	{ &CZ80Core::RES_7_E             , 0,										"RES  7, E"           },
-	{ &CZ80Core::RES_7_H             , 0,										"RES  7, H"           },
-	{ &CZ80Core::RES_7_L             , 0,										"RES  7, L"           },
-	{ &CZ80Core::RES_7_off_HL        , 0,										"RES  7, (HL)"        },
-	{ &CZ80Core::RES_7_A             , 0,										"RES  7, A"           },
-	{ &CZ80Core::SET_0_B             , 0,										"SET  0, B"           },
-	{ &CZ80Core::SET_0_C             , 0,										"SET  0, C"           },
-	{ &CZ80Core::SET_0_D             , 0,										"SET  0, D"           },
-	{ &CZ80Core::SET_0_E             , 0,										"SET  0, E"           },
-	{ &CZ80Core::SET_0_H             , 0,										"SET  0, H"           },
-	{ &CZ80Core::SET_0_L             , 0,										"SET  0, L"           },
-	{ &CZ80Core::SET_0_off_HL        , 0,										"SET  0, (HL)"        },
-	{ &CZ80Core::SET_0_A             , 0,										"SET  0, A"           },
-	{ &CZ80Core::SET_1_B             , 0,										"SET  1, B"           },
-	{ &CZ80Core::SET_1_C             , 0,										"SET  1, C"           },
-	{ &CZ80Core::SET_1_D             , 0,										"SET  1, D"           },
-	{ &CZ80Core::SET_1_E             , 0,										"SET  1, E"           },
-	{ &CZ80Core::SET_1_H             , 0,										"SET  1, H"           },
-	{ &CZ80Core::SET_1_L             , 0,										"SET  1, L"           },
-	{ &CZ80Core::SET_1_off_HL        , 0,										"SET  1, (HL)"        },
-	{ &CZ80Core::SET_1_A             , 0,										"SET  1, A"           },
-	{ &CZ80Core::SET_2_B             , 0,										"SET  2, B"           },
-	{ &CZ80Core::SET_2_C             , 0,										"SET  2, C"           },
-	{ &CZ80Core::SET_2_D             , 0,										"SET  2, D"           },
-	{ &CZ80Core::SET_2_E             , 0,										"SET  2, E"           },
-	{ &CZ80Core::SET_2_H             , 0,										"SET  2, H"           },
-	{ &CZ80Core::SET_2_L             , 0,										"SET  2, L"           },
-	{ &CZ80Core::SET_2_off_HL        , 0,										"SET  2, (HL)"        },
-	{ &CZ80Core::SET_2_A             , 0,										"SET  2, A"           },
-	{ &CZ80Core::SET_3_B             , 0,										"SET  3, B"           },
-	{ &CZ80Core::SET_3_C             , 0,										"SET  3, C"           },
-	{ &CZ80Core::SET_3_D             , 0,										"SET  3, D"           },
-	{ &CZ80Core::SET_3_E             , 0,										"SET  3, E"           },
-	{ &CZ80Core::SET_3_H             , 0,										"SET  3, H"           },
-	{ &CZ80Core::SET_3_L             , 0,										"SET  3, L"           },
-	{ &CZ80Core::SET_3_off_HL        , 0,										"SET  3, (HL)"        },
-	{ &CZ80Core::SET_3_A             , 0,										"SET  3, A"           },
-	{ &CZ80Core::SET_4_B             , 0,										"SET  4, B"           },
-	{ &CZ80Core::SET_4_C             , 0,										"SET  4, C"           },
-	{ &CZ80Core::SET_4_D             , 0,										"SET  4, D"           },
-	{ &CZ80Core::SET_4_E             , 0,										"SET  4, E"           },
-	{ &CZ80Core::SET_4_H             , 0,										"SET  4, H"           },
-	{ &CZ80Core::SET_4_L             , 0,										"SET  4, L"           },
-	{ &CZ80Core::SET_4_off_HL        , 0,										"SET  4, (HL)"        },
-	{ &CZ80Core::SET_4_A             , 0,										"SET  4, A"           },
-	{ &CZ80Core::SET_5_B             , 0,										"SET  5, B"           },
-	{ &CZ80Core::SET_5_C             , 0,										"SET  5, C"           },
-	{ &CZ80Core::SET_5_D             , 0,										"SET  5, D"           },
-	{ &CZ80Core::SET_5_E             , 0,										"SET  5, E"           },
-	{ &CZ80Core::SET_5_H             , 0,										"SET  5, H"           },
-	{ &CZ80Core::SET_5_L             , 0,										"SET  5, L"           },
-	{ &CZ80Core::SET_5_off_HL        , 0,										"SET  5, (HL)"        },
-	{ &CZ80Core::SET_5_A             , 0,										"SET  5, A"           },
-	{ &CZ80Core::SET_6_B             , 0,										"SET  6, B"           },
-	{ &CZ80Core::SET_6_C             , 0,										"SET  6, C"           },
-	{ &CZ80Core::SET_6_D             , 0,										"SET  6, D"           },
-	{ &CZ80Core::SET_6_E             , 0,										"SET  6, E"           },
-	{ &CZ80Core::SET_6_H             , 0,										"SET  6, H"           },
-	{ &CZ80Core::SET_6_L             , 0,										"SET  6, L"           },
-	{ &CZ80Core::SET_6_off_HL        , 0,										"SET  6, (HL)"        },
-	{ &CZ80Core::SET_6_A             , 0,										"SET  6, A"           },
-	{ &CZ80Core::SET_7_B             , 0,										"SET  7, B"           },
-	{ &CZ80Core::SET_7_C             , 0,										"SET  7, C"           },
-	{ &CZ80Core::SET_7_D             , 0,										"SET  7, D"           },
-	{ &CZ80Core::SET_7_E             , 0,										"SET  7, E"           },
-	{ &CZ80Core::SET_7_H             , 0,										"SET  7, H"           },
-	{ &CZ80Core::SET_7_L             , 0,										"SET  7, L"           },
-	{ &CZ80Core::SET_7_off_HL        , 0,										"SET  7, (HL)"        },
-	{ &CZ80Core::SET_7_A             , 0,										"SET  7, A"           }
+	{ &CZ80CoreT<Bus>::RLC_B               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RLC  B"             },
+	{ &CZ80CoreT<Bus>::RLC_C               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RLC  C"             },
+	{ &CZ80CoreT<Bus>::RLC_D               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RLC  D"             },
+	{ &CZ80CoreT<Bus>::RLC_E               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RLC  E"             },
+	{ &CZ80CoreT<Bus>::RLC_H               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RLC  H"             },
+	{ &CZ80CoreT<Bus>::RLC_L               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RLC  L"             },
+	{ &CZ80CoreT<Bus>::RLC_off_HL          , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RLC  (HL)"          },
+	{ &CZ80CoreT<Bus>::RLC_A               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RLC  A"             },
+	{ &CZ80CoreT<Bus>::RRC_B               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RRC  B"             },
+	{ &CZ80CoreT<Bus>::RRC_C               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RRC  C"             },
+	{ &CZ80CoreT<Bus>::RRC_D               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RRC  D"             },
+	{ &CZ80CoreT<Bus>::RRC_E               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RRC  E"             },
+	{ &CZ80CoreT<Bus>::RRC_H               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RRC  H"             },
+	{ &CZ80CoreT<Bus>::RRC_L               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RRC  L"             },
+	{ &CZ80CoreT<Bus>::RRC_off_HL          , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RRC  (HL)"          },
+	{ &CZ80CoreT<Bus>::RRC_A               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RRC  A"             },
+	{ &CZ80CoreT<Bus>::RL_B                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RL   B"              },
+	{ &CZ80CoreT<Bus>::RL_C                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RL   C"              },
+	{ &CZ80CoreT<Bus>::RL_D                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RL   D"              },
+	{ &CZ80CoreT<Bus>::RL_E                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RL   E"              },
+	{ &CZ80CoreT<Bus>::RL_H                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RL   H"              },
+	{ &CZ80CoreT<Bus>::RL_L                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RL   L"              },
+	{ &CZ80CoreT<Bus>::RL_off_HL           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RL   (HL)"           },
+	{ &CZ80CoreT<Bus>::RL_A                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RL   A"              },
+	{ &CZ80CoreT<Bus>::RR_B                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RR   B"              },
+	{ &CZ80CoreT<Bus>::RR_C                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RR   C"              },
+	{ &CZ80CoreT<Bus>::RR_D                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RR   D"              },
+	{ &CZ80CoreT<Bus>::RR_E                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RR   E"              },
+	{ &CZ80CoreT<Bus>::RR_H                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RR   H"              },
+	{ &CZ80CoreT<Bus>::RR_L                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RR   L"              },
+	{ &CZ80CoreT<Bus>::RR_off_HL           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RR   (HL)"           },
+	{ &CZ80CoreT<Bus>::RR_A                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RR   A"              },
+	{ &CZ80CoreT<Bus>::SLA_B               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SLA  B"             },
+	{ &CZ80CoreT<Bus>::SLA_C               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SLA  C"             },
+	{ &CZ80CoreT<Bus>::SLA_D               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SLA  D"             },
+	{ &CZ80CoreT<Bus>::SLA_E               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SLA  E"             },
+	{ &CZ80CoreT<Bus>::SLA_H               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SLA  H"             },
+	{ &CZ80CoreT<Bus>::SLA_L               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SLA  L"             },
+	{ &CZ80CoreT<Bus>::SLA_off_HL          , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SLA  (HL)"          },
+	{ &CZ80CoreT<Bus>::SLA_A               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SLA  A"             },
+	{ &CZ80CoreT<Bus>::SRA_B               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SRA  B"             },
+	{ &CZ80CoreT<Bus>::SRA_C               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SRA  C"             },
+	{ &CZ80CoreT<Bus>::SRA_D               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SRA  D"             },
+	{ &CZ80CoreT<Bus>::SRA_E               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SRA  E"             },
+	{ &CZ80CoreT<Bus>::SRA_H               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SRA  H"             },
+	{ &CZ80CoreT<Bus>::SRA_L               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SRA  L"             },
+	{ &CZ80CoreT<Bus>::SRA_off_HL          , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SRA  (HL)"          },
+	{ &CZ80CoreT<Bus>::SRA_A               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SRA  A"             },
+	{ &CZ80CoreT<Bus>::SLL_B               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SLL  B"             },
+	{ &CZ80CoreT<Bus>::SLL_C               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SLL  C"             },
+	{ &CZ80CoreT<Bus>::SLL_D               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SLL  D"             },
+	{ &CZ80CoreT<Bus>::SLL_E               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SLL  E"             },
+	{ &CZ80CoreT<Bus>::SLL_H               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SLL  H"             },
+	{ &CZ80CoreT<Bus>::SLL_L               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SLL  L"             },
+	{ &CZ80CoreT<Bus>::SLL_off_HL          , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SLL  (HL)"          },
+	{ &CZ80CoreT<Bus>::SLL_A               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SLL  A"             },
+	{ &CZ80CoreT<Bus>::SRL_B               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SRL  B"             },
+	{ &CZ80CoreT<Bus>::SRL_C               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SRL  C"             },
+	{ &CZ80CoreT<Bus>::SRL_D               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SRL  D"             },
+	{ &CZ80CoreT<Bus>::SRL_E               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SRL  E"             },
+	{ &CZ80CoreT<Bus>::SRL_H               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SRL  H"             },
+	{ &CZ80CoreT<Bus>::SRL_L               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SRL  L"             },
+	{ &CZ80CoreT<Bus>::SRL_off_HL          , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SRL  (HL)"          },
+	{ &CZ80CoreT<Bus>::SRL_A               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SRL  A"             },
+	{ &CZ80CoreT<Bus>::BIT_0_B             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  0, B"           },
+	{ &CZ80CoreT<Bus>::BIT_0_C             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  0, C"           },
+	{ &CZ80CoreT<Bus>::BIT_0_D             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  0, D"           },
+	{ &CZ80CoreT<Bus>::BIT_0_E             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  0, E"           },
+	{ &CZ80CoreT<Bus>::BIT_0_H             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  0, H"           },
+	{ &CZ80CoreT<Bus>::BIT_0_L             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  0, L"           },
+	{ &CZ80CoreT<Bus>::BIT_0_off_HL        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  0, (HL)"        },
+	{ &CZ80CoreT<Bus>::BIT_0_A             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  0, A"           },
+	{ &CZ80CoreT<Bus>::BIT_1_B             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  1, B"           },
+	{ &CZ80CoreT<Bus>::BIT_1_C             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  1, C"           },
+	{ &CZ80CoreT<Bus>::BIT_1_D             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  1, D"           },
+	{ &CZ80CoreT<Bus>::BIT_1_E             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  1, E"           },
+	{ &CZ80CoreT<Bus>::BIT_1_H             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  1, H"           },
+	{ &CZ80CoreT<Bus>::BIT_1_L             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  1, L"           },
+	{ &CZ80CoreT<Bus>::BIT_1_off_HL        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  1, (HL)"        },
+	{ &CZ80CoreT<Bus>::BIT_1_A             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  1, A"           },
+	{ &CZ80CoreT<Bus>::BIT_2_B             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  2, B"           },
+	{ &CZ80CoreT<Bus>::BIT_2_C             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  2, C"           },
+	{ &CZ80CoreT<Bus>::BIT_2_D             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  2, D"           },
+	{ &CZ80CoreT<Bus>::BIT_2_E             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  2, E"           },
+	{ &CZ80CoreT<Bus>::BIT_2_H             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  2, H"           },
+	{ &CZ80CoreT<Bus>::BIT_2_L             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  2, L"           },
+	{ &CZ80CoreT<Bus>::BIT_2_off_HL        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  2, (HL)"        },
+	{ &CZ80CoreT<Bus>::BIT_2_A             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  2, A"           },
+	{ &CZ80CoreT<Bus>::BIT_3_B             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  3, B"           },
+	{ &CZ80CoreT<Bus>::BIT_3_C             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  3, C"           },
+	{ &CZ80CoreT<Bus>::BIT_3_D             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  3, D"           },
+	{ &CZ80CoreT<Bus>::BIT_3_E             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  3, E"           },
+	{ &CZ80CoreT<Bus>::BIT_3_H             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  3, H"           },
+	{ &CZ80CoreT<Bus>::BIT_3_L             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  3, L"           },
+	{ &CZ80CoreT<Bus>::BIT_3_off_HL        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  3, (HL)"        },
+	{ &CZ80CoreT<Bus>::BIT_3_A             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  3, A"           },
+	{ &CZ80CoreT<Bus>::BIT_4_B             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  4, B"           },
+	{ &CZ80CoreT<Bus>::BIT_4_C             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  4, C"           },
+	{ &CZ80CoreT<Bus>::BIT_4_D             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  4, D"           },
+	{ &CZ80CoreT<Bus>::BIT_4_E             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  4, E"           },
+	{ &CZ80CoreT<Bus>::BIT_4_H             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  4, H"           },
+	{ &CZ80CoreT<Bus>::BIT_4_L             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  4, L"           },
+	{ &CZ80CoreT<Bus>::BIT_4_off_HL        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  4, (HL)"        },
+	{ &CZ80CoreT<Bus>::BIT_4_A             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  4, A"           },
+	{ &CZ80CoreT<Bus>::BIT_5_B             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  5, B"           },
+	{ &CZ80CoreT<Bus>::BIT_5_C             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  5, C"           },
+	{ &CZ80CoreT<Bus>::BIT_5_D             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  5, D"           },
+	{ &CZ80CoreT<Bus>::BIT_5_E             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  5, E"           },
+	{ &CZ80CoreT<Bus>::BIT_5_H             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  5, H"           },
+	{ &CZ80CoreT<Bus>::BIT_5_L             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  5, L"           },
+	{ &CZ80CoreT<Bus>::BIT_5_off_HL        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  5, (HL)"        },
+	{ &CZ80CoreT<Bus>::BIT_5_A             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  5, A"           },
+	{ &CZ80CoreT<Bus>::BIT_6_B             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  6, B"           },
+	{ &CZ80CoreT<Bus>::BIT_6_C             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  6, C"           },
+	{ &CZ80CoreT<Bus>::BIT_6_D             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  6, D"           },
+	{ &CZ80CoreT<Bus>::BIT_6_E             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  6, E"           },
+	{ &CZ80CoreT<Bus>::BIT_6_H             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  6, H"           },
+	{ &CZ80CoreT<Bus>::BIT_6_L             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  6, L"           },
+	{ &CZ80CoreT<Bus>::BIT_6_off_HL        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  6, (HL)"        },
+	{ &CZ80CoreT<Bus>::BIT_6_A             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  6, A"           },
+	{ &CZ80CoreT<Bus>::BIT_7_B             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  7, B"           },
+	{ &CZ80CoreT<Bus>::BIT_7_C             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  7, C"           },
+	{ &CZ80CoreT<Bus>::BIT_7_D             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  7, D"           },
+	{ &CZ80CoreT<Bus>::BIT_7_E             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  7, E"           },
+	{ &CZ80CoreT<Bus>::BIT_7_H             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  7, H"           },
+	{ &CZ80CoreT<Bus>::BIT_7_L             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  7, L"           },
+	{ &CZ80CoreT<Bus>::BIT_7_off_HL        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  7, (HL)"        },
+	{ &CZ80CoreT<Bus>::BIT_7_A             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  7, A"           },
+	{ &CZ80CoreT<Bus>::RES_0_B             , 0,										"RES  0, B"           },
+	{ &CZ80CoreT<Bus>::RES_0_C             , 0,										"RES  0, C"           },
+	{ &CZ80CoreT<Bus>::RES_0_D             , 0,										"RES  0, D"           },
+	{ &CZ80CoreT<Bus>::RES_0_E             , 0,										"RES  0, E"           },
+	{ &CZ80CoreT<Bus>::RES_0_H             , 0,										"RES  0, H"           },
+	{ &CZ80CoreT<Bus>::RES_0_L             , 0,										"RES  0, L"           },
+	{ &CZ80CoreT<Bus>::RES_0_off_HL        , 0,										"RES  0, (HL)"        },
+	{ &CZ80CoreT<Bus>::RES_0_A             , 0,										"RES  0, A"           },
+	{ &CZ80CoreT<Bus>::RES_1_B             , 0,										"RES  1, B"           },
+	{ &CZ80CoreT<Bus>::RES_1_C             , 0,										"RES  1, C"           },
+	{ &CZ80CoreT<Bus>::RES_1_D             , 0,										"RES  1, D"           },
+	{ &CZ80CoreT<Bus>::RES_1_E             , 0,										"RES  1, E"           },
+	{ &CZ80CoreT<Bus>::RES_1_H             , 0,										"RES  1, H"           },
+	{ &CZ80CoreT<Bus>::RES_1_L             , 0,										"RES  1, L"           },
+	{ &CZ80CoreT<Bus>::RES_1_off_HL        , 0,										"RES  1, (HL)"        },
+	{ &CZ80CoreT<Bus>::RES_1_A             , 0,										"RES  1, A"           },
+	{ &CZ80CoreT<Bus>::RES_2_B             , 0,										"RES  2, B"           },
+	{ &CZ80CoreT<Bus>::RES_2_C             , 0,										"RES  2, C"           },
+	{ &CZ80CoreT<Bus>::RES_2_D             , 0,										"RES  2, D"           },
+	{ &CZ80CoreT<Bus>::RES_2_E             , 0,										"RES  2, E"           },
+	{ &CZ80CoreT<Bus>::RES_2_H             , 0,										"RES  2, H"           },
+	{ &CZ80CoreT<Bus>::RES_2_L             , 0,										"RES  2, L"           },
+	{ &CZ80CoreT<Bus>::RES_2_off_HL        , 0,										"RES  2, (HL)"        },
+	{ &CZ80CoreT<Bus>::RES_2_A             , 0,										"RES  2, A"           },
+	{ &CZ80CoreT<Bus>::RES_3_B             , 0,										"RES  3, B"           },
+	{ &CZ80CoreT<Bus>::RES_3_C             , 0,										"RES  3, C"           },
+	{ &CZ80CoreT<Bus>::RES_3_D             , 0,										"RES  3, D"           },
+	{ &CZ80CoreT<Bus>::RES_3_E             , 0,										"RES  3, E"           },
+	{ &CZ80CoreT<Bus>::RES_3_H             , 0,										"RES  3, H"           },
+	{ &CZ80CoreT<Bus>::RES_3_L             , 0,										"RES  3, L"           },
+	{ &CZ80CoreT<Bus>::RES_3_off_HL        , 0,										"RES  3, (HL)"        },
+	{ &CZ80CoreT<Bus>::RES_3_A             , 0,										"RES  3, A"           },
+	{ &CZ80CoreT<Bus>::RES_4_B             , 0,										"RES  4, B"           },
+	{ &CZ80CoreT<Bus>::RES_4_C             , 0,										"RES  4, C"           },
+	{ &CZ80CoreT<Bus>::RES_4_D             , 0,										"RES  4, D"           },
+	{ &CZ80CoreT<Bus>::RES_4_E             , 0,										"RES  4, E"           },
+	{ &CZ80CoreT<Bus>::RES_4_H             , 0,										"RES  4, H"           },
+	{ &CZ80CoreT<Bus>::RES_4_L             , 0,										"RES  4, L"           },
+	{ &CZ80CoreT<Bus>::RES_4_off_HL        , 0,										"RES  4, (HL)"        },
+	{ &CZ80CoreT<Bus>::RES_4_A             , 0,										"RES  4, A"           },
+	{ &CZ80CoreT<Bus>::RES_5_B             , 0,										"RES  5, B"           },
+	{ &CZ80CoreT<Bus>::RES_5_C             , 0,										"RES  5, C"           },
+	{ &CZ80CoreT<Bus>::RES_5_D             , 0,										"RES  5, D"           },
+	{ &CZ80CoreT<Bus>::RES_5_E             , 0,										"RES  5, E"           },
+	{ &CZ80CoreT<Bus>::RES_5_H             , 0,										"RES  5, H"           },
+	{ &CZ80CoreT<Bus>::RES_5_L             , 0,										"RES  5, L"           },
+	{ &CZ80CoreT<Bus>::RES_5_off_HL        , 0,										"RES  5, (HL)"        },
+	{ &CZ80CoreT<Bus>::RES_5_A             , 0,										"RES  5, A"           },
+	{ &CZ80CoreT<Bus>::RES_6_B             , 0,										"RES  6, B"           },
+	{ &CZ80CoreT<Bus>::RES_6_C             , 0,										"RES  6, C"           },
+	{ &CZ80CoreT<Bus>::RES_6_D             , 0,										"RES  6, D"           },
+	{ &CZ80CoreT<Bus>::RES_6_E             , 0,										"RES  6, E"           },
+	{ &CZ80CoreT<Bus>::RES_6_H             , 0,										"RES  6, H"           },
+	{ &CZ80CoreT<Bus>::RES_6_L             , 0,										"RES  6, L"           },
+	{ &CZ80CoreT<Bus>::RES_6_off_HL        , 0,										"RES  6, (HL)"        },
+	{ &CZ80CoreT<Bus>::RES_6_A             , 0,										"RES  6, A"           },
+	{ &CZ80CoreT<Bus>::RES_7_B             , 0,										"RES  7, B"           },
+	{ &CZ80CoreT<Bus>::RES_7_C             , 0,										"RES  7, C"           },
+	{ &CZ80CoreT<Bus>::RES_7_D             , 0,										"RES  7, D"           },
+	{ &CZ80CoreT<Bus>::RES_7_E             , 0,										"RES  7, E"           },
+	{ &CZ80CoreT<Bus>::RES_7_H             , 0,										"RES  7, H"           },
+	{ &CZ80CoreT<Bus>::RES_7_L             , 0,										"RES  7, L"           },
+	{ &CZ80CoreT<Bus>::RES_7_off_HL        , 0,										"RES  7, (HL)"        },
+	{ &CZ80CoreT<Bus>::RES_7_A             , 0,										"RES  7, A"           },
+	{ &CZ80CoreT<Bus>::SET_0_B             , 0,										"SET  0, B"           },
+	{ &CZ80CoreT<Bus>::SET_0_C             , 0,										"SET  0, C"           },
+	{ &CZ80CoreT<Bus>::SET_0_D             , 0,										"SET  0, D"           },
+	{ &CZ80CoreT<Bus>::SET_0_E             , 0,										"SET  0, E"           },
+	{ &CZ80CoreT<Bus>::SET_0_H             , 0,										"SET  0, H"           },
+	{ &CZ80CoreT<Bus>::SET_0_L             , 0,										"SET  0, L"           },
+	{ &CZ80CoreT<Bus>::SET_0_off_HL        , 0,										"SET  0, (HL)"        },
+	{ &CZ80CoreT<Bus>::SET_0_A             , 0,										"SET  0, A"           },
+	{ &CZ80CoreT<Bus>::SET_1_B             , 0,										"SET  1, B"           },
+	{ &CZ80CoreT<Bus>::SET_1_C             , 0,										"SET  1, C"           },
+	{ &CZ80CoreT<Bus>::SET_1_D             , 0,										"SET  1, D"           },
+	{ &CZ80CoreT<Bus>::SET_1_E             , 0,										"SET  1, E"           },
+	{ &CZ80CoreT<Bus>::SET_1_H             , 0,										"SET  1, H"           },
+	{ &CZ80CoreT<Bus>::SET_1_L             , 0,										"SET  1, L"           },
+	{ &CZ80CoreT<Bus>::SET_1_off_HL        , 0,										"SET  1, (HL)"        },
+	{ &CZ80CoreT<Bus>::SET_1_A             , 0,										"SET  1, A"           },
+	{ &CZ80CoreT<Bus>::SET_2_B             , 0,										"SET  2, B"           },
+	{ &CZ80CoreT<Bus>::SET_2_C             , 0,										"SET  2, C"           },
+	{ &CZ80CoreT<Bus>::SET_2_D             , 0,										"SET  2, D"           },
+	{ &CZ80CoreT<Bus>::SET_2_E             , 0,										"SET  2, E"           },
+	{ &CZ80CoreT<Bus>::SET_2_H             , 0,										"SET  2, H"           },
+	{ &CZ80CoreT<Bus>::SET_2_L             , 0,										"SET  2, L"           },
+	{ &CZ80CoreT<Bus>::SET_2_off_HL        , 0,										"SET  2, (HL)"        },
+	{ &CZ80CoreT<Bus>::SET_2_A             , 0,										"SET  2, A"           },
+	{ &CZ80CoreT<Bus>::SET_3_B             , 0,										"SET  3, B"           },
+	{ &CZ80CoreT<Bus>::SET_3_C             , 0,										"SET  3, C"           },
+	{ &CZ80CoreT<Bus>::SET_3_D             , 0,										"SET  3, D"           },
+	{ &CZ80CoreT<Bus>::SET_3_E             , 0,										"SET  3, E"           },
+	{ &CZ80CoreT<Bus>::SET_3_H             , 0,										"SET  3, H"           },
+	{ &CZ80CoreT<Bus>::SET_3_L             , 0,										"SET  3, L"           },
+	{ &CZ80CoreT<Bus>::SET_3_off_HL        , 0,										"SET  3, (HL)"        },
+	{ &CZ80CoreT<Bus>::SET_3_A             , 0,										"SET  3, A"           },
+	{ &CZ80CoreT<Bus>::SET_4_B             , 0,										"SET  4, B"           },
+	{ &CZ80CoreT<Bus>::SET_4_C             , 0,										"SET  4, C"           },
+	{ &CZ80CoreT<Bus>::SET_4_D             , 0,										"SET  4, D"           },
+	{ &CZ80CoreT<Bus>::SET_4_E             , 0,										"SET  4, E"           },
+	{ &CZ80CoreT<Bus>::SET_4_H             , 0,										"SET  4, H"           },
+	{ &CZ80CoreT<Bus>::SET_4_L             , 0,										"SET  4, L"           },
+	{ &CZ80CoreT<Bus>::SET_4_off_HL        , 0,										"SET  4, (HL)"        },
+	{ &CZ80CoreT<Bus>::SET_4_A             , 0,										"SET  4, A"           },
+	{ &CZ80CoreT<Bus>::SET_5_B             , 0,										"SET  5, B"           },
+	{ &CZ80CoreT<Bus>::SET_5_C             , 0,										"SET  5, C"           },
+	{ &CZ80CoreT<Bus>::SET_5_D             , 0,										"SET  5, D"           },
+	{ &CZ80CoreT<Bus>::SET_5_E             , 0,										"SET  5, E"           },
+	{ &CZ80CoreT<Bus>::SET_5_H             , 0,										"SET  5, H"           },
+	{ &CZ80CoreT<Bus>::SET_5_L             , 0,										"SET  5, L"           },
+	{ &CZ80CoreT<Bus>::SET_5_off_HL        , 0,										"SET  5, (HL)"        },
+	{ &CZ80CoreT<Bus>::SET_5_A             , 0,										"SET  5, A"           },
+	{ &CZ80CoreT<Bus>::SET_6_B             , 0,										"SET  6, B"           },
+	{ &CZ80CoreT<Bus>::SET_6_C             , 0,										"SET  6, C"           },
+	{ &CZ80CoreT<Bus>::SET_6_D             , 0,										"SET  6, D"           },
+	{ &CZ80CoreT<Bus>::SET_6_E             , 0,										"SET  6, E"           },
+	{ &CZ80CoreT<Bus>::SET_6_H             , 0,										"SET  6, H"           },
+	{ &CZ80CoreT<Bus>::SET_6_L             , 0,										"SET  6, L"           },
+	{ &CZ80CoreT<Bus>::SET_6_off_HL        , 0,										"SET  6, (HL)"        },
+	{ &CZ80CoreT<Bus>::SET_6_A             , 0,										"SET  6, A"           },
+	{ &CZ80CoreT<Bus>::SET_7_B             , 0,										"SET  7, B"           },
+	{ &CZ80CoreT<Bus>::SET_7_C             , 0,										"SET  7, C"           },
+	{ &CZ80CoreT<Bus>::SET_7_D             , 0,										"SET  7, D"           },
+	{ &CZ80CoreT<Bus>::SET_7_E             , 0,										"SET  7, E"           },
+	{ &CZ80CoreT<Bus>::SET_7_H             , 0,										"SET  7, H"           },
+	{ &CZ80CoreT<Bus>::SET_7_L             , 0,										"SET  7, L"           },
+	{ &CZ80CoreT<Bus>::SET_7_off_HL        , 0,										"SET  7, (HL)"        },
+	{ &CZ80CoreT<Bus>::SET_7_A             , 0,										"SET  7, A"           }
 } };
 
 
-CZ80Core::Z80OpcodeTable CZ80Core::DD_Opcodes = {
+template <class Bus>
+const typename CZ80CoreT<Bus>::Z80OpcodeTable CZ80CoreT<Bus>::DD_Opcodes = {
 {
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
@@ -532,7 +535,7 @@ CZ80Core::Z80OpcodeTable CZ80Core::DD_Opcodes = {
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::ADD_IX_BC           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD IX, BC"         },
+	{ &CZ80CoreT<Bus>::ADD_IX_BC           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADD IX, BC"         },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
@@ -548,7 +551,7 @@ CZ80Core::Z80OpcodeTable CZ80Core::DD_Opcodes = {
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::ADD_IX_DE           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD IX, DE"         },
+	{ &CZ80CoreT<Bus>::ADD_IX_DE           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADD IX, DE"         },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
@@ -556,31 +559,31 @@ CZ80Core::Z80OpcodeTable CZ80Core::DD_Opcodes = {
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_IX_nn            , 0,										"LD   IX, %W"      },
-	{ &CZ80Core::LD_off_nn_IX        , 0,										"LD   (%W), IX"    },
-	{ &CZ80Core::INC_IX              , 0,										"INC IX"            },
-	{ &CZ80Core::INC_IXh             , CZ80Core::OPCODEFLAG_AltersFlags,		"INC IXh"           },
-	{ &CZ80Core::DEC_IXh             , CZ80Core::OPCODEFLAG_AltersFlags,		"DEC IXh"           },
-	{ &CZ80Core::LD_IXh_n            , 0,										"LD   IXh, %B"     },
+	{ &CZ80CoreT<Bus>::LD_IX_nn            , 0,										"LD   IX, %W"      },
+	{ &CZ80CoreT<Bus>::LD_off_nn_IX        , 0,										"LD   (%W), IX"    },
+	{ &CZ80CoreT<Bus>::INC_IX              , 0,										"INC IX"            },
+	{ &CZ80CoreT<Bus>::INC_IXh             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"INC IXh"           },
+	{ &CZ80CoreT<Bus>::DEC_IXh             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"DEC IXh"           },
+	{ &CZ80CoreT<Bus>::LD_IXh_n            , 0,										"LD   IXh, %B"     },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::ADD_IX_IX           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD IX, IX"         },
-	{ &CZ80Core::LD_IX_off_nn        , 0,										"LD   IX, (%W)"    },
-	{ &CZ80Core::DEC_IX              , 0,										"DEC IX"            },
-	{ &CZ80Core::INC_IXl             , CZ80Core::OPCODEFLAG_AltersFlags,		"INC IXl"           },
-	{ &CZ80Core::DEC_IXl             , CZ80Core::OPCODEFLAG_AltersFlags,		"DEC IXl"           },
-	{ &CZ80Core::LD_IXl_n            , 0,										"LD   IXl, %B"     },
+	{ &CZ80CoreT<Bus>::ADD_IX_IX           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADD IX, IX"         },
+	{ &CZ80CoreT<Bus>::LD_IX_off_nn        , 0,										"LD   IX, (%W)"    },
+	{ &CZ80CoreT<Bus>::DEC_IX              , 0,										"DEC IX"            },
+	{ &CZ80CoreT<Bus>::INC_IXl             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"INC IXl"           },
+	{ &CZ80CoreT<Bus>::DEC_IXl             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"DEC IXl"           },
+	{ &CZ80CoreT<Bus>::LD_IXl_n            , 0,										"LD   IXl, %B"     },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::INC_off_IX_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"INC (IX + %O)"   },
-	{ &CZ80Core::DEC_off_IX_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"DEC (IX + %O)"   },
-	{ &CZ80Core::LD_off_IX_d_n       , 0,										"LD   (IX + %O), %B"},
+	{ &CZ80CoreT<Bus>::INC_off_IX_d        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"INC (IX + %O)"   },
+	{ &CZ80CoreT<Bus>::DEC_off_IX_d        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"DEC (IX + %O)"   },
+	{ &CZ80CoreT<Bus>::LD_off_IX_d_n       , 0,										"LD   (IX + %O), %B"},
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::ADD_IX_SP           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD IX, SP"         },
+	{ &CZ80CoreT<Bus>::ADD_IX_SP           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADD IX, SP"         },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
@@ -591,129 +594,129 @@ CZ80Core::Z80OpcodeTable CZ80Core::DD_Opcodes = {
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_B_IXh            , 0,										"LD   B, IXh"          },
-	{ &CZ80Core::LD_B_IXl            , 0,										"LD   B, IXl"          },
-	{ &CZ80Core::LD_B_off_IX_d       , 0,										"LD   B, (IX + %O)"  },
+	{ &CZ80CoreT<Bus>::LD_B_IXh            , 0,										"LD   B, IXh"          },
+	{ &CZ80CoreT<Bus>::LD_B_IXl            , 0,										"LD   B, IXl"          },
+	{ &CZ80CoreT<Bus>::LD_B_off_IX_d       , 0,										"LD   B, (IX + %O)"  },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_C_IXh            , 0,										"LD   C, IXh"          },
-	{ &CZ80Core::LD_C_IXl            , 0,										"LD   C, IXl"          },
-	{ &CZ80Core::LD_C_off_IX_d       , 0,										"LD   C, (IX + %O)"  },
+	{ &CZ80CoreT<Bus>::LD_C_IXh            , 0,										"LD   C, IXh"          },
+	{ &CZ80CoreT<Bus>::LD_C_IXl            , 0,										"LD   C, IXl"          },
+	{ &CZ80CoreT<Bus>::LD_C_off_IX_d       , 0,										"LD   C, (IX + %O)"  },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_D_IXh            , 0,										"LD   D, IXh"          },
-	{ &CZ80Core::LD_D_IXl            , 0,										"LD   D, IXl"          },
-	{ &CZ80Core::LD_D_off_IX_d       , 0,										"LD   D, (IX + %O)"  },
+	{ &CZ80CoreT<Bus>::LD_D_IXh            , 0,										"LD   D, IXh"          },
+	{ &CZ80CoreT<Bus>::LD_D_IXl            , 0,										"LD   D, IXl"          },
+	{ &CZ80CoreT<Bus>::LD_D_off_IX_d       , 0,										"LD   D, (IX + %O)"  },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_E_IXh            , 0,										"LD   E, IXh"          },
-	{ &CZ80Core::LD_E_IXl            , 0,										"LD   E, IXl"          },
-	{ &CZ80Core::LD_E_off_IX_d       , 0,										"LD   E, (IX + %O)"  },
+	{ &CZ80CoreT<Bus>::LD_E_IXh            , 0,										"LD   E, IXh"          },
+	{ &CZ80CoreT<Bus>::LD_E_IXl            , 0,										"LD   E, IXl"          },
+	{ &CZ80CoreT<Bus>::LD_E_off_IX_d       , 0,										"LD   E, (IX + %O)"  },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_IXh_B            , 0,										"LD   IXh, B"          },
-	{ &CZ80Core::LD_IXh_C            , 0,										"LD   IXh, C"          },
-	{ &CZ80Core::LD_IXh_D            , 0,										"LD   IXh, D"          },
-	{ &CZ80Core::LD_IXh_E            , 0,										"LD   IXh, E"          },
-	{ &CZ80Core::LD_IXh_IXh          , 0,										"LD   IXh, IXh"        },
-	{ &CZ80Core::LD_IXh_IXl          , 0,										"LD   IXh, IXl"        },
-	{ &CZ80Core::LD_H_off_IX_d       , 0,										"LD   H, (IX + %O)"  },
-	{ &CZ80Core::LD_IXh_A            , 0,										"LD   IXh, A"          },
-	{ &CZ80Core::LD_IXl_B            , 0,										"LD   IXl, B"          },
-	{ &CZ80Core::LD_IXl_C            , 0,										"LD   IXl, C"          },
-	{ &CZ80Core::LD_IXl_D            , 0,										"LD   IXl, D"          },
-	{ &CZ80Core::LD_IXl_E            , 0,										"LD   IXl, E"          },
-	{ &CZ80Core::LD_IXl_IXh          , 0,										"LD   IXl, IXh"        },
-	{ &CZ80Core::LD_IXl_IXl          , 0,										"LD   IXl, IXl"        },
-	{ &CZ80Core::LD_L_off_IX_d       , 0,										"LD   L, IX + %O)"  },
-	{ &CZ80Core::LD_IXl_A            , 0,										"LD   IXl, A"          },
-	{ &CZ80Core::LD_off_IX_d_B       , 0,										"LD   (IX + %O), B"  },
-	{ &CZ80Core::LD_off_IX_d_C       , 0,										"LD   (IX + %O), C"  },
-	{ &CZ80Core::LD_off_IX_d_D       , 0,										"LD   (IX + %O), D"  },
-	{ &CZ80Core::LD_off_IX_d_E       , 0,										"LD   (IX + %O), E"  },
-	{ &CZ80Core::LD_off_IX_d_H       , 0,										"LD   (IX + %O), H"  },
-	{ &CZ80Core::LD_off_IX_d_L       , 0,										"LD   (IX + %O), L"  },
+	{ &CZ80CoreT<Bus>::LD_IXh_B            , 0,										"LD   IXh, B"          },
+	{ &CZ80CoreT<Bus>::LD_IXh_C            , 0,										"LD   IXh, C"          },
+	{ &CZ80CoreT<Bus>::LD_IXh_D            , 0,										"LD   IXh, D"          },
+	{ &CZ80CoreT<Bus>::LD_IXh_E            , 0,										"LD   IXh, E"          },
+	{ &CZ80CoreT<Bus>::LD_IXh_IXh          , 0,										"LD   IXh, IXh"        },
+	{ &CZ80CoreT<Bus>::LD_IXh_IXl          , 0,										"LD   IXh, IXl"        },
+	{ &CZ80CoreT<Bus>::LD_H_off_IX_d       , 0,										"LD   H, (IX + %O)"  },
+	{ &CZ80CoreT<Bus>::LD_IXh_A            , 0,										"LD   IXh, A"          },
+	{ &CZ80CoreT<Bus>::LD_IXl_B            , 0,										"LD   IXl, B"          },
+	{ &CZ80CoreT<Bus>::LD_IXl_C            , 0,										"LD   IXl, C"          },
+	{ &CZ80CoreT<Bus>::LD_IXl_D            , 0,										"LD   IXl, D"          },
+	{ &CZ80CoreT<Bus>::LD_IXl_E            , 0,										"LD   IXl, E"          },
+	{ &CZ80CoreT<Bus>::LD_IXl_IXh          , 0,										"LD   IXl, IXh"        },
+	{ &CZ80CoreT<Bus>::LD_IXl_IXl          , 0,										"LD   IXl, IXl"        },
+	{ &CZ80CoreT<Bus>::LD_L_off_IX_d       , 0,										"LD   L, IX + %O)"  },
+	{ &CZ80CoreT<Bus>::LD_IXl_A            , 0,										"LD   IXl, A"          },
+	{ &CZ80CoreT<Bus>::LD_off_IX_d_B       , 0,										"LD   (IX + %O), B"  },
+	{ &CZ80CoreT<Bus>::LD_off_IX_d_C       , 0,										"LD   (IX + %O), C"  },
+	{ &CZ80CoreT<Bus>::LD_off_IX_d_D       , 0,										"LD   (IX + %O), D"  },
+	{ &CZ80CoreT<Bus>::LD_off_IX_d_E       , 0,										"LD   (IX + %O), E"  },
+	{ &CZ80CoreT<Bus>::LD_off_IX_d_H       , 0,										"LD   (IX + %O), H"  },
+	{ &CZ80CoreT<Bus>::LD_off_IX_d_L       , 0,										"LD   (IX + %O), L"  },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_off_IX_d_A       , 0,										"LD   (IX + %O), A"  },
+	{ &CZ80CoreT<Bus>::LD_off_IX_d_A       , 0,										"LD   (IX + %O), A"  },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_A_IXh            , 0,										"LD   A, IXh"          },
-	{ &CZ80Core::LD_A_IXl            , 0,										"LD   A, IXl"          },
-	{ &CZ80Core::LD_A_off_IX_d       , 0,										"LD   A, (IX + %O)"  },
+	{ &CZ80CoreT<Bus>::LD_A_IXh            , 0,										"LD   A, IXh"          },
+	{ &CZ80CoreT<Bus>::LD_A_IXl            , 0,										"LD   A, IXl"          },
+	{ &CZ80CoreT<Bus>::LD_A_off_IX_d       , 0,										"LD   A, (IX + %O)"  },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::ADD_A_IXh           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD A, IXh"         },
-	{ &CZ80Core::ADD_A_IXl           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD A, IXl"         },
-	{ &CZ80Core::ADD_A_off_IX_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD A, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::ADD_A_IXh           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADD A, IXh"         },
+	{ &CZ80CoreT<Bus>::ADD_A_IXl           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADD A, IXl"         },
+	{ &CZ80CoreT<Bus>::ADD_A_off_IX_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADD A, (IX + %O)" },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::ADC_A_IXh           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADC A, IXh"         },
-	{ &CZ80Core::ADC_A_IXl           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADC A, IXl"         },
-	{ &CZ80Core::ADC_A_off_IX_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"ADC A, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::ADC_A_IXh           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADC A, IXh"         },
+	{ &CZ80CoreT<Bus>::ADC_A_IXl           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADC A, IXl"         },
+	{ &CZ80CoreT<Bus>::ADC_A_off_IX_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADC A, (IX + %O)" },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::SUB_A_IXh           , CZ80Core::OPCODEFLAG_AltersFlags,		"SUB A, IXh"         },
-	{ &CZ80Core::SUB_A_IXl           , CZ80Core::OPCODEFLAG_AltersFlags,		"SUB A, IXl"         },
-	{ &CZ80Core::SUB_A_off_IX_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"SUB A, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::SUB_A_IXh           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SUB A, IXh"         },
+	{ &CZ80CoreT<Bus>::SUB_A_IXl           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SUB A, IXl"         },
+	{ &CZ80CoreT<Bus>::SUB_A_off_IX_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SUB A, (IX + %O)" },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::SBC_A_IXh           , CZ80Core::OPCODEFLAG_AltersFlags,		"SBC A, IXh"         },
-	{ &CZ80Core::SBC_A_IXl           , CZ80Core::OPCODEFLAG_AltersFlags,		"SBC A, IXl"         },
-	{ &CZ80Core::SBC_A_off_IX_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"SBC A, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::SBC_A_IXh           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SBC A, IXh"         },
+	{ &CZ80CoreT<Bus>::SBC_A_IXl           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SBC A, IXl"         },
+	{ &CZ80CoreT<Bus>::SBC_A_off_IX_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SBC A, (IX + %O)" },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::AND_IXh             , CZ80Core::OPCODEFLAG_AltersFlags,		"AND IXh"           },
-	{ &CZ80Core::AND_IXl             , CZ80Core::OPCODEFLAG_AltersFlags,		"AND IXl"           },
-	{ &CZ80Core::AND_off_IX_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"AND (IX + %O)"   },
+	{ &CZ80CoreT<Bus>::AND_IXh             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"AND IXh"           },
+	{ &CZ80CoreT<Bus>::AND_IXl             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"AND IXl"           },
+	{ &CZ80CoreT<Bus>::AND_off_IX_d        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"AND (IX + %O)"   },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::XOR_IXh             , CZ80Core::OPCODEFLAG_AltersFlags,		"XOR IXh"           },
-	{ &CZ80Core::XOR_IXl             , CZ80Core::OPCODEFLAG_AltersFlags,		"XOR IXl"           },
-	{ &CZ80Core::XOR_off_IX_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"XOR (IX + %O)"   },
+	{ &CZ80CoreT<Bus>::XOR_IXh             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"XOR IXh"           },
+	{ &CZ80CoreT<Bus>::XOR_IXl             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"XOR IXl"           },
+	{ &CZ80CoreT<Bus>::XOR_off_IX_d        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"XOR (IX + %O)"   },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::OR_IXh              , CZ80Core::OPCODEFLAG_AltersFlags,		"OR  IXh"            },
-	{ &CZ80Core::OR_IXl              , CZ80Core::OPCODEFLAG_AltersFlags,		"OR  IXl"            },
-	{ &CZ80Core::OR_off_IX_d         , CZ80Core::OPCODEFLAG_AltersFlags,		"OR  (IX + %O)"    },
+	{ &CZ80CoreT<Bus>::OR_IXh              , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"OR  IXh"            },
+	{ &CZ80CoreT<Bus>::OR_IXl              , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"OR  IXl"            },
+	{ &CZ80CoreT<Bus>::OR_off_IX_d         , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"OR  (IX + %O)"    },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::CP_IXh              , CZ80Core::OPCODEFLAG_AltersFlags,		"CP  IXh"            },
-	{ &CZ80Core::CP_IXl              , CZ80Core::OPCODEFLAG_AltersFlags,		"CP  IXl"            },
-	{ &CZ80Core::CP_off_IX_d         , CZ80Core::OPCODEFLAG_AltersFlags,		"CP  (IX + %O)"    },
+	{ &CZ80CoreT<Bus>::CP_IXh              , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"CP  IXh"            },
+	{ &CZ80CoreT<Bus>::CP_IXl              , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"CP  IXl"            },
+	{ &CZ80CoreT<Bus>::CP_off_IX_d         , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"CP  (IX + %O)"    },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
@@ -748,15 +751,15 @@ CZ80Core::Z80OpcodeTable CZ80Core::DD_Opcodes = {
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::POP_IX              , 0,										"POP  IX" },
+	{ &CZ80CoreT<Bus>::POP_IX              , 0,										"POP  IX" },
     { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::EX_off_SP_IX        , 0,										"EX   (SP), IX" },
+	{ &CZ80CoreT<Bus>::EX_off_SP_IX        , 0,										"EX   (SP), IX" },
     { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::PUSH_IX             , 0,										"PUSH  IX" },
+	{ &CZ80CoreT<Bus>::PUSH_IX             , 0,										"PUSH  IX" },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::JP_off_IX           , 0,										"JP   (IX)" },
+	{ &CZ80CoreT<Bus>::JP_off_IX           , 0,										"JP   (IX)" },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
@@ -772,7 +775,7 @@ CZ80Core::Z80OpcodeTable CZ80Core::DD_Opcodes = {
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::LD_SP_IX            , 0,										"LD   SP, IX" },
+	{ &CZ80CoreT<Bus>::LD_SP_IX            , 0,										"LD   SP, IX" },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
@@ -782,7 +785,8 @@ CZ80Core::Z80OpcodeTable CZ80Core::DD_Opcodes = {
 } };
 
 
-CZ80Core::Z80OpcodeTable CZ80Core::ED_Opcodes = {
+template <class Bus>
+const typename CZ80CoreT<Bus>::Z80OpcodeTable CZ80CoreT<Bus>::ED_Opcodes = {
 {
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
@@ -848,69 +852,69 @@ CZ80Core::Z80OpcodeTable CZ80Core::ED_Opcodes = {
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::IN_B_off_C          , CZ80Core::OPCODEFLAG_AltersFlags,		"IN   B, (C)"          },
-	{ &CZ80Core::OUT_off_C_B         , 0,										"OUT  (C), B"         },
-	{ &CZ80Core::SBC_HL_BC           , CZ80Core::OPCODEFLAG_AltersFlags,		"SBC  HL, BC"         },
-	{ &CZ80Core::LD_off_nn_BC        , 0,										"LD   (%W), BC"    },
-	{ &CZ80Core::NEG                 , CZ80Core::OPCODEFLAG_AltersFlags,		"NEG"               },
-	{ &CZ80Core::RETN                , 0,										"RETN"              },
-	{ &CZ80Core::IM_0                , 0,										"IM   0"              },
-	{ &CZ80Core::LD_I_A              , 0,										"LD   I, A"            },
-	{ &CZ80Core::IN_C_off_C          , CZ80Core::OPCODEFLAG_AltersFlags,		"IN   C, (C)"          },
-	{ &CZ80Core::OUT_off_C_C         , 0,										"OUT  (C), C"         },
-	{ &CZ80Core::ADC_HL_BC           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADC  HL, BC"         },
-	{ &CZ80Core::LD_BC_off_nn        , 0,										"LD   BC, (%W)"    },
-	{ &CZ80Core::NEG                 , CZ80Core::OPCODEFLAG_AltersFlags,		"NEG"               },
-	{ &CZ80Core::RETI                , 0,										"RETI"              },
-	{ &CZ80Core::IM_0                , 0,										"IM   0"              },
-	{ &CZ80Core::LD_R_A              , 0,										"LD   R, A"            },
-	{ &CZ80Core::IN_D_off_C          , CZ80Core::OPCODEFLAG_AltersFlags,		"IN   D, (C)"          },
-	{ &CZ80Core::OUT_off_C_D         , 0,										"OUT  (C), D"         },
-	{ &CZ80Core::SBC_HL_DE           , CZ80Core::OPCODEFLAG_AltersFlags,		"SBC  HL, DE"         },
-	{ &CZ80Core::LD_off_nn_DE        , 0,										"LD   (%W), DE"    },
-	{ &CZ80Core::NEG                 , CZ80Core::OPCODEFLAG_AltersFlags,		"NEG"               },
-	{ &CZ80Core::RETN                , 0,										"RETN"              },
-	{ &CZ80Core::IM_1                , 0,										"IM   1"              },
-	{ &CZ80Core::LD_A_I              , 0,										"LD   A, I"            },
-	{ &CZ80Core::IN_E_off_C          , CZ80Core::OPCODEFLAG_AltersFlags,		"IN   E, (C)"          },
-	{ &CZ80Core::OUT_off_C_E         , 0,										"OUT  (C), E"         },
-	{ &CZ80Core::ADC_HL_DE           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADC  HL, DE"         },
-	{ &CZ80Core::LD_DE_off_nn        , 0,										"LD   DE, (%W)"    },
-	{ &CZ80Core::NEG                 , CZ80Core::OPCODEFLAG_AltersFlags,		"NEG"               },
-	{ &CZ80Core::RETN                , 0,										"RETN"              },
-	{ &CZ80Core::IM_2                , 0,										"IM   2"              },
-	{ &CZ80Core::LD_A_R              , 0,										"LD   A, R"            },
-	{ &CZ80Core::IN_H_off_C          , CZ80Core::OPCODEFLAG_AltersFlags,		"IN   H, (C)"          },
-	{ &CZ80Core::OUT_off_C_H         , 0,										"OUT  (C), H"         },
-	{ &CZ80Core::SBC_HL_HL           , CZ80Core::OPCODEFLAG_AltersFlags,		"SBC  HL, HL"         },
-	{ &CZ80Core::LD_off_nn_HL        , 0,										"LD   (%W), HL"    },
-	{ &CZ80Core::NEG                 , CZ80Core::OPCODEFLAG_AltersFlags,		"NEG"               },
-	{ &CZ80Core::RETN                , 0,										"RETN"              },
-	{ &CZ80Core::IM_0                , 0,										"IM   0"              },
-	{ &CZ80Core::RRD                 , CZ80Core::OPCODEFLAG_AltersFlags,		"RRD"               },
-	{ &CZ80Core::IN_L_off_C          , CZ80Core::OPCODEFLAG_AltersFlags,		"IN   L, (C)"          },
-	{ &CZ80Core::OUT_off_C_L         , 0,										"OUT  (C), L"         },
-	{ &CZ80Core::ADC_HL_HL           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADC  HL, HL"         },
-	{ &CZ80Core::LD_HL_off_nn        , 0,										"LD   HL, (%W)"    },
-	{ &CZ80Core::NEG                 , CZ80Core::OPCODEFLAG_AltersFlags,		"NEG"               },
-	{ &CZ80Core::RETN                , 0,										"RETN"              },
-	{ &CZ80Core::IM_0                , 0,										"IM   0"              },
-	{ &CZ80Core::RLD                  , CZ80Core::OPCODEFLAG_AltersFlags,		"RLD"               },
-	{ &CZ80Core::IN_F_off_C          , CZ80Core::OPCODEFLAG_AltersFlags,		"IN   F, (C)"          },
-	{ &CZ80Core::OUT_off_C_0         , 0,										"OUT  (C), 0"         },
-	{ &CZ80Core::SBC_HL_SP           , CZ80Core::OPCODEFLAG_AltersFlags,		"SBC  HL, SP"         },
-	{ &CZ80Core::LD_off_nn_SP        , 0,										"LD   (%W), SP"    },
-	{ &CZ80Core::NEG                 , CZ80Core::OPCODEFLAG_AltersFlags,		"NEG"               },
-	{ &CZ80Core::RETN                , 0,										"RETN"              },
-	{ &CZ80Core::IM_1                , 0,										"IM   1" },
+	{ &CZ80CoreT<Bus>::IN_B_off_C          , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"IN   B, (C)"          },
+	{ &CZ80CoreT<Bus>::OUT_off_C_B         , 0,										"OUT  (C), B"         },
+	{ &CZ80CoreT<Bus>::SBC_HL_BC           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SBC  HL, BC"         },
+	{ &CZ80CoreT<Bus>::LD_off_nn_BC        , 0,										"LD   (%W), BC"    },
+	{ &CZ80CoreT<Bus>::NEG                 , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"NEG"               },
+	{ &CZ80CoreT<Bus>::RETN                , 0,										"RETN"              },
+	{ &CZ80CoreT<Bus>::IM_0                , 0,										"IM   0"              },
+	{ &CZ80CoreT<Bus>::LD_I_A              , 0,										"LD   I, A"            },
+	{ &CZ80CoreT<Bus>::IN_C_off_C          , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"IN   C, (C)"          },
+	{ &CZ80CoreT<Bus>::OUT_off_C_C         , 0,										"OUT  (C), C"         },
+	{ &CZ80CoreT<Bus>::ADC_HL_BC           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADC  HL, BC"         },
+	{ &CZ80CoreT<Bus>::LD_BC_off_nn        , 0,										"LD   BC, (%W)"    },
+	{ &CZ80CoreT<Bus>::NEG                 , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"NEG"               },
+	{ &CZ80CoreT<Bus>::RETI                , 0,										"RETI"              },
+	{ &CZ80CoreT<Bus>::IM_0                , 0,										"IM   0"              },
+	{ &CZ80CoreT<Bus>::LD_R_A              , 0,										"LD   R, A"            },
+	{ &CZ80CoreT<Bus>::IN_D_off_C          , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"IN   D, (C)"          },
+	{ &CZ80CoreT<Bus>::OUT_off_C_D         , 0,										"OUT  (C), D"         },
+	{ &CZ80CoreT<Bus>::SBC_HL_DE           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SBC  HL, DE"         },
+	{ &CZ80CoreT<Bus>::LD_off_nn_DE        , 0,										"LD   (%W), DE"    },
+	{ &CZ80CoreT<Bus>::NEG                 , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"NEG"               },
+	{ &CZ80CoreT<Bus>::RETN                , 0,										"RETN"              },
+	{ &CZ80CoreT<Bus>::IM_1                , 0,										"IM   1"              },
+	{ &CZ80CoreT<Bus>::LD_A_I              , 0,										"LD   A, I"            },
+	{ &CZ80CoreT<Bus>::IN_E_off_C          , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"IN   E, (C)"          },
+	{ &CZ80CoreT<Bus>::OUT_off_C_E         , 0,										"OUT  (C), E"         },
+	{ &CZ80CoreT<Bus>::ADC_HL_DE           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADC  HL, DE"         },
+	{ &CZ80CoreT<Bus>::LD_DE_off_nn        , 0,										"LD   DE, (%W)"    },
+	{ &CZ80CoreT<Bus>::NEG                 , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"NEG"               },
+	{ &CZ80CoreT<Bus>::RETN                , 0,										"RETN"              },
+	{ &CZ80CoreT<Bus>::IM_2                , 0,										"IM   2"              },
+	{ &CZ80CoreT<Bus>::LD_A_R              , 0,										"LD   A, R"            },
+	{ &CZ80CoreT<Bus>::IN_H_off_C          , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"IN   H, (C)"          },
+	{ &CZ80CoreT<Bus>::OUT_off_C_H         , 0,										"OUT  (C), H"         },
+	{ &CZ80CoreT<Bus>::SBC_HL_HL           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SBC  HL, HL"         },
+	{ &CZ80CoreT<Bus>::LD_off_nn_HL        , 0,										"LD   (%W), HL"    },
+	{ &CZ80CoreT<Bus>::NEG                 , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"NEG"               },
+	{ &CZ80CoreT<Bus>::RETN                , 0,										"RETN"              },
+	{ &CZ80CoreT<Bus>::IM_0                , 0,										"IM   0"              },
+	{ &CZ80CoreT<Bus>::RRD                 , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RRD"               },
+	{ &CZ80CoreT<Bus>::IN_L_off_C          , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"IN   L, (C)"          },
+	{ &CZ80CoreT<Bus>::OUT_off_C_L         , 0,										"OUT  (C), L"         },
+	{ &CZ80CoreT<Bus>::ADC_HL_HL           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADC  HL, HL"         },
+	{ &CZ80CoreT<Bus>::LD_HL_off_nn        , 0,										"LD   HL, (%W)"    },
+	{ &CZ80CoreT<Bus>::NEG                 , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"NEG"               },
+	{ &CZ80CoreT<Bus>::RETN                , 0,										"RETN"              },
+	{ &CZ80CoreT<Bus>::IM_0                , 0,										"IM   0"              },
+	{ &CZ80CoreT<Bus>::RLD                  , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RLD"               },
+	{ &CZ80CoreT<Bus>::IN_F_off_C          , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"IN   F, (C)"          },
+	{ &CZ80CoreT<Bus>::OUT_off_C_0         , 0,										"OUT  (C), 0"         },
+	{ &CZ80CoreT<Bus>::SBC_HL_SP           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SBC  HL, SP"         },
+	{ &CZ80CoreT<Bus>::LD_off_nn_SP        , 0,										"LD   (%W), SP"    },
+	{ &CZ80CoreT<Bus>::NEG                 , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"NEG"               },
+	{ &CZ80CoreT<Bus>::RETN                , 0,										"RETN"              },
+	{ &CZ80CoreT<Bus>::IM_1                , 0,										"IM   1" },
     { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::IN_A_off_C          , CZ80Core::OPCODEFLAG_AltersFlags,		"IN   A, (C)" },
-	{ &CZ80Core::OUT_off_C_A         , 0,										"OUT  (C), A" },
-	{ &CZ80Core::ADC_HL_SP           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADC  HL, SP"         },
-	{ &CZ80Core::LD_SP_off_nn        , 0,										"LD   SP, (%W)"    },
-	{ &CZ80Core::NEG                 , CZ80Core::OPCODEFLAG_AltersFlags,		"NEG"               },
-	{ &CZ80Core::RETN                , 0,										"RETN" },
-	{ &CZ80Core::IM_2                , 0,										"IM   2" },
+	{ &CZ80CoreT<Bus>::IN_A_off_C          , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"IN   A, (C)" },
+	{ &CZ80CoreT<Bus>::OUT_off_C_A         , 0,										"OUT  (C), A" },
+	{ &CZ80CoreT<Bus>::ADC_HL_SP           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADC  HL, SP"         },
+	{ &CZ80CoreT<Bus>::LD_SP_off_nn        , 0,										"LD   SP, (%W)"    },
+	{ &CZ80CoreT<Bus>::NEG                 , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"NEG"               },
+	{ &CZ80CoreT<Bus>::RETN                , 0,										"RETN" },
+	{ &CZ80CoreT<Bus>::IM_2                , 0,										"IM   2" },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
@@ -944,34 +948,34 @@ CZ80Core::Z80OpcodeTable CZ80Core::ED_Opcodes = {
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::LDI                 , CZ80Core::OPCODEFLAG_AltersFlags,		"LDI"               },
-	{ &CZ80Core::CPI                 , CZ80Core::OPCODEFLAG_AltersFlags,		"CPI"               },
-	{ &CZ80Core::INI                 , CZ80Core::OPCODEFLAG_AltersFlags,		"INI"               },
-	{ &CZ80Core::OUTI                , CZ80Core::OPCODEFLAG_AltersFlags,		"OUTI"              },
+	{ &CZ80CoreT<Bus>::LDI                 , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LDI"               },
+	{ &CZ80CoreT<Bus>::CPI                 , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"CPI"               },
+	{ &CZ80CoreT<Bus>::INI                 , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"INI"               },
+	{ &CZ80CoreT<Bus>::OUTI                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"OUTI"              },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LDD                 , CZ80Core::OPCODEFLAG_AltersFlags,		"LDD"               },
-	{ &CZ80Core::CPD                 , CZ80Core::OPCODEFLAG_AltersFlags,		"CPD"               },
-	{ &CZ80Core::IND                 , CZ80Core::OPCODEFLAG_AltersFlags,		"IND"               },
-	{ &CZ80Core::OUTD                , CZ80Core::OPCODEFLAG_AltersFlags,		"OUTD"              },
+	{ &CZ80CoreT<Bus>::LDD                 , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LDD"               },
+	{ &CZ80CoreT<Bus>::CPD                 , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"CPD"               },
+	{ &CZ80CoreT<Bus>::IND                 , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"IND"               },
+	{ &CZ80CoreT<Bus>::OUTD                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"OUTD"              },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::LDIR                , CZ80Core::OPCODEFLAG_AltersFlags,		"LDIR"              },
-	{ &CZ80Core::CPIR                , CZ80Core::OPCODEFLAG_AltersFlags,		"CPIR"              },
-	{ &CZ80Core::INIR                , CZ80Core::OPCODEFLAG_AltersFlags,		"INIR"              },
-	{ &CZ80Core::OTIR                , CZ80Core::OPCODEFLAG_AltersFlags,		"OTIR" },
+	{ &CZ80CoreT<Bus>::LDIR                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LDIR"              },
+	{ &CZ80CoreT<Bus>::CPIR                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"CPIR"              },
+	{ &CZ80CoreT<Bus>::INIR                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"INIR"              },
+	{ &CZ80CoreT<Bus>::OTIR                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"OTIR" },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::LDDR                , CZ80Core::OPCODEFLAG_AltersFlags,		"LDDR"              },
-	{ &CZ80Core::CPDR                , CZ80Core::OPCODEFLAG_AltersFlags,		"CPDR"              },
-	{ &CZ80Core::INDR                , CZ80Core::OPCODEFLAG_AltersFlags,		"INDR"              },
-	{ &CZ80Core::OTDR                , CZ80Core::OPCODEFLAG_AltersFlags,		"OTDR"              },
+	{ &CZ80CoreT<Bus>::LDDR                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LDDR"              },
+	{ &CZ80CoreT<Bus>::CPDR                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"CPDR"              },
+	{ &CZ80CoreT<Bus>::INDR                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"INDR"              },
+	{ &CZ80CoreT<Bus>::OTDR                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"OTDR"              },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
@@ -1043,7 +1047,8 @@ CZ80Core::Z80OpcodeTable CZ80Core::ED_Opcodes = {
 } };
 
 
-CZ80Core::Z80OpcodeTable CZ80Core::FD_Opcodes = {
+template <class Bus>
+const typename CZ80CoreT<Bus>::Z80OpcodeTable CZ80CoreT<Bus>::FD_Opcodes = {
 {
     { nullptr							 , 0,										nullptr					},
     { nullptr							 , 0,										nullptr					},
@@ -1054,7 +1059,7 @@ CZ80Core::Z80OpcodeTable CZ80Core::FD_Opcodes = {
     { nullptr							 , 0,										nullptr					},
     { nullptr							 , 0,										nullptr					},
     { nullptr							 , 0,										nullptr					},
-	{ &CZ80Core::ADD_IY_BC           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD IY, BC"			},
+	{ &CZ80CoreT<Bus>::ADD_IY_BC           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADD IY, BC"			},
     { nullptr							 , 0,										nullptr					},
     { nullptr							 , 0,										nullptr					},
     { nullptr							 , 0,										nullptr					},
@@ -1070,7 +1075,7 @@ CZ80Core::Z80OpcodeTable CZ80Core::FD_Opcodes = {
     { nullptr							 , 0,										nullptr					},
     { nullptr							 , 0,										nullptr					},
     { nullptr							 , 0,										nullptr					},
-	{ &CZ80Core::ADD_IY_DE      	 , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD IY, DE"			},
+	{ &CZ80CoreT<Bus>::ADD_IY_DE      	 , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADD IY, DE"			},
     { nullptr							 , 0,										nullptr					},
     { nullptr							 , 0,										nullptr					},
     { nullptr							 , 0,										nullptr					},
@@ -1078,31 +1083,31 @@ CZ80Core::Z80OpcodeTable CZ80Core::FD_Opcodes = {
     { nullptr							 , 0,										nullptr					},
     { nullptr							 , 0,										nullptr					},
     { nullptr							 , 0,										nullptr					},
-	{ &CZ80Core::LD_IY_nn            , 0,										"LD   IY, %W"		},
-	{ &CZ80Core::LD_off_nn_IY        , 0,										"LD   (%W), IY"		},
-	{ &CZ80Core::INC_IY              , 0,										"INC IY"				},
-	{ &CZ80Core::INC_IYh             , CZ80Core::OPCODEFLAG_AltersFlags,		"INC IYh"			},
-	{ &CZ80Core::DEC_IYh             , CZ80Core::OPCODEFLAG_AltersFlags,		"DEC IYh"			},
-	{ &CZ80Core::LD_IYh_n            , 0,										"LD   IYh, %B"		},
+	{ &CZ80CoreT<Bus>::LD_IY_nn            , 0,										"LD   IY, %W"		},
+	{ &CZ80CoreT<Bus>::LD_off_nn_IY        , 0,										"LD   (%W), IY"		},
+	{ &CZ80CoreT<Bus>::INC_IY              , 0,										"INC IY"				},
+	{ &CZ80CoreT<Bus>::INC_IYh             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"INC IYh"			},
+	{ &CZ80CoreT<Bus>::DEC_IYh             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"DEC IYh"			},
+	{ &CZ80CoreT<Bus>::LD_IYh_n            , 0,										"LD   IYh, %B"		},
     { nullptr							 , 0,										nullptr					},
     { nullptr							 , 0,										nullptr					},
-	{ &CZ80Core::ADD_IY_IY           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD IY,IY"			},
-	{ &CZ80Core::LD_IY_off_nn        , 0,										"LD   IY, (%W)"		},
-	{ &CZ80Core::DEC_IY              , 0,										"DEC IY"				},
-	{ &CZ80Core::INC_IYl             , CZ80Core::OPCODEFLAG_AltersFlags,		"INC IYl"			},
-	{ &CZ80Core::DEC_IYl             , CZ80Core::OPCODEFLAG_AltersFlags,		"DEC IYl"			},
-	{ &CZ80Core::LD_IYl_n            , 0,										"LD   IYl, %B"		},
+	{ &CZ80CoreT<Bus>::ADD_IY_IY           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADD IY,IY"			},
+	{ &CZ80CoreT<Bus>::LD_IY_off_nn        , 0,										"LD   IY, (%W)"		},
+	{ &CZ80CoreT<Bus>::DEC_IY              , 0,										"DEC IY"				},
+	{ &CZ80CoreT<Bus>::INC_IYl             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"INC IYl"			},
+	{ &CZ80CoreT<Bus>::DEC_IYl             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"DEC IYl"			},
+	{ &CZ80CoreT<Bus>::LD_IYl_n            , 0,										"LD   IYl, %B"		},
     { nullptr							 , 0,										nullptr					},
     { nullptr							 , 0,										nullptr					},
     { nullptr							 , 0,										nullptr					},
     { nullptr							 , 0,										nullptr					},
     { nullptr							 , 0,										nullptr					},
-	{ &CZ80Core::INC_off_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"INC (IY + %O)"	},
-	{ &CZ80Core::DEC_off_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"DEC (IY + %O)"	},
-	{ &CZ80Core::LD_off_IY_d_n       , 0,										"LD   (IY + %O), %B"},
+	{ &CZ80CoreT<Bus>::INC_off_IY_d        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"INC (IY + %O)"	},
+	{ &CZ80CoreT<Bus>::DEC_off_IY_d        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"DEC (IY + %O)"	},
+	{ &CZ80CoreT<Bus>::LD_off_IY_d_n       , 0,										"LD   (IY + %O), %B"},
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::ADD_IY_SP           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD IY, SP"         },
+	{ &CZ80CoreT<Bus>::ADD_IY_SP           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADD IY, SP"         },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
@@ -1113,129 +1118,129 @@ CZ80Core::Z80OpcodeTable CZ80Core::FD_Opcodes = {
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_B_IYh            , 0,										"LD   B, IYh"         },
-	{ &CZ80Core::LD_B_IYl            , 0,										"LD   B, IYl"         },
-	{ &CZ80Core::LD_B_off_IY_d       , 0,										"LD   B, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_IYh            , 0,										"LD   B, IYh"         },
+	{ &CZ80CoreT<Bus>::LD_B_IYl            , 0,										"LD   B, IYl"         },
+	{ &CZ80CoreT<Bus>::LD_B_off_IY_d       , 0,										"LD   B, (IY + %O)" },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_C_IYh            , 0,										"LD   C, IYh"         },
-	{ &CZ80Core::LD_C_IYl            , 0,										"LD   C, IYl"         },
-	{ &CZ80Core::LD_C_off_IY_d       , 0,										"LD   C, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_IYh            , 0,										"LD   C, IYh"         },
+	{ &CZ80CoreT<Bus>::LD_C_IYl            , 0,										"LD   C, IYl"         },
+	{ &CZ80CoreT<Bus>::LD_C_off_IY_d       , 0,										"LD   C, (IY + %O)" },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_D_IYh            , 0,										"LD   D, IYh"         },
-	{ &CZ80Core::LD_D_IYl            , 0,										"LD   D ,IYl"         },
-	{ &CZ80Core::LD_D_off_IY_d       , 0,										"LD   D, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_IYh            , 0,										"LD   D, IYh"         },
+	{ &CZ80CoreT<Bus>::LD_D_IYl            , 0,										"LD   D ,IYl"         },
+	{ &CZ80CoreT<Bus>::LD_D_off_IY_d       , 0,										"LD   D, (IY + %O)" },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_E_IYh            , 0,										"LD   E, IYh"         },
-	{ &CZ80Core::LD_E_IYl            , 0,										"LD   E, IYl"         },
-	{ &CZ80Core::LD_E_off_IY_d       , 0,										"LD   E, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_IYh            , 0,										"LD   E, IYh"         },
+	{ &CZ80CoreT<Bus>::LD_E_IYl            , 0,										"LD   E, IYl"         },
+	{ &CZ80CoreT<Bus>::LD_E_off_IY_d       , 0,										"LD   E, (IY + %O)" },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_IYh_B            , 0,										"LD   IYh, B"         },
-	{ &CZ80Core::LD_IYh_C            , 0,										"LD   IYh, C"         },
-	{ &CZ80Core::LD_IYh_D            , 0,										"LD   IYh, D"         },
-	{ &CZ80Core::LD_IYh_E            , 0,										"LD   IYh, E"         },
-	{ &CZ80Core::LD_IYh_IYh          , 0,										"LD   IYh, IYh"       },
-	{ &CZ80Core::LD_IYh_IYl          , 0,										"LD   IYh, IYl"       },
-	{ &CZ80Core::LD_H_off_IY_d       , 0,										"LD   H, (IY + %O)" },
-	{ &CZ80Core::LD_IYh_A            , 0,										"LD   IYh, A"         },
-	{ &CZ80Core::LD_IYl_B            , 0,										"LD   IYl, B"         },
-	{ &CZ80Core::LD_IYl_C            , 0,										"LD   IYl, C"         },
-	{ &CZ80Core::LD_IYl_D            , 0,										"LD   IYl, D"         },
-	{ &CZ80Core::LD_IYl_E            , 0,										"LD   IYl, E"         },
-	{ &CZ80Core::LD_IYl_IYh          , 0,										"LD   IYl, IYh"       },
-	{ &CZ80Core::LD_IYl_IYl          , 0,										"LD   IYl, IYl"       },
-	{ &CZ80Core::LD_L_off_IY_d       , 0,										"LD   L, IY + %O)" },
-	{ &CZ80Core::LD_IYl_A            , 0,										"LD   IYl, A"         },
-	{ &CZ80Core::LD_off_IY_d_B       , 0,										"LD   (IY + %O), B" },
-	{ &CZ80Core::LD_off_IY_d_C       , 0,										"LD   (IY + %O), C" },
-	{ &CZ80Core::LD_off_IY_d_D       , 0,										"LD   (IY + %O), D" },
-	{ &CZ80Core::LD_off_IY_d_E       , 0,										"LD   (IY + %O), E" },
-	{ &CZ80Core::LD_off_IY_d_H       , 0,										"LD   (IY + %O), H" },
-	{ &CZ80Core::LD_off_IY_d_L       , 0,										"LD   (IY + %O), L" },
+	{ &CZ80CoreT<Bus>::LD_IYh_B            , 0,										"LD   IYh, B"         },
+	{ &CZ80CoreT<Bus>::LD_IYh_C            , 0,										"LD   IYh, C"         },
+	{ &CZ80CoreT<Bus>::LD_IYh_D            , 0,										"LD   IYh, D"         },
+	{ &CZ80CoreT<Bus>::LD_IYh_E            , 0,										"LD   IYh, E"         },
+	{ &CZ80CoreT<Bus>::LD_IYh_IYh          , 0,										"LD   IYh, IYh"       },
+	{ &CZ80CoreT<Bus>::LD_IYh_IYl          , 0,										"LD   IYh, IYl"       },
+	{ &CZ80CoreT<Bus>::LD_H_off_IY_d       , 0,										"LD   H, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_IYh_A            , 0,										"LD   IYh, A"         },
+	{ &CZ80CoreT<Bus>::LD_IYl_B            , 0,										"LD   IYl, B"         },
+	{ &CZ80CoreT<Bus>::LD_IYl_C            , 0,										"LD   IYl, C"         },
+	{ &CZ80CoreT<Bus>::LD_IYl_D            , 0,										"LD   IYl, D"         },
+	{ &CZ80CoreT<Bus>::LD_IYl_E            , 0,										"LD   IYl, E"         },
+	{ &CZ80CoreT<Bus>::LD_IYl_IYh          , 0,										"LD   IYl, IYh"       },
+	{ &CZ80CoreT<Bus>::LD_IYl_IYl          , 0,										"LD   IYl, IYl"       },
+	{ &CZ80CoreT<Bus>::LD_L_off_IY_d       , 0,										"LD   L, IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_IYl_A            , 0,										"LD   IYl, A"         },
+	{ &CZ80CoreT<Bus>::LD_off_IY_d_B       , 0,										"LD   (IY + %O), B" },
+	{ &CZ80CoreT<Bus>::LD_off_IY_d_C       , 0,										"LD   (IY + %O), C" },
+	{ &CZ80CoreT<Bus>::LD_off_IY_d_D       , 0,										"LD   (IY + %O), D" },
+	{ &CZ80CoreT<Bus>::LD_off_IY_d_E       , 0,										"LD   (IY + %O), E" },
+	{ &CZ80CoreT<Bus>::LD_off_IY_d_H       , 0,										"LD   (IY + %O), H" },
+	{ &CZ80CoreT<Bus>::LD_off_IY_d_L       , 0,										"LD   (IY + %O), L" },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_off_IY_d_A       , 0,										"LD   (IY + %O), A" },
+	{ &CZ80CoreT<Bus>::LD_off_IY_d_A       , 0,										"LD   (IY + %O), A" },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_A_IYh            , 0,										"LD   A, IYh"         },
-	{ &CZ80Core::LD_A_IYl            , 0,										"LD   A, IYl"         },
-	{ &CZ80Core::LD_A_off_IY_d       , 0,										"LD   A, (IY + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_IYh            , 0,										"LD   A, IYh"         },
+	{ &CZ80CoreT<Bus>::LD_A_IYl            , 0,										"LD   A, IYl"         },
+	{ &CZ80CoreT<Bus>::LD_A_off_IY_d       , 0,										"LD   A, (IY + %O)" },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::ADD_A_IYh           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD  A, IYh"        },
-	{ &CZ80Core::ADD_A_IYl           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD  A, IYl"        },
-	{ &CZ80Core::ADD_A_off_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"ADD  A, (IY + %O)"},
+	{ &CZ80CoreT<Bus>::ADD_A_IYh           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADD  A, IYh"        },
+	{ &CZ80CoreT<Bus>::ADD_A_IYl           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADD  A, IYl"        },
+	{ &CZ80CoreT<Bus>::ADD_A_off_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADD  A, (IY + %O)"},
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::ADC_A_IYh           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADC  A, IYh"        },
-	{ &CZ80Core::ADC_A_IYl           , CZ80Core::OPCODEFLAG_AltersFlags,		"ADC  A, IYl"        },
-	{ &CZ80Core::ADC_A_off_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"ADC  A, (IY + %O)"},
+	{ &CZ80CoreT<Bus>::ADC_A_IYh           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADC  A, IYh"        },
+	{ &CZ80CoreT<Bus>::ADC_A_IYl           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADC  A, IYl"        },
+	{ &CZ80CoreT<Bus>::ADC_A_off_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"ADC  A, (IY + %O)"},
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::SUB_A_IYh           , CZ80Core::OPCODEFLAG_AltersFlags,		"SUB  A,IYh"        },
-	{ &CZ80Core::SUB_A_IYl           , CZ80Core::OPCODEFLAG_AltersFlags,		"SUB  A,IYl"        },
-	{ &CZ80Core::SUB_A_off_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"SUB  A,(IY + %O)"},
+	{ &CZ80CoreT<Bus>::SUB_A_IYh           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SUB  A,IYh"        },
+	{ &CZ80CoreT<Bus>::SUB_A_IYl           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SUB  A,IYl"        },
+	{ &CZ80CoreT<Bus>::SUB_A_off_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SUB  A,(IY + %O)"},
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::SBC_A_IYh           , CZ80Core::OPCODEFLAG_AltersFlags,		"SBC  A,IYh"        },
-	{ &CZ80Core::SBC_A_IYl           , CZ80Core::OPCODEFLAG_AltersFlags,		"SBC  A,IYl"        },
-	{ &CZ80Core::SBC_A_off_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"SBC  A,(IY + %O)"},
+	{ &CZ80CoreT<Bus>::SBC_A_IYh           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SBC  A,IYh"        },
+	{ &CZ80CoreT<Bus>::SBC_A_IYl           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SBC  A,IYl"        },
+	{ &CZ80CoreT<Bus>::SBC_A_off_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SBC  A,(IY + %O)"},
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::AND_IYh             , CZ80Core::OPCODEFLAG_AltersFlags,		"AND  IYh"          },
-	{ &CZ80Core::AND_IYl             , CZ80Core::OPCODEFLAG_AltersFlags,		"AND  IYl"          },
-	{ &CZ80Core::AND_off_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"AND  (IY + %O)"  },
+	{ &CZ80CoreT<Bus>::AND_IYh             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"AND  IYh"          },
+	{ &CZ80CoreT<Bus>::AND_IYl             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"AND  IYl"          },
+	{ &CZ80CoreT<Bus>::AND_off_IY_d        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"AND  (IY + %O)"  },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::XOR_IYh             , CZ80Core::OPCODEFLAG_AltersFlags,		"XOR  IYh"           },
-	{ &CZ80Core::XOR_IYl             , CZ80Core::OPCODEFLAG_AltersFlags,		"XOR  IYl"           },
-	{ &CZ80Core::XOR_off_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"XOR  (IY + %O)"   },
+	{ &CZ80CoreT<Bus>::XOR_IYh             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"XOR  IYh"           },
+	{ &CZ80CoreT<Bus>::XOR_IYl             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"XOR  IYl"           },
+	{ &CZ80CoreT<Bus>::XOR_off_IY_d        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"XOR  (IY + %O)"   },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::OR_IYh              , CZ80Core::OPCODEFLAG_AltersFlags,		"OR   IYh"            },
-	{ &CZ80Core::OR_IYl              , CZ80Core::OPCODEFLAG_AltersFlags,		"OR   IYl"            },
-	{ &CZ80Core::OR_off_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags,		"OR   (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::OR_IYh              , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"OR   IYh"            },
+	{ &CZ80CoreT<Bus>::OR_IYl              , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"OR   IYl"            },
+	{ &CZ80CoreT<Bus>::OR_off_IY_d         , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"OR   (IY + %O)"    },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
     { nullptr							 , 0,										nullptr },
-	{ &CZ80Core::CP_IYh              , CZ80Core::OPCODEFLAG_AltersFlags,		"CP   IYh"            },
-	{ &CZ80Core::CP_IYl              , CZ80Core::OPCODEFLAG_AltersFlags,		"CP   IYl"            },
-	{ &CZ80Core::CP_off_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags,		"CP   (IY + %O)"    },
+	{ &CZ80CoreT<Bus>::CP_IYh              , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"CP   IYh"            },
+	{ &CZ80CoreT<Bus>::CP_IYl              , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"CP   IYl"            },
+	{ &CZ80CoreT<Bus>::CP_off_IY_d         , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"CP   (IY + %O)"    },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
@@ -1270,15 +1275,15 @@ CZ80Core::Z80OpcodeTable CZ80Core::FD_Opcodes = {
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::POP_IY              , 0,										"POP  IY"            },
+	{ &CZ80CoreT<Bus>::POP_IY              , 0,										"POP  IY"            },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::EX_off_SP_IY        , 0,										"EX   (SP), IY"        },
+	{ &CZ80CoreT<Bus>::EX_off_SP_IY        , 0,										"EX   (SP), IY"        },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::PUSH_IY             , 0,										"PUSH IY"           },
+	{ &CZ80CoreT<Bus>::PUSH_IY             , 0,										"PUSH IY"           },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::JP_off_IY           , 0,										"JP   (IY)"           },
+	{ &CZ80CoreT<Bus>::JP_off_IY           , 0,										"JP   (IY)"           },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
@@ -1294,7 +1299,7 @@ CZ80Core::Z80OpcodeTable CZ80Core::FD_Opcodes = {
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
-	{ &CZ80Core::LD_SP_IY            , 0,										"LD   SP, IY"          },
+	{ &CZ80CoreT<Bus>::LD_SP_IY            , 0,										"LD   SP, IY"          },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
     { nullptr							 , 0,										nullptr                },
@@ -1304,524 +1309,526 @@ CZ80Core::Z80OpcodeTable CZ80Core::FD_Opcodes = {
 } };
 
 
-CZ80Core::Z80OpcodeTable CZ80Core::DDCB_Opcodes = {
+template <class Bus>
+const typename CZ80CoreT<Bus>::Z80OpcodeTable CZ80CoreT<Bus>::DDCB_Opcodes = {
 {
-	{ &CZ80Core::LD_B_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   B, RLC (IX + %O)" },
-	{ &CZ80Core::LD_C_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   C, RLC (IX + %O)" },
-	{ &CZ80Core::LD_D_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   D, RLC (IX + %O)" },
-	{ &CZ80Core::LD_E_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   E, RLC (IX + %O)" },
-	{ &CZ80Core::LD_H_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   H, RLC (IX + %O)" },
-	{ &CZ80Core::LD_L_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   L, RLC (IX + %O)" },
-	{ &CZ80Core::RLC_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"RLC  (IX + %O)" },
-	{ &CZ80Core::LD_A_RLC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   A, RLC (IX + %O)" },
-	{ &CZ80Core::LD_B_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   B, RRC  (IX + %O)" },
-	{ &CZ80Core::LD_C_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   C, RRC  (IX + %O)" },
-	{ &CZ80Core::LD_D_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   D, RRC  (IX + %O)" },
-	{ &CZ80Core::LD_E_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   E, RRC  (IX + %O)" },
-	{ &CZ80Core::LD_H_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   H, RRC  (IX + %O)" },
-	{ &CZ80Core::LD_L_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   L, RRC  (IX + %O)" },
-	{ &CZ80Core::RRC_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"RRC  (IX + %O)" },
-	{ &CZ80Core::LD_A_RRC_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   A, RRC  (IX + %O)" },
-	{ &CZ80Core::LD_B_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   B, RL (IX + %O)" },
-	{ &CZ80Core::LD_C_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   C, RL (IX + %O)" },
-	{ &CZ80Core::LD_D_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   D, RL (IX + %O)" },
-	{ &CZ80Core::LD_E_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   E, RL (IX + %O)" },
-	{ &CZ80Core::LD_H_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   H, RL (IX + %O)" },
-	{ &CZ80Core::LD_L_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   L, RL (IX + %O)" },
-	{ &CZ80Core::RL_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags,		"RL   (IX + %O)" },
-	{ &CZ80Core::LD_A_RL_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   A, RL (IX + %O)" },
-	{ &CZ80Core::LD_B_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   B, RR (IX + %O)" },
-	{ &CZ80Core::LD_C_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   C, RR (IX + %O)" },
-	{ &CZ80Core::LD_D_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   D, RR (IX + %O)" },
-	{ &CZ80Core::LD_E_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   E, RR (IX + %O)" },
-	{ &CZ80Core::LD_H_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   H, RR (IX + %O)" },
-	{ &CZ80Core::LD_L_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   L, RR (IX + %O)" },
-	{ &CZ80Core::RR_off_IX_IY_d         , CZ80Core::OPCODEFLAG_AltersFlags,		"RR   (IX + %O)" },
-	{ &CZ80Core::LD_A_RR_off_IX_IY_d    , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   A, RR (IX + %O)" },
-	{ &CZ80Core::LD_B_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   B, SLA (IX + %O)" },
-	{ &CZ80Core::LD_C_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   C, SLA (IX + %O)" },
-	{ &CZ80Core::LD_D_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   D, SLA (IX + %O)" },
-	{ &CZ80Core::LD_E_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   E, SLA (IX + %O)" },
-	{ &CZ80Core::LD_H_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   H, SLA (IX + %O)" },
-	{ &CZ80Core::LD_L_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   L, SLA (IX + %O)" },
-	{ &CZ80Core::SLA_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"SLA  (IX + %O)" },
-	{ &CZ80Core::LD_A_SLA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   A, SLA (IX + %O)" },
-	{ &CZ80Core::LD_B_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   B, SRA (IX + %O)" },
-	{ &CZ80Core::LD_C_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   C, SRA (IX + %O)" },
-	{ &CZ80Core::LD_D_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   D, SRA (IX + %O)" },
-	{ &CZ80Core::LD_E_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   E, SRA (IX + %O)" },
-	{ &CZ80Core::LD_H_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   H, SRA (IX + %O)" },
-	{ &CZ80Core::LD_L_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   L, SRA (IX + %O)" },
-	{ &CZ80Core::SRA_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"SRA  (IX + %O)" },
-	{ &CZ80Core::LD_A_SRA_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   A, SRA (IX + %O)" },
-	{ &CZ80Core::LD_B_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   B, SLL  (IX + %O)" },
-	{ &CZ80Core::LD_C_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   C, SLL  (IX + %O)" },
-	{ &CZ80Core::LD_D_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   D, SLL  (IX + %O)" },
-	{ &CZ80Core::LD_E_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   E, SLL  (IX + %O)" },
-	{ &CZ80Core::LD_H_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   H, SLL  (IX + %O)" },
-	{ &CZ80Core::LD_L_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   L, SLL  (IX + %O)" },
-	{ &CZ80Core::SLL_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"SLL  (IX + %O)" },
-	{ &CZ80Core::LD_A_SLL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   A, SLL  (IX + %O)" },
-	{ &CZ80Core::LD_B_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   B, SRL (IX + %O)" },
-	{ &CZ80Core::LD_C_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   C, SRL (IX + %O)" },
-	{ &CZ80Core::LD_D_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   D, SRL (IX + %O)" },
-	{ &CZ80Core::LD_E_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   E, SRL (IX + %O)" },
-	{ &CZ80Core::LD_H_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   H, SRL (IX + %O)" },
-	{ &CZ80Core::LD_L_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   L, SRL (IX + %O)" },
-	{ &CZ80Core::SRL_off_IX_IY_d        , CZ80Core::OPCODEFLAG_AltersFlags,		"SRL  (IX + %O)" },
-	{ &CZ80Core::LD_A_SRL_off_IX_IY_d   , CZ80Core::OPCODEFLAG_AltersFlags,		"LD   A,SRL (IX + %O)" },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
-	{ &CZ80Core::BIT_0_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
-	{ &CZ80Core::BIT_1_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
-	{ &CZ80Core::BIT_2_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
-	{ &CZ80Core::BIT_3_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
-	{ &CZ80Core::BIT_4_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
-	{ &CZ80Core::BIT_5_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
-	{ &CZ80Core::BIT_6_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
-	{ &CZ80Core::BIT_7_off_IX_IY_d      , CZ80Core::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
-	{ &CZ80Core::LD_B_RES_0_off_IX_IY_d , 0,									"LD   B, RES  0, (IX + %O)" },
-	{ &CZ80Core::LD_C_RES_0_off_IX_IY_d , 0,									"LD   C, RES  0, (IX + %O)" },
-	{ &CZ80Core::LD_D_RES_0_off_IX_IY_d , 0,									"LD   D, RES  0, (IX + %O)" },
-	{ &CZ80Core::LD_E_RES_0_off_IX_IY_d , 0,									"LD   E, RES  0, (IX + %O)" },
-	{ &CZ80Core::LD_H_RES_0_off_IX_IY_d , 0,									"LD   H, RES  0, (IX + %O)" },
-	{ &CZ80Core::LD_L_RES_0_off_IX_IY_d , 0,									"LD   L, RES  0, (IX + %O)" },
-	{ &CZ80Core::RES_0_off_IX_IY_d      , 0,									"RES  0, (IX + %O)" },
-	{ &CZ80Core::LD_A_RES_0_off_IX_IY_d , 0,									"LD   A, RES 0, (IX + %O)" },
-	{ &CZ80Core::LD_B_RES_1_off_IX_IY_d , 0,									"LD   B, RES  1, (IX + %O)" },
-	{ &CZ80Core::LD_C_RES_1_off_IX_IY_d , 0,									"LD   C, RES  1, (IX + %O)" },
-	{ &CZ80Core::LD_D_RES_1_off_IX_IY_d , 0,									"LD   D, RES  1, (IX + %O)" },
-	{ &CZ80Core::LD_E_RES_1_off_IX_IY_d , 0,									"LD   E, RES  1, (IX + %O)" },
-	{ &CZ80Core::LD_H_RES_1_off_IX_IY_d , 0,									"LD   H, RES  1, (IX + %O)" },
-	{ &CZ80Core::LD_L_RES_1_off_IX_IY_d , 0,									"LD   L, RES  1, (IX + %O)" },
-	{ &CZ80Core::RES_1_off_IX_IY_d      , 0,									"RES  1, (IX + %O)" },
-	{ &CZ80Core::LD_A_RES_1_off_IX_IY_d , 0,									"LD   A, RES  1, (IX + %O)" },
-	{ &CZ80Core::LD_B_RES_2_off_IX_IY_d , 0,									"LD   B, RES  2, (IX + %O)" },
-	{ &CZ80Core::LD_C_RES_2_off_IX_IY_d , 0,									"LD   C, RES  2, (IX + %O)" },
-	{ &CZ80Core::LD_D_RES_2_off_IX_IY_d , 0,									"LD   D, RES  2, (IX + %O)" },
-	{ &CZ80Core::LD_E_RES_2_off_IX_IY_d , 0,									"LD   E, RES  2, (IX + %O)" },
-	{ &CZ80Core::LD_H_RES_2_off_IX_IY_d , 0,									"LD   H, RES  2, (IX + %O)" },
-	{ &CZ80Core::LD_L_RES_2_off_IX_IY_d , 0,									"LD   L, RES  2, (IX + %O)" },
-	{ &CZ80Core::RES_2_off_IX_IY_d      , 0,									"RES  2, (IX + %O)" },
-	{ &CZ80Core::LD_A_RES_2_off_IX_IY_d , 0,									"LD   A, RES  2, (IX + %O)" },
-	{ &CZ80Core::LD_B_RES_3_off_IX_IY_d , 0,									"LD   B, RES  3, (IX + %O)" },
-	{ &CZ80Core::LD_C_RES_3_off_IX_IY_d , 0,									"LD   C, RES  3, (IX + %O)" },
-	{ &CZ80Core::LD_D_RES_3_off_IX_IY_d , 0,									"LD   D, RES  3, (IX + %O)" },
-	{ &CZ80Core::LD_E_RES_3_off_IX_IY_d , 0,									"LD   E, RES  3, (IX + %O)" },
-	{ &CZ80Core::LD_H_RES_3_off_IX_IY_d , 0,									"LD   H, RES  3, (IX + %O)" },
-	{ &CZ80Core::LD_L_RES_3_off_IX_IY_d , 0,									"LD   L, RES  3, (IX + %O)" },
-	{ &CZ80Core::RES_3_off_IX_IY_d      , 0,									"RES  3, (IX + %O)" },
-	{ &CZ80Core::LD_A_RES_3_off_IX_IY_d , 0,									"LD   A, RES  3, (IX + %O)" },
-	{ &CZ80Core::LD_B_RES_4_off_IX_IY_d , 0,									"LD   B, RES  4, (IX + %O)" },
-	{ &CZ80Core::LD_C_RES_4_off_IX_IY_d , 0,									"LD   C, RES  4, (IX + %O)" },
-	{ &CZ80Core::LD_D_RES_4_off_IX_IY_d , 0,									"LD   D, RES  4, (IX + %O)" },
-	{ &CZ80Core::LD_E_RES_4_off_IX_IY_d , 0,									"LD   E, RES  4, (IX + %O)" },
-	{ &CZ80Core::LD_H_RES_4_off_IX_IY_d , 0,									"LD   H, RES  4, (IX + %O)" },
-	{ &CZ80Core::LD_L_RES_4_off_IX_IY_d , 0,									"LD   L, RES  4, (IX + %O)" },
-	{ &CZ80Core::RES_4_off_IX_IY_d      , 0,									"RES  4, (IX + %O)" },
-	{ &CZ80Core::LD_A_RES_4_off_IX_IY_d , 0,									"LD   A, RES  4, (IX + %O)" },
-	{ &CZ80Core::LD_B_RES_5_off_IX_IY_d , 0,									"LD   B, RES 5, (IX + %O)" },
-	{ &CZ80Core::LD_C_RES_5_off_IX_IY_d , 0,									"LD   C, RES 5, (IX + %O)" },
-	{ &CZ80Core::LD_D_RES_5_off_IX_IY_d , 0,									"LD   D, RES 5, (IX + %O)" },
-	{ &CZ80Core::LD_E_RES_5_off_IX_IY_d , 0,									"LD   E, RES 5, (IX + %O)" },
-	{ &CZ80Core::LD_H_RES_5_off_IX_IY_d , 0,									"LD   H, RES 5, (IX + %O)" },
-	{ &CZ80Core::LD_L_RES_5_off_IX_IY_d , 0,									"LD   L, RES 5, (IX + %O)" },
-	{ &CZ80Core::RES_5_off_IX_IY_d      , 0,									"RES  5, (IX + %O)" },
-	{ &CZ80Core::LD_A_RES_5_off_IX_IY_d , 0,									"LD   A, RES 5, (IX + %O)" },
-	{ &CZ80Core::LD_B_RES_6_off_IX_IY_d , 0,									"LD   B, RES 6, (IX + %O)" },
-	{ &CZ80Core::LD_C_RES_6_off_IX_IY_d , 0,									"LD   C, RES 6, (IX + %O)" },
-	{ &CZ80Core::LD_D_RES_6_off_IX_IY_d , 0,									"LD   D, RES 6, (IX + %O)" },
-	{ &CZ80Core::LD_E_RES_6_off_IX_IY_d , 0,									"LD   E, RES 6, (IX + %O)" },
-	{ &CZ80Core::LD_H_RES_6_off_IX_IY_d , 0,									"LD   H, RES 6, (IX + %O)" },
-	{ &CZ80Core::LD_L_RES_6_off_IX_IY_d , 0,									"LD   L, RES 6, (IX + %O)" },
-	{ &CZ80Core::RES_6_off_IX_IY_d      , 0,									"RES  6, (IX + %O)" },
-	{ &CZ80Core::LD_A_RES_6_off_IX_IY_d , 0,									"LD   A, RES 6, (IX + %O)" },
-	{ &CZ80Core::LD_B_RES_7_off_IX_IY_d , 0,									"LD   B, RES 7, (IX + %O)" },
-	{ &CZ80Core::LD_C_RES_7_off_IX_IY_d , 0,									"LD   C, RES 7, (IX + %O)" },
-	{ &CZ80Core::LD_D_RES_7_off_IX_IY_d , 0,									"LD   D, RES 7, (IX + %O)" },
-	{ &CZ80Core::LD_E_RES_7_off_IX_IY_d , 0,									"LD   E, RES 7, (IX + %O)" },
-	{ &CZ80Core::LD_H_RES_7_off_IX_IY_d , 0,									"LD   H, RES 7, (IX + %O)" },
-	{ &CZ80Core::LD_L_RES_7_off_IX_IY_d , 0,									"LD   L, RES 7, (IX + %O)" },
-	{ &CZ80Core::RES_7_off_IX_IY_d      , 0,									"RES  7, (IX + %O)" },
-	{ &CZ80Core::LD_A_RES_7_off_IX_IY_d , 0,									"LD   A, RES 7, (IX + %O)" },
-	{ &CZ80Core::LD_B_SET_0_off_IX_IY_d , 0,									"LD   B, SET 0, (IX + %O)" },
-	{ &CZ80Core::LD_C_SET_0_off_IX_IY_d , 0,									"LD   C, SET 0, (IX + %O)" },
-	{ &CZ80Core::LD_D_SET_0_off_IX_IY_d , 0,									"LD   D, SET 0, (IX + %O)" },
-	{ &CZ80Core::LD_E_SET_0_off_IX_IY_d , 0,									"LD   E, SET 0, (IX + %O)" },
-	{ &CZ80Core::LD_H_SET_0_off_IX_IY_d , 0,									"LD   H, SET 0, (IX + %O)" },
-	{ &CZ80Core::LD_L_SET_0_off_IX_IY_d , 0,									"LD   L, SET 0, (IX + %O)" },
-	{ &CZ80Core::SET_0_off_IX_IY_d      , 0,									"SET  0, (IX + %O)" },
-	{ &CZ80Core::LD_A_SET_0_off_IX_IY_d , 0,									"LD   A, SET 0, (IX + %O)" },
-	{ &CZ80Core::LD_B_SET_1_off_IX_IY_d , 0,									"LD   B, SET 1, (IX + %O)" },
-	{ &CZ80Core::LD_C_SET_1_off_IX_IY_d , 0,									"LD   C, SET 1, (IX + %O)" },
-	{ &CZ80Core::LD_D_SET_1_off_IX_IY_d , 0,									"LD   D, SET 1, (IX + %O)" },
-	{ &CZ80Core::LD_E_SET_1_off_IX_IY_d , 0,									"LD   E, SET 1, (IX + %O)" },
-	{ &CZ80Core::LD_H_SET_1_off_IX_IY_d , 0,									"LD   H, SET 1, (IX + %O)" },
-	{ &CZ80Core::LD_L_SET_1_off_IX_IY_d , 0,									"LD   L, SET 1, (IX + %O)" },
-	{ &CZ80Core::SET_1_off_IX_IY_d      , 0,									"SET  1, (IX + %O)" },
-	{ &CZ80Core::LD_A_SET_1_off_IX_IY_d , 0,									"LD   A, SET 1, (IX + %O)" },
-	{ &CZ80Core::LD_B_SET_2_off_IX_IY_d , 0,									"LD   B, SET 2, (IX + %O)" },
-	{ &CZ80Core::LD_C_SET_2_off_IX_IY_d , 0,									"LD   C, SET 2, (IX + %O)" },
-	{ &CZ80Core::LD_D_SET_2_off_IX_IY_d , 0,									"LD   D, SET 2, (IX + %O)" },
-	{ &CZ80Core::LD_E_SET_2_off_IX_IY_d , 0,									"LD   E, SET 2, (IX + %O)" },
-	{ &CZ80Core::LD_H_SET_2_off_IX_IY_d , 0,									"LD   H, SET 2, (IX + %O)" },
-	{ &CZ80Core::LD_L_SET_2_off_IX_IY_d , 0,									"LD   L, SET 2, (IX + %O)" },
-	{ &CZ80Core::SET_2_off_IX_IY_d      , 0,									"SET  2, (IX + %O)" },
-	{ &CZ80Core::LD_A_SET_2_off_IX_IY_d , 0,									"LD   A, SET 2, (IX + %O)" },
-	{ &CZ80Core::LD_B_SET_3_off_IX_IY_d , 0,									"LD   B, SET 3, (IX + %O)" },
-	{ &CZ80Core::LD_C_SET_3_off_IX_IY_d , 0,									"LD   C, SET 3, (IX + %O)" },
-	{ &CZ80Core::LD_D_SET_3_off_IX_IY_d , 0,									"LD   D, SET 3, (IX + %O)" },
-	{ &CZ80Core::LD_E_SET_3_off_IX_IY_d , 0,									"LD   E, SET 3, (IX + %O)" },
-	{ &CZ80Core::LD_H_SET_3_off_IX_IY_d , 0,									"LD   H, SET 3, (IX + %O)" },
-	{ &CZ80Core::LD_L_SET_3_off_IX_IY_d , 0,									"LD   L, SET 3, (IX + %O)" },
-	{ &CZ80Core::SET_3_off_IX_IY_d      , 0,									"SET  3, (IX + %O)" },
-	{ &CZ80Core::LD_A_SET_3_off_IX_IY_d , 0,									"LD   A, SET 3, (IX + %O)" },
-	{ &CZ80Core::LD_B_SET_4_off_IX_IY_d , 0,									"LD   B, SET 4, (IX + %O)" },
-	{ &CZ80Core::LD_C_SET_4_off_IX_IY_d , 0,									"LD   C, SET 4, (IX + %O)" },
-	{ &CZ80Core::LD_D_SET_4_off_IX_IY_d , 0,									"LD   D, SET 4, (IX + %O)" },
-	{ &CZ80Core::LD_E_SET_4_off_IX_IY_d , 0,									"LD   E, SET 4, (IX + %O)" },
-	{ &CZ80Core::LD_H_SET_4_off_IX_IY_d , 0,									"LD   H, SET 4, (IX + %O)" },
-	{ &CZ80Core::LD_L_SET_4_off_IX_IY_d , 0,									"LD   L, SET 4, (IX + %O)" },
-	{ &CZ80Core::SET_4_off_IX_IY_d      , 0,									"SET  4, (IX + %O)" },
-	{ &CZ80Core::LD_A_SET_4_off_IX_IY_d , 0,									"LD   A, SET 4, (IX + %O)" },
-	{ &CZ80Core::LD_B_SET_5_off_IX_IY_d , 0,									"LD   B, SET 5, (IX + %O)" },
-	{ &CZ80Core::LD_C_SET_5_off_IX_IY_d , 0,									"LD   C, SET 5, (IX + %O)" },
-	{ &CZ80Core::LD_D_SET_5_off_IX_IY_d , 0,									"LD   D, SET 5, (IX + %O)" },
-	{ &CZ80Core::LD_E_SET_5_off_IX_IY_d , 0,									"LD   E, SET 5, (IX + %O)" },
-	{ &CZ80Core::LD_H_SET_5_off_IX_IY_d , 0,									"LD   H, SET 5, (IX + %O)" },
-	{ &CZ80Core::LD_L_SET_5_off_IX_IY_d , 0,									"LD   L, SET 5, (IX + %O)" },
-	{ &CZ80Core::SET_5_off_IX_IY_d      , 0,									"SET  5, (IX + %O)" },
-	{ &CZ80Core::LD_A_SET_5_off_IX_IY_d , 0,									"LD   A, SET 5, (IX + %O)" },
-	{ &CZ80Core::LD_B_SET_6_off_IX_IY_d , 0,									"LD   B, SET 6, (IX + %O)" },
-	{ &CZ80Core::LD_C_SET_6_off_IX_IY_d , 0,									"LD   C, SET 6, (IX + %O)" },
-	{ &CZ80Core::LD_D_SET_6_off_IX_IY_d , 0,									"LD   D, SET 6, (IX + %O)" },
-	{ &CZ80Core::LD_E_SET_6_off_IX_IY_d , 0,									"LD   E, SET 6, (IX + %O)" },
-	{ &CZ80Core::LD_H_SET_6_off_IX_IY_d , 0,									"LD   H, SET 6, (IX + %O)" },
-	{ &CZ80Core::LD_L_SET_6_off_IX_IY_d , 0,									"LD   L, SET 6, (IX + %O)" },
-	{ &CZ80Core::SET_6_off_IX_IY_d      , 0,									"SET  6, (IX + %O)" },
-	{ &CZ80Core::LD_A_SET_6_off_IX_IY_d , 0,									"LD   A, SET 6, (IX + %O)" },
-	{ &CZ80Core::LD_B_SET_7_off_IX_IY_d , 0,									"LD   B, SET 7, (IX + %O)" },
-	{ &CZ80Core::LD_C_SET_7_off_IX_IY_d , 0,									"LD   C, SET 7, (IX + %O)" },
-	{ &CZ80Core::LD_D_SET_7_off_IX_IY_d , 0,									"LD   D, SET 7, (IX + %O)" },
-	{ &CZ80Core::LD_E_SET_7_off_IX_IY_d , 0,									"LD   E, SET 7, (IX + %O)" },
-	{ &CZ80Core::LD_H_SET_7_off_IX_IY_d , 0,									"LD   H, SET 7, (IX + %O)" },
-	{ &CZ80Core::LD_L_SET_7_off_IX_IY_d , 0,									"LD   L, SET 7, (IX + %O)" },
-	{ &CZ80Core::SET_7_off_IX_IY_d      , 0,									"SET  7, (IX + %O)" },
-	{ &CZ80Core::LD_A_SET_7_off_IX_IY_d , 0,									"LD   A, SET 7, (IX + %O)" }
+	{ &CZ80CoreT<Bus>::LD_B_RLC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   B, RLC (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_RLC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   C, RLC (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_RLC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   D, RLC (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_RLC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   E, RLC (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_RLC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   H, RLC (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_RLC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   L, RLC (IX + %O)" },
+	{ &CZ80CoreT<Bus>::RLC_off_IX_IY_d        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RLC  (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_RLC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   A, RLC (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_RRC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   B, RRC  (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_RRC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   C, RRC  (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_RRC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   D, RRC  (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_RRC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   E, RRC  (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_RRC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   H, RRC  (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_RRC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   L, RRC  (IX + %O)" },
+	{ &CZ80CoreT<Bus>::RRC_off_IX_IY_d        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RRC  (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_RRC_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   A, RRC  (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_RL_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   B, RL (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_RL_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   C, RL (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_RL_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   D, RL (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_RL_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   E, RL (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_RL_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   H, RL (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_RL_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   L, RL (IX + %O)" },
+	{ &CZ80CoreT<Bus>::RL_off_IX_IY_d         , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RL   (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_RL_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   A, RL (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_RR_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   B, RR (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_RR_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   C, RR (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_RR_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   D, RR (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_RR_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   E, RR (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_RR_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   H, RR (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_RR_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   L, RR (IX + %O)" },
+	{ &CZ80CoreT<Bus>::RR_off_IX_IY_d         , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"RR   (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_RR_off_IX_IY_d    , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   A, RR (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_SLA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   B, SLA (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SLA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   C, SLA (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SLA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   D, SLA (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SLA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   E, SLA (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SLA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   H, SLA (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SLA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   L, SLA (IX + %O)" },
+	{ &CZ80CoreT<Bus>::SLA_off_IX_IY_d        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SLA  (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_SLA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   A, SLA (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_SRA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   B, SRA (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SRA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   C, SRA (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SRA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   D, SRA (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SRA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   E, SRA (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SRA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   H, SRA (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SRA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   L, SRA (IX + %O)" },
+	{ &CZ80CoreT<Bus>::SRA_off_IX_IY_d        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SRA  (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_SRA_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   A, SRA (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_SLL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   B, SLL  (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SLL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   C, SLL  (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SLL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   D, SLL  (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SLL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   E, SLL  (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SLL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   H, SLL  (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SLL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   L, SLL  (IX + %O)" },
+	{ &CZ80CoreT<Bus>::SLL_off_IX_IY_d        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SLL  (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_SLL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   A, SLL  (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_SRL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   B, SRL (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SRL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   C, SRL (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SRL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   D, SRL (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SRL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   E, SRL (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SRL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   H, SRL (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SRL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   L, SRL (IX + %O)" },
+	{ &CZ80CoreT<Bus>::SRL_off_IX_IY_d        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"SRL  (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_SRL_off_IX_IY_d   , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"LD   A,SRL (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_0_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_0_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_0_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_0_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_0_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_0_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_0_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_0_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_1_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_1_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_1_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_1_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_1_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_1_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_1_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_1_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_2_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_2_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_2_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_2_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_2_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_2_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_2_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_2_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_3_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_3_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_3_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_3_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_3_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_3_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_3_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_3_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_4_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_4_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_4_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_4_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_4_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_4_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_4_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_4_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_5_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_5_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_5_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_5_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_5_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_5_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_5_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_5_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_6_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_6_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_6_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_6_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_6_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_6_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_6_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_6_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_7_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_7_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_7_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_7_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_7_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_7_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_7_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::BIT_7_off_IX_IY_d      , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,		"BIT  7, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_RES_0_off_IX_IY_d , 0,									"LD   B, RES  0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_RES_0_off_IX_IY_d , 0,									"LD   C, RES  0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_RES_0_off_IX_IY_d , 0,									"LD   D, RES  0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_RES_0_off_IX_IY_d , 0,									"LD   E, RES  0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_RES_0_off_IX_IY_d , 0,									"LD   H, RES  0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_RES_0_off_IX_IY_d , 0,									"LD   L, RES  0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::RES_0_off_IX_IY_d      , 0,									"RES  0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_RES_0_off_IX_IY_d , 0,									"LD   A, RES 0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_RES_1_off_IX_IY_d , 0,									"LD   B, RES  1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_RES_1_off_IX_IY_d , 0,									"LD   C, RES  1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_RES_1_off_IX_IY_d , 0,									"LD   D, RES  1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_RES_1_off_IX_IY_d , 0,									"LD   E, RES  1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_RES_1_off_IX_IY_d , 0,									"LD   H, RES  1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_RES_1_off_IX_IY_d , 0,									"LD   L, RES  1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::RES_1_off_IX_IY_d      , 0,									"RES  1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_RES_1_off_IX_IY_d , 0,									"LD   A, RES  1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_RES_2_off_IX_IY_d , 0,									"LD   B, RES  2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_RES_2_off_IX_IY_d , 0,									"LD   C, RES  2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_RES_2_off_IX_IY_d , 0,									"LD   D, RES  2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_RES_2_off_IX_IY_d , 0,									"LD   E, RES  2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_RES_2_off_IX_IY_d , 0,									"LD   H, RES  2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_RES_2_off_IX_IY_d , 0,									"LD   L, RES  2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::RES_2_off_IX_IY_d      , 0,									"RES  2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_RES_2_off_IX_IY_d , 0,									"LD   A, RES  2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_RES_3_off_IX_IY_d , 0,									"LD   B, RES  3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_RES_3_off_IX_IY_d , 0,									"LD   C, RES  3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_RES_3_off_IX_IY_d , 0,									"LD   D, RES  3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_RES_3_off_IX_IY_d , 0,									"LD   E, RES  3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_RES_3_off_IX_IY_d , 0,									"LD   H, RES  3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_RES_3_off_IX_IY_d , 0,									"LD   L, RES  3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::RES_3_off_IX_IY_d      , 0,									"RES  3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_RES_3_off_IX_IY_d , 0,									"LD   A, RES  3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_RES_4_off_IX_IY_d , 0,									"LD   B, RES  4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_RES_4_off_IX_IY_d , 0,									"LD   C, RES  4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_RES_4_off_IX_IY_d , 0,									"LD   D, RES  4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_RES_4_off_IX_IY_d , 0,									"LD   E, RES  4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_RES_4_off_IX_IY_d , 0,									"LD   H, RES  4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_RES_4_off_IX_IY_d , 0,									"LD   L, RES  4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::RES_4_off_IX_IY_d      , 0,									"RES  4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_RES_4_off_IX_IY_d , 0,									"LD   A, RES  4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_RES_5_off_IX_IY_d , 0,									"LD   B, RES 5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_RES_5_off_IX_IY_d , 0,									"LD   C, RES 5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_RES_5_off_IX_IY_d , 0,									"LD   D, RES 5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_RES_5_off_IX_IY_d , 0,									"LD   E, RES 5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_RES_5_off_IX_IY_d , 0,									"LD   H, RES 5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_RES_5_off_IX_IY_d , 0,									"LD   L, RES 5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::RES_5_off_IX_IY_d      , 0,									"RES  5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_RES_5_off_IX_IY_d , 0,									"LD   A, RES 5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_RES_6_off_IX_IY_d , 0,									"LD   B, RES 6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_RES_6_off_IX_IY_d , 0,									"LD   C, RES 6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_RES_6_off_IX_IY_d , 0,									"LD   D, RES 6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_RES_6_off_IX_IY_d , 0,									"LD   E, RES 6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_RES_6_off_IX_IY_d , 0,									"LD   H, RES 6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_RES_6_off_IX_IY_d , 0,									"LD   L, RES 6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::RES_6_off_IX_IY_d      , 0,									"RES  6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_RES_6_off_IX_IY_d , 0,									"LD   A, RES 6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_RES_7_off_IX_IY_d , 0,									"LD   B, RES 7, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_RES_7_off_IX_IY_d , 0,									"LD   C, RES 7, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_RES_7_off_IX_IY_d , 0,									"LD   D, RES 7, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_RES_7_off_IX_IY_d , 0,									"LD   E, RES 7, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_RES_7_off_IX_IY_d , 0,									"LD   H, RES 7, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_RES_7_off_IX_IY_d , 0,									"LD   L, RES 7, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::RES_7_off_IX_IY_d      , 0,									"RES  7, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_RES_7_off_IX_IY_d , 0,									"LD   A, RES 7, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_SET_0_off_IX_IY_d , 0,									"LD   B, SET 0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SET_0_off_IX_IY_d , 0,									"LD   C, SET 0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SET_0_off_IX_IY_d , 0,									"LD   D, SET 0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SET_0_off_IX_IY_d , 0,									"LD   E, SET 0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SET_0_off_IX_IY_d , 0,									"LD   H, SET 0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SET_0_off_IX_IY_d , 0,									"LD   L, SET 0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::SET_0_off_IX_IY_d      , 0,									"SET  0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_SET_0_off_IX_IY_d , 0,									"LD   A, SET 0, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_SET_1_off_IX_IY_d , 0,									"LD   B, SET 1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SET_1_off_IX_IY_d , 0,									"LD   C, SET 1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SET_1_off_IX_IY_d , 0,									"LD   D, SET 1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SET_1_off_IX_IY_d , 0,									"LD   E, SET 1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SET_1_off_IX_IY_d , 0,									"LD   H, SET 1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SET_1_off_IX_IY_d , 0,									"LD   L, SET 1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::SET_1_off_IX_IY_d      , 0,									"SET  1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_SET_1_off_IX_IY_d , 0,									"LD   A, SET 1, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_SET_2_off_IX_IY_d , 0,									"LD   B, SET 2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SET_2_off_IX_IY_d , 0,									"LD   C, SET 2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SET_2_off_IX_IY_d , 0,									"LD   D, SET 2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SET_2_off_IX_IY_d , 0,									"LD   E, SET 2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SET_2_off_IX_IY_d , 0,									"LD   H, SET 2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SET_2_off_IX_IY_d , 0,									"LD   L, SET 2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::SET_2_off_IX_IY_d      , 0,									"SET  2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_SET_2_off_IX_IY_d , 0,									"LD   A, SET 2, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_SET_3_off_IX_IY_d , 0,									"LD   B, SET 3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SET_3_off_IX_IY_d , 0,									"LD   C, SET 3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SET_3_off_IX_IY_d , 0,									"LD   D, SET 3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SET_3_off_IX_IY_d , 0,									"LD   E, SET 3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SET_3_off_IX_IY_d , 0,									"LD   H, SET 3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SET_3_off_IX_IY_d , 0,									"LD   L, SET 3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::SET_3_off_IX_IY_d      , 0,									"SET  3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_SET_3_off_IX_IY_d , 0,									"LD   A, SET 3, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_SET_4_off_IX_IY_d , 0,									"LD   B, SET 4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SET_4_off_IX_IY_d , 0,									"LD   C, SET 4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SET_4_off_IX_IY_d , 0,									"LD   D, SET 4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SET_4_off_IX_IY_d , 0,									"LD   E, SET 4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SET_4_off_IX_IY_d , 0,									"LD   H, SET 4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SET_4_off_IX_IY_d , 0,									"LD   L, SET 4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::SET_4_off_IX_IY_d      , 0,									"SET  4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_SET_4_off_IX_IY_d , 0,									"LD   A, SET 4, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_SET_5_off_IX_IY_d , 0,									"LD   B, SET 5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SET_5_off_IX_IY_d , 0,									"LD   C, SET 5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SET_5_off_IX_IY_d , 0,									"LD   D, SET 5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SET_5_off_IX_IY_d , 0,									"LD   E, SET 5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SET_5_off_IX_IY_d , 0,									"LD   H, SET 5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SET_5_off_IX_IY_d , 0,									"LD   L, SET 5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::SET_5_off_IX_IY_d      , 0,									"SET  5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_SET_5_off_IX_IY_d , 0,									"LD   A, SET 5, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_SET_6_off_IX_IY_d , 0,									"LD   B, SET 6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SET_6_off_IX_IY_d , 0,									"LD   C, SET 6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SET_6_off_IX_IY_d , 0,									"LD   D, SET 6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SET_6_off_IX_IY_d , 0,									"LD   E, SET 6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SET_6_off_IX_IY_d , 0,									"LD   H, SET 6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SET_6_off_IX_IY_d , 0,									"LD   L, SET 6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::SET_6_off_IX_IY_d      , 0,									"SET  6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_SET_6_off_IX_IY_d , 0,									"LD   A, SET 6, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_B_SET_7_off_IX_IY_d , 0,									"LD   B, SET 7, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_C_SET_7_off_IX_IY_d , 0,									"LD   C, SET 7, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_D_SET_7_off_IX_IY_d , 0,									"LD   D, SET 7, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_E_SET_7_off_IX_IY_d , 0,									"LD   E, SET 7, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_H_SET_7_off_IX_IY_d , 0,									"LD   H, SET 7, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_L_SET_7_off_IX_IY_d , 0,									"LD   L, SET 7, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::SET_7_off_IX_IY_d      , 0,									"SET  7, (IX + %O)" },
+	{ &CZ80CoreT<Bus>::LD_A_SET_7_off_IX_IY_d , 0,									"LD   A, SET 7, (IX + %O)" }
 }};
 
 
-CZ80Core::Z80OpcodeTable CZ80Core::Main_Opcodes = {
+template <class Bus>
+const typename CZ80CoreT<Bus>::Z80OpcodeTable CZ80CoreT<Bus>::Main_Opcodes = {
 	{
-		{ &CZ80Core::NOP                 , 0,									"NOP"              },
-		{ &CZ80Core::LD_BC_nn            , 0,									"LD   BC, %W"     },
-		{ &CZ80Core::LD_off_BC_A         , 0,									"LD   (BC), A"        },
-		{ &CZ80Core::INC_BC              , 0,									"INC  BC"           },
-		{ &CZ80Core::INC_B               , CZ80Core::OPCODEFLAG_AltersFlags,	"INC  B"            },
-		{ &CZ80Core::DEC_B               , CZ80Core::OPCODEFLAG_AltersFlags,	"DEC  B"            },
-		{ &CZ80Core::LD_B_n              , 0,									"LD   B, %B"      },
-		{ &CZ80Core::RLCA                , CZ80Core::OPCODEFLAG_AltersFlags,	"RLCA"             },
-		{ &CZ80Core::EX_AF_AF_           , 0,									"EX   AF, AF'"        },
-		{ &CZ80Core::ADD_HL_BC           , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  HL, BC"        },
-		{ &CZ80Core::LD_A_off_BC         , 0,									"LD   A, (BC)"        },
-		{ &CZ80Core::DEC_BC              , 0,									"DEC  BC"           },
-		{ &CZ80Core::INC_C               , CZ80Core::OPCODEFLAG_AltersFlags,	"INC  C"            },
-		{ &CZ80Core::DEC_C               , CZ80Core::OPCODEFLAG_AltersFlags,	"DEC  C"            },
-		{ &CZ80Core::LD_C_n              , 0,									"LD   C, %B"      },
-		{ &CZ80Core::RRCA                , CZ80Core::OPCODEFLAG_AltersFlags,	"RRCA"             },
-		{ &CZ80Core::DJNZ_off_PC_e       , 0,									"DJNZ %R"     },
-		{ &CZ80Core::LD_DE_nn            , 0,									"LD   DE, %W"     },
-		{ &CZ80Core::LD_off_DE_A         , 0,									"LD   (DE), A"        },
-		{ &CZ80Core::INC_DE              , 0,									"INC  DE"           },
-		{ &CZ80Core::INC_D               , CZ80Core::OPCODEFLAG_AltersFlags,	"INC  D"            },
-		{ &CZ80Core::DEC_D               , CZ80Core::OPCODEFLAG_AltersFlags,	"DEC  D"            },
-		{ &CZ80Core::LD_D_n              , 0,									"LD   D, %B"      },
-		{ &CZ80Core::RLA                 , CZ80Core::OPCODEFLAG_AltersFlags,	"RLA"             },
-		{ &CZ80Core::JR_off_PC_e         , 0,									"JR   %R"       },
-		{ &CZ80Core::ADD_HL_DE           , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  HL, DE"        },
-		{ &CZ80Core::LD_A_off_DE         , 0,									"LD   A, (DE)"        },
-		{ &CZ80Core::DEC_DE              , 0,									"DEC  DE"           },
-		{ &CZ80Core::INC_E               , CZ80Core::OPCODEFLAG_AltersFlags,	"INC  E"            },
-		{ &CZ80Core::DEC_E               , CZ80Core::OPCODEFLAG_AltersFlags,	"DEC  E"            },
-		{ &CZ80Core::LD_E_n              , 0,									"LD   E, %B"      },
-		{ &CZ80Core::RRA                 , CZ80Core::OPCODEFLAG_AltersFlags,	"RRA"             },
-		{ &CZ80Core::JR_NZ_off_PC_e      , 0,									"JR   NZ, %R"    },
-		{ &CZ80Core::LD_HL_nn            , 0,									"LD   HL, %W"     },
-		{ &CZ80Core::LD_off_nn_HL        , 0,									"LD   (%W), HL"   },
-		{ &CZ80Core::INC_HL              , 0,									"INC  HL"           },
-		{ &CZ80Core::INC_H               , CZ80Core::OPCODEFLAG_AltersFlags,	"INC  H"            },
-		{ &CZ80Core::DEC_H               , CZ80Core::OPCODEFLAG_AltersFlags,	"DEC  H"            },
-		{ &CZ80Core::LD_H_n              , 0,									"LD   H, %B"      },
-		{ &CZ80Core::DAA                 , CZ80Core::OPCODEFLAG_AltersFlags,	"DAA"             },
-		{ &CZ80Core::JR_Z_off_PC_e       , 0,									"JR   Z, %R"     },
-		{ &CZ80Core::ADD_HL_HL           , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  HL,HL"        },
-		{ &CZ80Core::LD_HL_off_nn        , 0,									"LD   HL, (%W)"   },
-		{ &CZ80Core::DEC_HL              , 0,									"DEC  HL"           },
-		{ &CZ80Core::INC_L               , CZ80Core::OPCODEFLAG_AltersFlags,	"INC  L"            },
-		{ &CZ80Core::DEC_L               , CZ80Core::OPCODEFLAG_AltersFlags,	"DEC  L"            },
-		{ &CZ80Core::LD_L_n              , 0,									"LD   L, %B"      },
-		{ &CZ80Core::CPL                 , CZ80Core::OPCODEFLAG_AltersFlags,	"CPL"             },
-		{ &CZ80Core::JR_NC_off_PC_e      , 0,									"JR   NC, %R"    },
-		{ &CZ80Core::LD_SP_nn            , 0,									"LD   SP, %W"     },
-		{ &CZ80Core::LD_off_nn_A         , 0,									"LD   (%W), A"    },
-		{ &CZ80Core::INC_SP              , 0,									"INC  SP"           },
-		{ &CZ80Core::INC_off_HL          , CZ80Core::OPCODEFLAG_AltersFlags,	"INC  (HL)"         },
-		{ &CZ80Core::DEC_off_HL          , CZ80Core::OPCODEFLAG_AltersFlags,	"DEC  (HL)"         },
-		{ &CZ80Core::LD_off_HL_n         , 0,									"LD   (HL), %B"   },
-		{ &CZ80Core::SCF                 , CZ80Core::OPCODEFLAG_AltersFlags,	"SCF"             },
-		{ &CZ80Core::JR_C_off_PC_e       , 0,									"JR   C, %R"     },
-		{ &CZ80Core::ADD_HL_SP           , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  HL, SP"        },
-		{ &CZ80Core::LD_A_off_nn         , 0,									"LD   A, (%W)"    },
-		{ &CZ80Core::DEC_SP              , 0,									"DEC  SP"           },
-		{ &CZ80Core::INC_A               , CZ80Core::OPCODEFLAG_AltersFlags,	"INC  A"            },
-		{ &CZ80Core::DEC_A               , CZ80Core::OPCODEFLAG_AltersFlags,	"DEC  A"            },
-		{ &CZ80Core::LD_A_n              , 0,									"LD   A, %B"      },
-		{ &CZ80Core::CCF                 , CZ80Core::OPCODEFLAG_AltersFlags,	"CCF"             },
-		{ &CZ80Core::LD_B_B              , 0,									"LD   B, B"           },
-		{ &CZ80Core::LD_B_C              , 0,									"LD   B, C"           },
-		{ &CZ80Core::LD_B_D              , 0,									"LD   B, D"           },
-		{ &CZ80Core::LD_B_E              , 0,									"LD   B, E"           },
-		{ &CZ80Core::LD_B_H              , 0,									"LD   B, H"           },
-		{ &CZ80Core::LD_B_L              , 0,									"LD   B, L"           },
-		{ &CZ80Core::LD_B_off_HL         , 0,									"LD   B, (HL)"        },
-		{ &CZ80Core::LD_B_A              , 0,									"LD   B, A"           },
-		{ &CZ80Core::LD_C_B              , 0,									"LD   C, B"           },
-		{ &CZ80Core::LD_C_C              , 0,									"LD   C, C"           },
-		{ &CZ80Core::LD_C_D              , 0,									"LD   C, D"           },
-		{ &CZ80Core::LD_C_E              , 0,									"LD   C, E"           },
-		{ &CZ80Core::LD_C_H              , 0,									"LD   C, H"           },
-		{ &CZ80Core::LD_C_L              , 0,									"LD   C, L"           },
-		{ &CZ80Core::LD_C_off_HL         , 0,									"LD   C, (HL)"        },
-		{ &CZ80Core::LD_C_A              , 0,									"LD   C, A"           },
-		{ &CZ80Core::LD_D_B              , 0,									"LD   D, B"           },
-		{ &CZ80Core::LD_D_C              , 0,									"LD   D, C"           },
-		{ &CZ80Core::LD_D_D              , 0,									"LD   D, D"           },
-		{ &CZ80Core::LD_D_E              , 0,									"LD   D, E"           },
-		{ &CZ80Core::LD_D_H              , 0,									"LD   D, H"           },
-		{ &CZ80Core::LD_D_L              , 0,									"LD   D, L"           },
-		{ &CZ80Core::LD_D_off_HL         , 0,									"LD   D, (HL)"        },
-		{ &CZ80Core::LD_D_A              , 0,									"LD   D, A"           },
-		{ &CZ80Core::LD_E_B              , 0,									"LD   E, B"           },
-		{ &CZ80Core::LD_E_C              , 0,									"LD   E, C"           },
-		{ &CZ80Core::LD_E_D              , 0,									"LD   E, D"           },
-		{ &CZ80Core::LD_E_E              , 0,									"LD   E, E"           },
-		{ &CZ80Core::LD_E_H              , 0,									"LD   E, H"           },
-		{ &CZ80Core::LD_E_L              , 0,									"LD   E, L"           },
-		{ &CZ80Core::LD_E_off_HL         , 0,									"LD   E, (HL)"        },
-		{ &CZ80Core::LD_E_A              , 0,									"LD   E, A"           },
-		{ &CZ80Core::LD_H_B              , 0,									"LD   H, B"           },
-		{ &CZ80Core::LD_H_C              , 0,									"LD   H, C"           },
-		{ &CZ80Core::LD_H_D              , 0,									"LD   H, D"           },
-		{ &CZ80Core::LD_H_E              , 0,									"LD   H, E"           },
-		{ &CZ80Core::LD_H_H              , 0,									"LD   H, H"           },
-		{ &CZ80Core::LD_H_L              , 0,									"LD   H, L"           },
-		{ &CZ80Core::LD_H_off_HL         , 0,									"LD   H, (HL)"        },
-		{ &CZ80Core::LD_H_A              , 0,									"LD   H, A"           },
-		{ &CZ80Core::LD_L_B              , 0,									"LD   L, B"           },
-		{ &CZ80Core::LD_L_C              , 0,									"LD   L, C"           },
-		{ &CZ80Core::LD_L_D              , 0,									"LD   L, D"           },
-		{ &CZ80Core::LD_L_E              , 0,									"LD   L, E"           },
-		{ &CZ80Core::LD_L_H              , 0,									"LD   L, H"           },
-		{ &CZ80Core::LD_L_L              , 0,									"LD   L, L"           },
-		{ &CZ80Core::LD_L_off_HL         , 0,									"LD   L, (HL)"        },
-		{ &CZ80Core::LD_L_A              , 0,									"LD   L, A"           },
-		{ &CZ80Core::LD_off_HL_B         , 0,									"LD   (HL), B"        },
-		{ &CZ80Core::LD_off_HL_C         , 0,									"LD   (HL), C"        },
-		{ &CZ80Core::LD_off_HL_D         , 0,									"LD   (HL), D"        },
-		{ &CZ80Core::LD_off_HL_E         , 0,									"LD   (HL), E"        },
-		{ &CZ80Core::LD_off_HL_H         , 0,									"LD   (HL), H"        },
-		{ &CZ80Core::LD_off_HL_L         , 0,									"LD   (HL), L"        },
-		{ &CZ80Core::HALT                , 0,									"HALT"             },
-		{ &CZ80Core::LD_off_HL_A         , 0,									"LD   (HL), A"        },
-		{ &CZ80Core::LD_A_B              , 0,									"LD   A, B"           },
-		{ &CZ80Core::LD_A_C              , 0,									"LD   A, C"           },
-		{ &CZ80Core::LD_A_D              , 0,									"LD   A, D"           },
-		{ &CZ80Core::LD_A_E              , 0,									"LD   A, E"           },
-		{ &CZ80Core::LD_A_H              , 0,									"LD   A, H"           },
-		{ &CZ80Core::LD_A_L              , 0,									"LD   A, L"           },
-		{ &CZ80Core::LD_A_off_HL         , 0,									"LD   A, (HL)"        },
-		{ &CZ80Core::LD_A_A              , 0,									"LD   A, A"           },
-		{ &CZ80Core::ADD_A_B             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  A, B"          },
-		{ &CZ80Core::ADD_A_C             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  A, C"          },
-		{ &CZ80Core::ADD_A_D             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  A, D"          },
-		{ &CZ80Core::ADD_A_E             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  A, E"          },
-		{ &CZ80Core::ADD_A_H             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  A, H"          },
-		{ &CZ80Core::ADD_A_L             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  A, L"          },
-		{ &CZ80Core::ADD_A_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  A, (HL)"       },
-		{ &CZ80Core::ADD_A_A             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  A, A"          },
-		{ &CZ80Core::ADC_A_B             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADC  A, B"          },
-		{ &CZ80Core::ADC_A_C             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADC  A, C"          },
-		{ &CZ80Core::ADC_A_D             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADC  A, D"          },
-		{ &CZ80Core::ADC_A_E             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADC  A, E"          },
-		{ &CZ80Core::ADC_A_H             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADC  A, H"          },
-		{ &CZ80Core::ADC_A_L             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADC  A, L"          },
-		{ &CZ80Core::ADC_A_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,	"ADC  A, (HL)"       },
-		{ &CZ80Core::ADC_A_A             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADC  A, A"          },
-		{ &CZ80Core::SUB_A_B             , CZ80Core::OPCODEFLAG_AltersFlags,	"SUB  A, B"          },
-		{ &CZ80Core::SUB_A_C             , CZ80Core::OPCODEFLAG_AltersFlags,	"SUB  A, C"          },
-		{ &CZ80Core::SUB_A_D             , CZ80Core::OPCODEFLAG_AltersFlags,	"SUB  A, D"          },
-		{ &CZ80Core::SUB_A_E             , CZ80Core::OPCODEFLAG_AltersFlags,	"SUB  A, E"          },
-		{ &CZ80Core::SUB_A_H             , CZ80Core::OPCODEFLAG_AltersFlags,	"SUB  A, H"          },
-		{ &CZ80Core::SUB_A_L             , CZ80Core::OPCODEFLAG_AltersFlags,	"SUB  A, L"          },
-		{ &CZ80Core::SUB_A_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,	"SUB  A, (HL)"       },
-		{ &CZ80Core::SUB_A_A             , CZ80Core::OPCODEFLAG_AltersFlags,	"SUB  A, A"          },
-		{ &CZ80Core::SBC_A_B             , CZ80Core::OPCODEFLAG_AltersFlags,	"SBC  A, B"          },
-		{ &CZ80Core::SBC_A_C             , CZ80Core::OPCODEFLAG_AltersFlags,	"SBC  A, C"          },
-		{ &CZ80Core::SBC_A_D             , CZ80Core::OPCODEFLAG_AltersFlags,	"SBC  A, D"          },
-		{ &CZ80Core::SBC_A_E             , CZ80Core::OPCODEFLAG_AltersFlags,	"SBC  A, E"          },
-		{ &CZ80Core::SBC_A_H             , CZ80Core::OPCODEFLAG_AltersFlags,	"SBC  A, H"          },
-		{ &CZ80Core::SBC_A_L             , CZ80Core::OPCODEFLAG_AltersFlags,	"SBC  A, L"          },
-		{ &CZ80Core::SBC_A_off_HL        , CZ80Core::OPCODEFLAG_AltersFlags,	"SBC  A, (HL)"       },
-		{ &CZ80Core::SBC_A_A             , CZ80Core::OPCODEFLAG_AltersFlags,	"SBC  A, A"          },
-		{ &CZ80Core::AND_B               , CZ80Core::OPCODEFLAG_AltersFlags,	"AND  B"             },
-		{ &CZ80Core::AND_C               , CZ80Core::OPCODEFLAG_AltersFlags,	"AND  C"             },
-		{ &CZ80Core::AND_D               , CZ80Core::OPCODEFLAG_AltersFlags,	"AND  D"             },
-		{ &CZ80Core::AND_E               , CZ80Core::OPCODEFLAG_AltersFlags,	"AND  E"            },
-		{ &CZ80Core::AND_H               , CZ80Core::OPCODEFLAG_AltersFlags,	"AND  H"            },
-		{ &CZ80Core::AND_L               , CZ80Core::OPCODEFLAG_AltersFlags,	"AND  L"            },
-		{ &CZ80Core::AND_off_HL          , CZ80Core::OPCODEFLAG_AltersFlags,	"AND  (HL)"         },
-		{ &CZ80Core::AND_A               , CZ80Core::OPCODEFLAG_AltersFlags,	"AND  A"            },
-		{ &CZ80Core::XOR_B               , CZ80Core::OPCODEFLAG_AltersFlags,	"XOR  B"            },
-		{ &CZ80Core::XOR_C               , CZ80Core::OPCODEFLAG_AltersFlags,	"XOR  C"            },
-		{ &CZ80Core::XOR_D               , CZ80Core::OPCODEFLAG_AltersFlags,	"XOR  D"            },
-		{ &CZ80Core::XOR_E               , CZ80Core::OPCODEFLAG_AltersFlags,	"XOR  E"            },
-		{ &CZ80Core::XOR_H               , CZ80Core::OPCODEFLAG_AltersFlags,	"XOR  H"            },
-		{ &CZ80Core::XOR_L               , CZ80Core::OPCODEFLAG_AltersFlags,	"XOR  L"            },
-		{ &CZ80Core::XOR_off_HL          , CZ80Core::OPCODEFLAG_AltersFlags,	"XOR  (HL)"         },
-		{ &CZ80Core::XOR_A               , CZ80Core::OPCODEFLAG_AltersFlags,	"XOR  A"            },
-		{ &CZ80Core::OR_B                , CZ80Core::OPCODEFLAG_AltersFlags,	"OR   B"             },
-		{ &CZ80Core::OR_C                , CZ80Core::OPCODEFLAG_AltersFlags,	"OR   C"             },
-		{ &CZ80Core::OR_D                , CZ80Core::OPCODEFLAG_AltersFlags,	"OR   D"             },
-		{ &CZ80Core::OR_E                , CZ80Core::OPCODEFLAG_AltersFlags,	"OR   E"             },
-		{ &CZ80Core::OR_H                , CZ80Core::OPCODEFLAG_AltersFlags,	"OR   H"             },
-		{ &CZ80Core::OR_L                , CZ80Core::OPCODEFLAG_AltersFlags,	"OR   L"             },
-		{ &CZ80Core::OR_off_HL           , CZ80Core::OPCODEFLAG_AltersFlags,	"OR   (HL)"          },
-		{ &CZ80Core::OR_A                , CZ80Core::OPCODEFLAG_AltersFlags,	"OR   A"             },
-		{ &CZ80Core::CP_B                , CZ80Core::OPCODEFLAG_AltersFlags,	"CP   B"             },
-		{ &CZ80Core::CP_C                , CZ80Core::OPCODEFLAG_AltersFlags,	"CP   C"             },
-		{ &CZ80Core::CP_D                , CZ80Core::OPCODEFLAG_AltersFlags,	"CP   D"             },
-		{ &CZ80Core::CP_E                , CZ80Core::OPCODEFLAG_AltersFlags,	"CP   E"             },
-		{ &CZ80Core::CP_H                , CZ80Core::OPCODEFLAG_AltersFlags,	"CP   H"             },
-		{ &CZ80Core::CP_L                , CZ80Core::OPCODEFLAG_AltersFlags,	"CP   L"             },
-		{ &CZ80Core::CP_off_HL           , CZ80Core::OPCODEFLAG_AltersFlags,	"CP   (HL)"          },
-		{ &CZ80Core::CP_A                , CZ80Core::OPCODEFLAG_AltersFlags,	"CP   A"             },
-		{ &CZ80Core::RET_NZ              , 0,									"RET  NZ" },
-		{ &CZ80Core::POP_BC              , 0,									"POP  BC" },
-		{ &CZ80Core::JP_NZ_off_nn        , 0,									"JP   NZ, %W" },
-		{ &CZ80Core::JP_off_nn           , 0,									"JP   %W" },
-		{ &CZ80Core::CALL_NZ_off_nn      , 0,									"CALL NZ, %W" },
-		{ &CZ80Core::PUSH_BC             , 0,									"PUSH BC" },
-		{ &CZ80Core::ADD_A_n             , CZ80Core::OPCODEFLAG_AltersFlags,	"ADD  A, %B"     },
-		{ &CZ80Core::RST_0H              , 0,									"RST  0H" },
-		{ &CZ80Core::RET_Z               , 0,									"RET  Z" },
-		{ &CZ80Core::RET                 , 0,									"RET" },
-		{ &CZ80Core::JP_Z_off_nn         , 0,									"JP   Z, %W" },
+		{ &CZ80CoreT<Bus>::NOP                 , 0,									"NOP"              },
+		{ &CZ80CoreT<Bus>::LD_BC_nn            , 0,									"LD   BC, %W"     },
+		{ &CZ80CoreT<Bus>::LD_off_BC_A         , 0,									"LD   (BC), A"        },
+		{ &CZ80CoreT<Bus>::INC_BC              , 0,									"INC  BC"           },
+		{ &CZ80CoreT<Bus>::INC_B               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"INC  B"            },
+		{ &CZ80CoreT<Bus>::DEC_B               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"DEC  B"            },
+		{ &CZ80CoreT<Bus>::LD_B_n              , 0,									"LD   B, %B"      },
+		{ &CZ80CoreT<Bus>::RLCA                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"RLCA"             },
+		{ &CZ80CoreT<Bus>::EX_AF_AF_           , 0,									"EX   AF, AF'"        },
+		{ &CZ80CoreT<Bus>::ADD_HL_BC           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"ADD  HL, BC"        },
+		{ &CZ80CoreT<Bus>::LD_A_off_BC         , 0,									"LD   A, (BC)"        },
+		{ &CZ80CoreT<Bus>::DEC_BC              , 0,									"DEC  BC"           },
+		{ &CZ80CoreT<Bus>::INC_C               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"INC  C"            },
+		{ &CZ80CoreT<Bus>::DEC_C               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"DEC  C"            },
+		{ &CZ80CoreT<Bus>::LD_C_n              , 0,									"LD   C, %B"      },
+		{ &CZ80CoreT<Bus>::RRCA                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"RRCA"             },
+		{ &CZ80CoreT<Bus>::DJNZ_off_PC_e       , 0,									"DJNZ %R"     },
+		{ &CZ80CoreT<Bus>::LD_DE_nn            , 0,									"LD   DE, %W"     },
+		{ &CZ80CoreT<Bus>::LD_off_DE_A         , 0,									"LD   (DE), A"        },
+		{ &CZ80CoreT<Bus>::INC_DE              , 0,									"INC  DE"           },
+		{ &CZ80CoreT<Bus>::INC_D               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"INC  D"            },
+		{ &CZ80CoreT<Bus>::DEC_D               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"DEC  D"            },
+		{ &CZ80CoreT<Bus>::LD_D_n              , 0,									"LD   D, %B"      },
+		{ &CZ80CoreT<Bus>::RLA                 , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"RLA"             },
+		{ &CZ80CoreT<Bus>::JR_off_PC_e         , 0,									"JR   %R"       },
+		{ &CZ80CoreT<Bus>::ADD_HL_DE           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"ADD  HL, DE"        },
+		{ &CZ80CoreT<Bus>::LD_A_off_DE         , 0,									"LD   A, (DE)"        },
+		{ &CZ80CoreT<Bus>::DEC_DE              , 0,									"DEC  DE"           },
+		{ &CZ80CoreT<Bus>::INC_E               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"INC  E"            },
+		{ &CZ80CoreT<Bus>::DEC_E               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"DEC  E"            },
+		{ &CZ80CoreT<Bus>::LD_E_n              , 0,									"LD   E, %B"      },
+		{ &CZ80CoreT<Bus>::RRA                 , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"RRA"             },
+		{ &CZ80CoreT<Bus>::JR_NZ_off_PC_e      , 0,									"JR   NZ, %R"    },
+		{ &CZ80CoreT<Bus>::LD_HL_nn            , 0,									"LD   HL, %W"     },
+		{ &CZ80CoreT<Bus>::LD_off_nn_HL        , 0,									"LD   (%W), HL"   },
+		{ &CZ80CoreT<Bus>::INC_HL              , 0,									"INC  HL"           },
+		{ &CZ80CoreT<Bus>::INC_H               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"INC  H"            },
+		{ &CZ80CoreT<Bus>::DEC_H               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"DEC  H"            },
+		{ &CZ80CoreT<Bus>::LD_H_n              , 0,									"LD   H, %B"      },
+		{ &CZ80CoreT<Bus>::DAA                 , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"DAA"             },
+		{ &CZ80CoreT<Bus>::JR_Z_off_PC_e       , 0,									"JR   Z, %R"     },
+		{ &CZ80CoreT<Bus>::ADD_HL_HL           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"ADD  HL,HL"        },
+		{ &CZ80CoreT<Bus>::LD_HL_off_nn        , 0,									"LD   HL, (%W)"   },
+		{ &CZ80CoreT<Bus>::DEC_HL              , 0,									"DEC  HL"           },
+		{ &CZ80CoreT<Bus>::INC_L               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"INC  L"            },
+		{ &CZ80CoreT<Bus>::DEC_L               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"DEC  L"            },
+		{ &CZ80CoreT<Bus>::LD_L_n              , 0,									"LD   L, %B"      },
+		{ &CZ80CoreT<Bus>::CPL                 , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"CPL"             },
+		{ &CZ80CoreT<Bus>::JR_NC_off_PC_e      , 0,									"JR   NC, %R"    },
+		{ &CZ80CoreT<Bus>::LD_SP_nn            , 0,									"LD   SP, %W"     },
+		{ &CZ80CoreT<Bus>::LD_off_nn_A         , 0,									"LD   (%W), A"    },
+		{ &CZ80CoreT<Bus>::INC_SP              , 0,									"INC  SP"           },
+		{ &CZ80CoreT<Bus>::INC_off_HL          , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"INC  (HL)"         },
+		{ &CZ80CoreT<Bus>::DEC_off_HL          , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"DEC  (HL)"         },
+		{ &CZ80CoreT<Bus>::LD_off_HL_n         , 0,									"LD   (HL), %B"   },
+		{ &CZ80CoreT<Bus>::SCF                 , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"SCF"             },
+		{ &CZ80CoreT<Bus>::JR_C_off_PC_e       , 0,									"JR   C, %R"     },
+		{ &CZ80CoreT<Bus>::ADD_HL_SP           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"ADD  HL, SP"        },
+		{ &CZ80CoreT<Bus>::LD_A_off_nn         , 0,									"LD   A, (%W)"    },
+		{ &CZ80CoreT<Bus>::DEC_SP              , 0,									"DEC  SP"           },
+		{ &CZ80CoreT<Bus>::INC_A               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"INC  A"            },
+		{ &CZ80CoreT<Bus>::DEC_A               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"DEC  A"            },
+		{ &CZ80CoreT<Bus>::LD_A_n              , 0,									"LD   A, %B"      },
+		{ &CZ80CoreT<Bus>::CCF                 , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"CCF"             },
+		{ &CZ80CoreT<Bus>::LD_B_B              , 0,									"LD   B, B"           },
+		{ &CZ80CoreT<Bus>::LD_B_C              , 0,									"LD   B, C"           },
+		{ &CZ80CoreT<Bus>::LD_B_D              , 0,									"LD   B, D"           },
+		{ &CZ80CoreT<Bus>::LD_B_E              , 0,									"LD   B, E"           },
+		{ &CZ80CoreT<Bus>::LD_B_H              , 0,									"LD   B, H"           },
+		{ &CZ80CoreT<Bus>::LD_B_L              , 0,									"LD   B, L"           },
+		{ &CZ80CoreT<Bus>::LD_B_off_HL         , 0,									"LD   B, (HL)"        },
+		{ &CZ80CoreT<Bus>::LD_B_A              , 0,									"LD   B, A"           },
+		{ &CZ80CoreT<Bus>::LD_C_B              , 0,									"LD   C, B"           },
+		{ &CZ80CoreT<Bus>::LD_C_C              , 0,									"LD   C, C"           },
+		{ &CZ80CoreT<Bus>::LD_C_D              , 0,									"LD   C, D"           },
+		{ &CZ80CoreT<Bus>::LD_C_E              , 0,									"LD   C, E"           },
+		{ &CZ80CoreT<Bus>::LD_C_H              , 0,									"LD   C, H"           },
+		{ &CZ80CoreT<Bus>::LD_C_L              , 0,									"LD   C, L"           },
+		{ &CZ80CoreT<Bus>::LD_C_off_HL         , 0,									"LD   C, (HL)"        },
+		{ &CZ80CoreT<Bus>::LD_C_A              , 0,									"LD   C, A"           },
+		{ &CZ80CoreT<Bus>::LD_D_B              , 0,									"LD   D, B"           },
+		{ &CZ80CoreT<Bus>::LD_D_C              , 0,									"LD   D, C"           },
+		{ &CZ80CoreT<Bus>::LD_D_D              , 0,									"LD   D, D"           },
+		{ &CZ80CoreT<Bus>::LD_D_E              , 0,									"LD   D, E"           },
+		{ &CZ80CoreT<Bus>::LD_D_H              , 0,									"LD   D, H"           },
+		{ &CZ80CoreT<Bus>::LD_D_L              , 0,									"LD   D, L"           },
+		{ &CZ80CoreT<Bus>::LD_D_off_HL         , 0,									"LD   D, (HL)"        },
+		{ &CZ80CoreT<Bus>::LD_D_A              , 0,									"LD   D, A"           },
+		{ &CZ80CoreT<Bus>::LD_E_B              , 0,									"LD   E, B"           },
+		{ &CZ80CoreT<Bus>::LD_E_C              , 0,									"LD   E, C"           },
+		{ &CZ80CoreT<Bus>::LD_E_D              , 0,									"LD   E, D"           },
+		{ &CZ80CoreT<Bus>::LD_E_E              , 0,									"LD   E, E"           },
+		{ &CZ80CoreT<Bus>::LD_E_H              , 0,									"LD   E, H"           },
+		{ &CZ80CoreT<Bus>::LD_E_L              , 0,									"LD   E, L"           },
+		{ &CZ80CoreT<Bus>::LD_E_off_HL         , 0,									"LD   E, (HL)"        },
+		{ &CZ80CoreT<Bus>::LD_E_A              , 0,									"LD   E, A"           },
+		{ &CZ80CoreT<Bus>::LD_H_B              , 0,									"LD   H, B"           },
+		{ &CZ80CoreT<Bus>::LD_H_C              , 0,									"LD   H, C"           },
+		{ &CZ80CoreT<Bus>::LD_H_D              , 0,									"LD   H, D"           },
+		{ &CZ80CoreT<Bus>::LD_H_E              , 0,									"LD   H, E"           },
+		{ &CZ80CoreT<Bus>::LD_H_H              , 0,									"LD   H, H"           },
+		{ &CZ80CoreT<Bus>::LD_H_L              , 0,									"LD   H, L"           },
+		{ &CZ80CoreT<Bus>::LD_H_off_HL         , 0,									"LD   H, (HL)"        },
+		{ &CZ80CoreT<Bus>::LD_H_A              , 0,									"LD   H, A"           },
+		{ &CZ80CoreT<Bus>::LD_L_B              , 0,									"LD   L, B"           },
+		{ &CZ80CoreT<Bus>::LD_L_C              , 0,									"LD   L, C"           },
+		{ &CZ80CoreT<Bus>::LD_L_D              , 0,									"LD   L, D"           },
+		{ &CZ80CoreT<Bus>::LD_L_E              , 0,									"LD   L, E"           },
+		{ &CZ80CoreT<Bus>::LD_L_H              , 0,									"LD   L, H"           },
+		{ &CZ80CoreT<Bus>::LD_L_L              , 0,									"LD   L, L"           },
+		{ &CZ80CoreT<Bus>::LD_L_off_HL         , 0,									"LD   L, (HL)"        },
+		{ &CZ80CoreT<Bus>::LD_L_A              , 0,									"LD   L, A"           },
+		{ &CZ80CoreT<Bus>::LD_off_HL_B         , 0,									"LD   (HL), B"        },
+		{ &CZ80CoreT<Bus>::LD_off_HL_C         , 0,									"LD   (HL), C"        },
+		{ &CZ80CoreT<Bus>::LD_off_HL_D         , 0,									"LD   (HL), D"        },
+		{ &CZ80CoreT<Bus>::LD_off_HL_E         , 0,									"LD   (HL), E"        },
+		{ &CZ80CoreT<Bus>::LD_off_HL_H         , 0,									"LD   (HL), H"        },
+		{ &CZ80CoreT<Bus>::LD_off_HL_L         , 0,									"LD   (HL), L"        },
+		{ &CZ80CoreT<Bus>::HALT                , 0,									"HALT"             },
+		{ &CZ80CoreT<Bus>::LD_off_HL_A         , 0,									"LD   (HL), A"        },
+		{ &CZ80CoreT<Bus>::LD_A_B              , 0,									"LD   A, B"           },
+		{ &CZ80CoreT<Bus>::LD_A_C              , 0,									"LD   A, C"           },
+		{ &CZ80CoreT<Bus>::LD_A_D              , 0,									"LD   A, D"           },
+		{ &CZ80CoreT<Bus>::LD_A_E              , 0,									"LD   A, E"           },
+		{ &CZ80CoreT<Bus>::LD_A_H              , 0,									"LD   A, H"           },
+		{ &CZ80CoreT<Bus>::LD_A_L              , 0,									"LD   A, L"           },
+		{ &CZ80CoreT<Bus>::LD_A_off_HL         , 0,									"LD   A, (HL)"        },
+		{ &CZ80CoreT<Bus>::LD_A_A              , 0,									"LD   A, A"           },
+		{ &CZ80CoreT<Bus>::ADD_A_B             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"ADD  A, B"          },
+		{ &CZ80CoreT<Bus>::ADD_A_C             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"ADD  A, C"          },
+		{ &CZ80CoreT<Bus>::ADD_A_D             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"ADD  A, D"          },
+		{ &CZ80CoreT<Bus>::ADD_A_E             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"ADD  A, E"          },
+		{ &CZ80CoreT<Bus>::ADD_A_H             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"ADD  A, H"          },
+		{ &CZ80CoreT<Bus>::ADD_A_L             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"ADD  A, L"          },
+		{ &CZ80CoreT<Bus>::ADD_A_off_HL        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"ADD  A, (HL)"       },
+		{ &CZ80CoreT<Bus>::ADD_A_A             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"ADD  A, A"          },
+		{ &CZ80CoreT<Bus>::ADC_A_B             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"ADC  A, B"          },
+		{ &CZ80CoreT<Bus>::ADC_A_C             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"ADC  A, C"          },
+		{ &CZ80CoreT<Bus>::ADC_A_D             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"ADC  A, D"          },
+		{ &CZ80CoreT<Bus>::ADC_A_E             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"ADC  A, E"          },
+		{ &CZ80CoreT<Bus>::ADC_A_H             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"ADC  A, H"          },
+		{ &CZ80CoreT<Bus>::ADC_A_L             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"ADC  A, L"          },
+		{ &CZ80CoreT<Bus>::ADC_A_off_HL        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"ADC  A, (HL)"       },
+		{ &CZ80CoreT<Bus>::ADC_A_A             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"ADC  A, A"          },
+		{ &CZ80CoreT<Bus>::SUB_A_B             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"SUB  A, B"          },
+		{ &CZ80CoreT<Bus>::SUB_A_C             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"SUB  A, C"          },
+		{ &CZ80CoreT<Bus>::SUB_A_D             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"SUB  A, D"          },
+		{ &CZ80CoreT<Bus>::SUB_A_E             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"SUB  A, E"          },
+		{ &CZ80CoreT<Bus>::SUB_A_H             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"SUB  A, H"          },
+		{ &CZ80CoreT<Bus>::SUB_A_L             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"SUB  A, L"          },
+		{ &CZ80CoreT<Bus>::SUB_A_off_HL        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"SUB  A, (HL)"       },
+		{ &CZ80CoreT<Bus>::SUB_A_A             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"SUB  A, A"          },
+		{ &CZ80CoreT<Bus>::SBC_A_B             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"SBC  A, B"          },
+		{ &CZ80CoreT<Bus>::SBC_A_C             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"SBC  A, C"          },
+		{ &CZ80CoreT<Bus>::SBC_A_D             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"SBC  A, D"          },
+		{ &CZ80CoreT<Bus>::SBC_A_E             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"SBC  A, E"          },
+		{ &CZ80CoreT<Bus>::SBC_A_H             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"SBC  A, H"          },
+		{ &CZ80CoreT<Bus>::SBC_A_L             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"SBC  A, L"          },
+		{ &CZ80CoreT<Bus>::SBC_A_off_HL        , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"SBC  A, (HL)"       },
+		{ &CZ80CoreT<Bus>::SBC_A_A             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"SBC  A, A"          },
+		{ &CZ80CoreT<Bus>::AND_B               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"AND  B"             },
+		{ &CZ80CoreT<Bus>::AND_C               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"AND  C"             },
+		{ &CZ80CoreT<Bus>::AND_D               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"AND  D"             },
+		{ &CZ80CoreT<Bus>::AND_E               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"AND  E"            },
+		{ &CZ80CoreT<Bus>::AND_H               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"AND  H"            },
+		{ &CZ80CoreT<Bus>::AND_L               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"AND  L"            },
+		{ &CZ80CoreT<Bus>::AND_off_HL          , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"AND  (HL)"         },
+		{ &CZ80CoreT<Bus>::AND_A               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"AND  A"            },
+		{ &CZ80CoreT<Bus>::XOR_B               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"XOR  B"            },
+		{ &CZ80CoreT<Bus>::XOR_C               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"XOR  C"            },
+		{ &CZ80CoreT<Bus>::XOR_D               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"XOR  D"            },
+		{ &CZ80CoreT<Bus>::XOR_E               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"XOR  E"            },
+		{ &CZ80CoreT<Bus>::XOR_H               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"XOR  H"            },
+		{ &CZ80CoreT<Bus>::XOR_L               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"XOR  L"            },
+		{ &CZ80CoreT<Bus>::XOR_off_HL          , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"XOR  (HL)"         },
+		{ &CZ80CoreT<Bus>::XOR_A               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"XOR  A"            },
+		{ &CZ80CoreT<Bus>::OR_B                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"OR   B"             },
+		{ &CZ80CoreT<Bus>::OR_C                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"OR   C"             },
+		{ &CZ80CoreT<Bus>::OR_D                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"OR   D"             },
+		{ &CZ80CoreT<Bus>::OR_E                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"OR   E"             },
+		{ &CZ80CoreT<Bus>::OR_H                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"OR   H"             },
+		{ &CZ80CoreT<Bus>::OR_L                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"OR   L"             },
+		{ &CZ80CoreT<Bus>::OR_off_HL           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"OR   (HL)"          },
+		{ &CZ80CoreT<Bus>::OR_A                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"OR   A"             },
+		{ &CZ80CoreT<Bus>::CP_B                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"CP   B"             },
+		{ &CZ80CoreT<Bus>::CP_C                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"CP   C"             },
+		{ &CZ80CoreT<Bus>::CP_D                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"CP   D"             },
+		{ &CZ80CoreT<Bus>::CP_E                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"CP   E"             },
+		{ &CZ80CoreT<Bus>::CP_H                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"CP   H"             },
+		{ &CZ80CoreT<Bus>::CP_L                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"CP   L"             },
+		{ &CZ80CoreT<Bus>::CP_off_HL           , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"CP   (HL)"          },
+		{ &CZ80CoreT<Bus>::CP_A                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"CP   A"             },
+		{ &CZ80CoreT<Bus>::RET_NZ              , 0,									"RET  NZ" },
+		{ &CZ80CoreT<Bus>::POP_BC              , 0,									"POP  BC" },
+		{ &CZ80CoreT<Bus>::JP_NZ_off_nn        , 0,									"JP   NZ, %W" },
+		{ &CZ80CoreT<Bus>::JP_off_nn           , 0,									"JP   %W" },
+		{ &CZ80CoreT<Bus>::CALL_NZ_off_nn      , 0,									"CALL NZ, %W" },
+		{ &CZ80CoreT<Bus>::PUSH_BC             , 0,									"PUSH BC" },
+		{ &CZ80CoreT<Bus>::ADD_A_n             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"ADD  A, %B"     },
+		{ &CZ80CoreT<Bus>::RST_0H              , 0,									"RST  0H" },
+		{ &CZ80CoreT<Bus>::RET_Z               , 0,									"RET  Z" },
+		{ &CZ80CoreT<Bus>::RET                 , 0,									"RET" },
+		{ &CZ80CoreT<Bus>::JP_Z_off_nn         , 0,									"JP   Z, %W" },
         { nullptr							 , 0,									nullptr },
-		{ &CZ80Core::CALL_Z_off_nn       , 0,									"CALL Z, %W" },
-		{ &CZ80Core::CALL_off_nn         , 0,									"CALL %W" },
-		{ &CZ80Core::ADC_A_n             , 0,									"ADC  A, %B" },
-		{ &CZ80Core::RST_8H              , 0,									"RST  8H" },
-		{ &CZ80Core::RET_NC              , 0,									"RET  NC" },
-		{ &CZ80Core::POP_DE              , 0,									"POP  DE" },
-		{ &CZ80Core::JP_NC_off_nn        , 0,									"JP   NC, %W" },
-		{ &CZ80Core::OUT_off_n_A         , 0,									"OUT (%B), A" },
-		{ &CZ80Core::CALL_NC_off_nn      , 0,									"CALL NC, %W" },
-		{ &CZ80Core::PUSH_DE             , 0,									"PUSH DE" },
-		{ &CZ80Core::SUB_A_n             , CZ80Core::OPCODEFLAG_AltersFlags,	"SUB  A, %B"     },
-		{ &CZ80Core::RST_10H             , 0,									"RST  10H" },
-		{ &CZ80Core::RET_C               , 0,									"RET  C" },
-		{ &CZ80Core::EXX                 , 0,									"EXX" },
-		{ &CZ80Core::JP_C_off_nn         , 0,									"JP   C, %W" },
-		{ &CZ80Core::IN_A_off_n          , 0,									"IN   A, (%B)" },
-		{ &CZ80Core::CALL_C_off_nn       , 0,									"CALL C, %W" },
+		{ &CZ80CoreT<Bus>::CALL_Z_off_nn       , 0,									"CALL Z, %W" },
+		{ &CZ80CoreT<Bus>::CALL_off_nn         , 0,									"CALL %W" },
+		{ &CZ80CoreT<Bus>::ADC_A_n             , 0,									"ADC  A, %B" },
+		{ &CZ80CoreT<Bus>::RST_8H              , 0,									"RST  8H" },
+		{ &CZ80CoreT<Bus>::RET_NC              , 0,									"RET  NC" },
+		{ &CZ80CoreT<Bus>::POP_DE              , 0,									"POP  DE" },
+		{ &CZ80CoreT<Bus>::JP_NC_off_nn        , 0,									"JP   NC, %W" },
+		{ &CZ80CoreT<Bus>::OUT_off_n_A         , 0,									"OUT (%B), A" },
+		{ &CZ80CoreT<Bus>::CALL_NC_off_nn      , 0,									"CALL NC, %W" },
+		{ &CZ80CoreT<Bus>::PUSH_DE             , 0,									"PUSH DE" },
+		{ &CZ80CoreT<Bus>::SUB_A_n             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"SUB  A, %B"     },
+		{ &CZ80CoreT<Bus>::RST_10H             , 0,									"RST  10H" },
+		{ &CZ80CoreT<Bus>::RET_C               , 0,									"RET  C" },
+		{ &CZ80CoreT<Bus>::EXX                 , 0,									"EXX" },
+		{ &CZ80CoreT<Bus>::JP_C_off_nn         , 0,									"JP   C, %W" },
+		{ &CZ80CoreT<Bus>::IN_A_off_n          , 0,									"IN   A, (%B)" },
+		{ &CZ80CoreT<Bus>::CALL_C_off_nn       , 0,									"CALL C, %W" },
         { nullptr							 , 0,									nullptr },
-		{ &CZ80Core::SBC_A_n             , CZ80Core::OPCODEFLAG_AltersFlags,	"SBC  A, %B"     },
-		{ &CZ80Core::RST_18H             , 0,									"RST  18H" },
-		{ &CZ80Core::RET_PO              , 0,									"RET  PO" },
-		{ &CZ80Core::POP_HL              , 0,									"POP  HL" },
-		{ &CZ80Core::JP_PO_off_nn        , 0,									"JP   PO, %W" },
-		{ &CZ80Core::EX_off_SP_HL        , 0,									"EX   (SP), HL" },
-		{ &CZ80Core::CALL_PO_off_nn      , 0,									"CALL PO, %W" },
-		{ &CZ80Core::PUSH_HL             , 0,									"PUSH HL" },
-		{ &CZ80Core::AND_n               , CZ80Core::OPCODEFLAG_AltersFlags,	"AND  %B"       },
-		{ &CZ80Core::RST_20H             , 0,									"RST  20H"          },
-		{ &CZ80Core::RET_PE              , 0,									"RET  PE"           },
-		{ &CZ80Core::JP_off_HL           , 0,									"JP   (HL)"          },
-		{ &CZ80Core::JP_PE_off_nn        , 0,									"JP   PE, %W"   },
-		{ &CZ80Core::EX_DE_HL            , 0,									"EX   DE, HL"         },
-		{ &CZ80Core::CALL_PE_off_nn      , 0,									"CALL PE, %W" },
+		{ &CZ80CoreT<Bus>::SBC_A_n             , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"SBC  A, %B"     },
+		{ &CZ80CoreT<Bus>::RST_18H             , 0,									"RST  18H" },
+		{ &CZ80CoreT<Bus>::RET_PO              , 0,									"RET  PO" },
+		{ &CZ80CoreT<Bus>::POP_HL              , 0,									"POP  HL" },
+		{ &CZ80CoreT<Bus>::JP_PO_off_nn        , 0,									"JP   PO, %W" },
+		{ &CZ80CoreT<Bus>::EX_off_SP_HL        , 0,									"EX   (SP), HL" },
+		{ &CZ80CoreT<Bus>::CALL_PO_off_nn      , 0,									"CALL PO, %W" },
+		{ &CZ80CoreT<Bus>::PUSH_HL             , 0,									"PUSH HL" },
+		{ &CZ80CoreT<Bus>::AND_n               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"AND  %B"       },
+		{ &CZ80CoreT<Bus>::RST_20H             , 0,									"RST  20H"          },
+		{ &CZ80CoreT<Bus>::RET_PE              , 0,									"RET  PE"           },
+		{ &CZ80CoreT<Bus>::JP_off_HL           , 0,									"JP   (HL)"          },
+		{ &CZ80CoreT<Bus>::JP_PE_off_nn        , 0,									"JP   PE, %W"   },
+		{ &CZ80CoreT<Bus>::EX_DE_HL            , 0,									"EX   DE, HL"         },
+		{ &CZ80CoreT<Bus>::CALL_PE_off_nn      , 0,									"CALL PE, %W" },
         { nullptr							 , 0,									nullptr               },
-		{ &CZ80Core::XOR_n               , CZ80Core::OPCODEFLAG_AltersFlags,	"XOR  %B"       },
-		{ &CZ80Core::RST_28H             , 0,									"RST  28H" },
-		{ &CZ80Core::RET_P               , 0,									"RET  P" },
-		{ &CZ80Core::POP_AF              , 0,									"POP  AF" },
-		{ &CZ80Core::JP_P_off_nn         , 0,									"JP   P, %W" },
-		{ &CZ80Core::DI                  , 0,									"DI" },
-		{ &CZ80Core::CALL_P_off_nn       , 0,									"CALL P, %W" },
-		{ &CZ80Core::PUSH_AF             , 0,									"PUSH AF" },
-		{ &CZ80Core::OR_n                , CZ80Core::OPCODEFLAG_AltersFlags,	"OR   %B"        },
-		{ &CZ80Core::RST_30H             , 0,									"RST  30H" },
-		{ &CZ80Core::RET_M               , 0,									"RET  M" },
-		{ &CZ80Core::LD_SP_HL            , 0,									"LD   SP, HL" },
-		{ &CZ80Core::JP_M_off_nn         , 0,									"JP   M, %W" },
-		{ &CZ80Core::EI                  , 0,									"EI" },
-		{ &CZ80Core::CALL_M_off_nn       , 0,									"CALL M, %W" },
+		{ &CZ80CoreT<Bus>::XOR_n               , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"XOR  %B"       },
+		{ &CZ80CoreT<Bus>::RST_28H             , 0,									"RST  28H" },
+		{ &CZ80CoreT<Bus>::RET_P               , 0,									"RET  P" },
+		{ &CZ80CoreT<Bus>::POP_AF              , 0,									"POP  AF" },
+		{ &CZ80CoreT<Bus>::JP_P_off_nn         , 0,									"JP   P, %W" },
+		{ &CZ80CoreT<Bus>::DI                  , 0,									"DI" },
+		{ &CZ80CoreT<Bus>::CALL_P_off_nn       , 0,									"CALL P, %W" },
+		{ &CZ80CoreT<Bus>::PUSH_AF             , 0,									"PUSH AF" },
+		{ &CZ80CoreT<Bus>::OR_n                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"OR   %B"        },
+		{ &CZ80CoreT<Bus>::RST_30H             , 0,									"RST  30H" },
+		{ &CZ80CoreT<Bus>::RET_M               , 0,									"RET  M" },
+		{ &CZ80CoreT<Bus>::LD_SP_HL            , 0,									"LD   SP, HL" },
+		{ &CZ80CoreT<Bus>::JP_M_off_nn         , 0,									"JP   M, %W" },
+		{ &CZ80CoreT<Bus>::EI                  , 0,									"EI" },
+		{ &CZ80CoreT<Bus>::CALL_M_off_nn       , 0,									"CALL M, %W" },
         { nullptr							 , 0,									nullptr },
-		{ &CZ80Core::CP_n                , CZ80Core::OPCODEFLAG_AltersFlags,	"CP   %B"        },
-		{ &CZ80Core::RST_38H             , 0,									"RST  38H"          }
+		{ &CZ80CoreT<Bus>::CP_n                , CZ80CoreT<Bus>::OPCODEFLAG_AltersFlags,	"CP   %B"        },
+		{ &CZ80CoreT<Bus>::RST_38H             , 0,									"RST  38H"          }
 	}
 };
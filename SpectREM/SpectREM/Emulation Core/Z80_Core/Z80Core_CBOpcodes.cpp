@@ -2,49 +2,56 @@
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RLC_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RLC_B(uint8_t)
 {
     RLC(m_CPURegisters.regs.regB);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RLC_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RLC_C(uint8_t)
 {
     RLC(m_CPURegisters.regs.regC);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RLC_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RLC_D(uint8_t)
 {
     RLC(m_CPURegisters.regs.regD);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RLC_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RLC_E(uint8_t)
 {
     RLC(m_CPURegisters.regs.regE);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RLC_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RLC_H(uint8_t)
 {
     RLC(m_CPURegisters.regs.regH);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RLC_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RLC_L(uint8_t)
 {
     RLC(m_CPURegisters.regs.regL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RLC_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RLC_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -54,56 +61,64 @@ void CZ80Core::RLC_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RLC_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RLC_A(uint8_t)
 {
     RLC(m_CPURegisters.regs.regA);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RRC_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RRC_B(uint8_t)
 {
     RRC(m_CPURegisters.regs.regB);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RRC_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RRC_C(uint8_t)
 {
     RRC(m_CPURegisters.regs.regC);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RRC_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RRC_D(uint8_t)
 {
     RRC(m_CPURegisters.regs.regD);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RRC_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RRC_E(uint8_t)
 {
     RRC(m_CPURegisters.regs.regE);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RRC_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RRC_H(uint8_t)
 {
     RRC(m_CPURegisters.regs.regH);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RRC_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RRC_L(uint8_t)
 {
     RRC(m_CPURegisters.regs.regL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RRC_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RRC_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -113,56 +128,64 @@ void CZ80Core::RRC_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RRC_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RRC_A(uint8_t)
 {
     RRC(m_CPURegisters.regs.regA);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RL_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RL_B(uint8_t)
 {
     RL(m_CPURegisters.regs.regB);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RL_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RL_C(uint8_t)
 {
     RL(m_CPURegisters.regs.regC);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RL_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RL_D(uint8_t)
 {
     RL(m_CPURegisters.regs.regD);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RL_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RL_E(uint8_t)
 {
     RL(m_CPURegisters.regs.regE);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RL_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RL_H(uint8_t)
 {
     RL(m_CPURegisters.regs.regH);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RL_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RL_L(uint8_t)
 {
     RL(m_CPURegisters.regs.regL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RL_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RL_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -172,56 +195,64 @@ void CZ80Core::RL_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RL_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RL_A(uint8_t)
 {
     RL(m_CPURegisters.regs.regA);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RR_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RR_B(uint8_t)
 {
     RR(m_CPURegisters.regs.regB);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RR_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RR_C(uint8_t)
 {
     RR(m_CPURegisters.regs.regC);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RR_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RR_D(uint8_t)
 {
     RR(m_CPURegisters.regs.regD);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RR_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RR_E(uint8_t)
 {
     RR(m_CPURegisters.regs.regE);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RR_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RR_H(uint8_t)
 {
     RR(m_CPURegisters.regs.regH);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RR_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RR_L(uint8_t)
 {
     RR(m_CPURegisters.regs.regL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RR_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RR_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -231,56 +262,64 @@ void CZ80Core::RR_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RR_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RR_A(uint8_t)
 {
     RR(m_CPURegisters.regs.regA);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SLA_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SLA_B(uint8_t)
 {
     SLA(m_CPURegisters.regs.regB);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SLA_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SLA_C(uint8_t)
 {
     SLA(m_CPURegisters.regs.regC);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SLA_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SLA_D(uint8_t)
 {
     SLA(m_CPURegisters.regs.regD);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SLA_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SLA_E(uint8_t)
 {
     SLA(m_CPURegisters.regs.regE);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SLA_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SLA_H(uint8_t)
 {
     SLA(m_CPURegisters.regs.regH);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SLA_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SLA_L(uint8_t)
 {
     SLA(m_CPURegisters.regs.regL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SLA_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SLA_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -290,56 +329,64 @@ void CZ80Core::SLA_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SLA_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SLA_A(uint8_t)
 {
     SLA(m_CPURegisters.regs.regA);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SRA_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SRA_B(uint8_t)
 {
     SRA(m_CPURegisters.regs.regB);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SRA_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SRA_C(uint8_t)
 {
     SRA(m_CPURegisters.regs.regC);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SRA_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SRA_D(uint8_t)
 {
     SRA(m_CPURegisters.regs.regD);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SRA_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SRA_E(uint8_t)
 {
     SRA(m_CPURegisters.regs.regE);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SRA_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SRA_H(uint8_t)
 {
     SRA(m_CPURegisters.regs.regH);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SRA_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SRA_L(uint8_t)
 {
     SRA(m_CPURegisters.regs.regL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SRA_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SRA_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -349,56 +396,64 @@ void CZ80Core::SRA_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SRA_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SRA_A(uint8_t)
 {
     SRA(m_CPURegisters.regs.regA);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SLL_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SLL_B(uint8_t)
 {
     SLL(m_CPURegisters.regs.regB);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SLL_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SLL_C(uint8_t)
 {
     SLL(m_CPURegisters.regs.regC);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SLL_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SLL_D(uint8_t)
 {
     SLL(m_CPURegisters.regs.regD);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SLL_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SLL_E(uint8_t)
 {
     SLL(m_CPURegisters.regs.regE);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SLL_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SLL_H(uint8_t)
 {
     SLL(m_CPURegisters.regs.regH);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SLL_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SLL_L(uint8_t)
 {
     SLL(m_CPURegisters.regs.regL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SLL_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SLL_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -408,56 +463,64 @@ void CZ80Core::SLL_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SLL_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SLL_A(uint8_t)
 {
     SLL(m_CPURegisters.regs.regA);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SRL_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SRL_B(uint8_t)
 {
     SRL(m_CPURegisters.regs.regB);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SRL_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SRL_C(uint8_t)
 {
     SRL(m_CPURegisters.regs.regC);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SRL_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SRL_D(uint8_t)
 {
     SRL(m_CPURegisters.regs.regD);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SRL_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SRL_E(uint8_t)
 {
     SRL(m_CPURegisters.regs.regE);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SRL_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SRL_H(uint8_t)
 {
     SRL(m_CPURegisters.regs.regH);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SRL_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SRL_L(uint8_t)
 {
     SRL(m_CPURegisters.regs.regL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SRL_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SRL_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -467,56 +530,64 @@ void CZ80Core::SRL_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SRL_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SRL_A(uint8_t)
 {
     SRL(m_CPURegisters.regs.regA);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_0_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_0_B(uint8_t)
 {
     Bit(m_CPURegisters.regs.regB, 0);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_0_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_0_C(uint8_t)
 {
     Bit(m_CPURegisters.regs.regC, 0);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_0_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_0_D(uint8_t)
 {
     Bit(m_CPURegisters.regs.regD, 0);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_0_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_0_E(uint8_t)
 {
     Bit(m_CPURegisters.regs.regE, 0);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_0_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_0_H(uint8_t)
 {
     Bit(m_CPURegisters.regs.regH, 0);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_0_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_0_L(uint8_t)
 {
     Bit(m_CPURegisters.regs.regL, 0);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_0_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_0_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -525,56 +596,64 @@ void CZ80Core::BIT_0_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_0_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_0_A(uint8_t)
 {
     Bit(m_CPURegisters.regs.regA, 0);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_1_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_1_B(uint8_t)
 {
     Bit(m_CPURegisters.regs.regB, 1);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_1_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_1_C(uint8_t)
 {
     Bit(m_CPURegisters.regs.regC, 1);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_1_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_1_D(uint8_t)
 {
     Bit(m_CPURegisters.regs.regD, 1);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_1_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_1_E(uint8_t)
 {
     Bit(m_CPURegisters.regs.regE, 1);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_1_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_1_H(uint8_t)
 {
     Bit(m_CPURegisters.regs.regH, 1);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_1_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_1_L(uint8_t)
 {
     Bit(m_CPURegisters.regs.regL, 1);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_1_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_1_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -583,56 +662,64 @@ void CZ80Core::BIT_1_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_1_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_1_A(uint8_t)
 {
     Bit(m_CPURegisters.regs.regA, 1);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_2_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_2_B(uint8_t)
 {
     Bit(m_CPURegisters.regs.regB, 2);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_2_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_2_C(uint8_t)
 {
     Bit(m_CPURegisters.regs.regC, 2);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_2_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_2_D(uint8_t)
 {
     Bit(m_CPURegisters.regs.regD, 2);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_2_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_2_E(uint8_t)
 {
     Bit(m_CPURegisters.regs.regE, 2);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_2_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_2_H(uint8_t)
 {
     Bit(m_CPURegisters.regs.regH, 2);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_2_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_2_L(uint8_t)
 {
     Bit(m_CPURegisters.regs.regL, 2);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_2_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_2_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -641,56 +728,64 @@ void CZ80Core::BIT_2_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_2_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_2_A(uint8_t)
 {
     Bit(m_CPURegisters.regs.regA, 2);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_3_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_3_B(uint8_t)
 {
     Bit(m_CPURegisters.regs.regB, 3);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_3_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_3_C(uint8_t)
 {
     Bit(m_CPURegisters.regs.regC, 3);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_3_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_3_D(uint8_t)
 {
     Bit(m_CPURegisters.regs.regD, 3);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_3_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_3_E(uint8_t)
 {
     Bit(m_CPURegisters.regs.regE, 3);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_3_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_3_H(uint8_t)
 {
     Bit(m_CPURegisters.regs.regH, 3);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_3_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_3_L(uint8_t)
 {
     Bit(m_CPURegisters.regs.regL, 3);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_3_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_3_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -699,56 +794,64 @@ void CZ80Core::BIT_3_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_3_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_3_A(uint8_t)
 {
     Bit(m_CPURegisters.regs.regA, 3);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_4_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_4_B(uint8_t)
 {
     Bit(m_CPURegisters.regs.regB, 4);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_4_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_4_C(uint8_t)
 {
     Bit(m_CPURegisters.regs.regC, 4);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_4_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_4_D(uint8_t)
 {
     Bit(m_CPURegisters.regs.regD, 4);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_4_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_4_E(uint8_t)
 {
     Bit(m_CPURegisters.regs.regE, 4);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_4_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_4_H(uint8_t)
 {
     Bit(m_CPURegisters.regs.regH, 4);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_4_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_4_L(uint8_t)
 {
     Bit(m_CPURegisters.regs.regL, 4);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_4_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_4_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -757,56 +860,64 @@ void CZ80Core::BIT_4_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_4_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_4_A(uint8_t)
 {
     Bit(m_CPURegisters.regs.regA, 4);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_5_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_5_B(uint8_t)
 {
     Bit(m_CPURegisters.regs.regB, 5);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_5_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_5_C(uint8_t)
 {
     Bit(m_CPURegisters.regs.regC, 5);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_5_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_5_D(uint8_t)
 {
     Bit(m_CPURegisters.regs.regD, 5);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_5_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_5_E(uint8_t)
 {
     Bit(m_CPURegisters.regs.regE, 5);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_5_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_5_H(uint8_t)
 {
     Bit(m_CPURegisters.regs.regH, 5);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_5_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_5_L(uint8_t)
 {
     Bit(m_CPURegisters.regs.regL, 5);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_5_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_5_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -815,56 +926,64 @@ void CZ80Core::BIT_5_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_5_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_5_A(uint8_t)
 {
     Bit(m_CPURegisters.regs.regA, 5);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_6_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_6_B(uint8_t)
 {
     Bit(m_CPURegisters.regs.regB, 6);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_6_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_6_C(uint8_t)
 {
     Bit(m_CPURegisters.regs.regC, 6);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_6_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_6_D(uint8_t)
 {
     Bit(m_CPURegisters.regs.regD, 6);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_6_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_6_E(uint8_t)
 {
     Bit(m_CPURegisters.regs.regE, 6);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_6_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_6_H(uint8_t)
 {
     Bit(m_CPURegisters.regs.regH, 6);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_6_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_6_L(uint8_t)
 {
     Bit(m_CPURegisters.regs.regL, 6);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_6_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_6_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -873,56 +992,64 @@ void CZ80Core::BIT_6_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_6_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_6_A(uint8_t)
 {
     Bit(m_CPURegisters.regs.regA, 6);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_7_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_7_B(uint8_t)
 {
     Bit(m_CPURegisters.regs.regB, 7);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_7_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_7_C(uint8_t)
 {
     Bit(m_CPURegisters.regs.regC, 7);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_7_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_7_D(uint8_t)
 {
     Bit(m_CPURegisters.regs.regD, 7);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_7_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_7_E(uint8_t)
 {
     Bit(m_CPURegisters.regs.regE, 7);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_7_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_7_H(uint8_t)
 {
     Bit(m_CPURegisters.regs.regH, 7);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_7_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_7_L(uint8_t)
 {
     Bit(m_CPURegisters.regs.regL, 7);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_7_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_7_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -931,56 +1058,64 @@ void CZ80Core::BIT_7_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_7_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_7_A(uint8_t)
 {
     Bit(m_CPURegisters.regs.regA, 7);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_0_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_0_B(uint8_t)
 {
     Res(m_CPURegisters.regs.regB, 0);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_0_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_0_C(uint8_t)
 {
     Res(m_CPURegisters.regs.regC, 0);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_0_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_0_D(uint8_t)
 {
     Res(m_CPURegisters.regs.regD, 0);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_0_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_0_E(uint8_t)
 {
     Res(m_CPURegisters.regs.regE, 0);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_0_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_0_H(uint8_t)
 {
     Res(m_CPURegisters.regs.regH, 0);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_0_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_0_L(uint8_t)
 {
     Res(m_CPURegisters.regs.regL, 0);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_0_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_0_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -990,56 +1125,64 @@ void CZ80Core::RES_0_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_0_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_0_A(uint8_t)
 {
     Res(m_CPURegisters.regs.regA, 0);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_1_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_1_B(uint8_t)
 {
     Res(m_CPURegisters.regs.regB, 1);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_1_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_1_C(uint8_t)
 {
     Res(m_CPURegisters.regs.regC, 1);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_1_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_1_D(uint8_t)
 {
     Res(m_CPURegisters.regs.regD, 1);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_1_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_1_E(uint8_t)
 {
     Res(m_CPURegisters.regs.regE, 1);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_1_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_1_H(uint8_t)
 {
     Res(m_CPURegisters.regs.regH, 1);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_1_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_1_L(uint8_t)
 {
     Res(m_CPURegisters.regs.regL, 1);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_1_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_1_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -1049,56 +1192,64 @@ void CZ80Core::RES_1_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_1_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_1_A(uint8_t)
 {
     Res(m_CPURegisters.regs.regA, 1);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_2_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_2_B(uint8_t)
 {
     Res(m_CPURegisters.regs.regB, 2);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_2_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_2_C(uint8_t)
 {
     Res(m_CPURegisters.regs.regC, 2);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_2_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_2_D(uint8_t)
 {
     Res(m_CPURegisters.regs.regD, 2);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_2_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_2_E(uint8_t)
 {
     Res(m_CPURegisters.regs.regE, 2);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_2_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_2_H(uint8_t)
 {
     Res(m_CPURegisters.regs.regH, 2);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_2_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_2_L(uint8_t)
 {
     Res(m_CPURegisters.regs.regL, 2);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_2_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_2_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -1108,56 +1259,64 @@ void CZ80Core::RES_2_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_2_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_2_A(uint8_t)
 {
     Res(m_CPURegisters.regs.regA, 2);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_3_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_3_B(uint8_t)
 {
     Res(m_CPURegisters.regs.regB, 3);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_3_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_3_C(uint8_t)
 {
     Res(m_CPURegisters.regs.regC, 3);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_3_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_3_D(uint8_t)
 {
     Res(m_CPURegisters.regs.regD, 3);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_3_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_3_E(uint8_t)
 {
     Res(m_CPURegisters.regs.regE, 3);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_3_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_3_H(uint8_t)
 {
     Res(m_CPURegisters.regs.regH, 3);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_3_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_3_L(uint8_t)
 {
     Res(m_CPURegisters.regs.regL, 3);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_3_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_3_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -1167,56 +1326,64 @@ void CZ80Core::RES_3_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_3_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_3_A(uint8_t)
 {
     Res(m_CPURegisters.regs.regA, 3);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_4_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_4_B(uint8_t)
 {
     Res(m_CPURegisters.regs.regB, 4);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_4_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_4_C(uint8_t)
 {
     Res(m_CPURegisters.regs.regC, 4);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_4_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_4_D(uint8_t)
 {
     Res(m_CPURegisters.regs.regD, 4);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_4_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_4_E(uint8_t)
 {
     Res(m_CPURegisters.regs.regE, 4);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_4_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_4_H(uint8_t)
 {
     Res(m_CPURegisters.regs.regH, 4);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_4_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_4_L(uint8_t)
 {
     Res(m_CPURegisters.regs.regL, 4);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_4_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_4_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -1226,56 +1393,64 @@ void CZ80Core::RES_4_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_4_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_4_A(uint8_t)
 {
     Res(m_CPURegisters.regs.regA, 4);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_5_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_5_B(uint8_t)
 {
     Res(m_CPURegisters.regs.regB, 5);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_5_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_5_C(uint8_t)
 {
     Res(m_CPURegisters.regs.regC, 5);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_5_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_5_D(uint8_t)
 {
     Res(m_CPURegisters.regs.regD, 5);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_5_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_5_E(uint8_t)
 {
     Res(m_CPURegisters.regs.regE, 5);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_5_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_5_H(uint8_t)
 {
     Res(m_CPURegisters.regs.regH, 5);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_5_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_5_L(uint8_t)
 {
     Res(m_CPURegisters.regs.regL, 5);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_5_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_5_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -1285,56 +1460,64 @@ void CZ80Core::RES_5_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_5_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_5_A(uint8_t)
 {
     Res(m_CPURegisters.regs.regA, 5);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_6_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_6_B(uint8_t)
 {
     Res(m_CPURegisters.regs.regB, 6);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_6_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_6_C(uint8_t)
 {
     Res(m_CPURegisters.regs.regC, 6);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_6_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_6_D(uint8_t)
 {
     Res(m_CPURegisters.regs.regD, 6);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_6_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_6_E(uint8_t)
 {
     Res(m_CPURegisters.regs.regE, 6);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_6_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_6_H(uint8_t)
 {
     Res(m_CPURegisters.regs.regH, 6);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_6_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_6_L(uint8_t)
 {
     Res(m_CPURegisters.regs.regL, 6);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_6_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_6_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -1344,56 +1527,64 @@ void CZ80Core::RES_6_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_6_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_6_A(uint8_t)
 {
     Res(m_CPURegisters.regs.regA, 6);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_7_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_7_B(uint8_t)
 {
     Res(m_CPURegisters.regs.regB, 7);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_7_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_7_C(uint8_t)
 {
     Res(m_CPURegisters.regs.regC, 7);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_7_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_7_D(uint8_t)
 {
     Res(m_CPURegisters.regs.regD, 7);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_7_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_7_E(uint8_t)
 {
     Res(m_CPURegisters.regs.regE, 7);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_7_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_7_H(uint8_t)
 {
     Res(m_CPURegisters.regs.regH, 7);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_7_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_7_L(uint8_t)
 {
     Res(m_CPURegisters.regs.regL, 7);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_7_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_7_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -1403,56 +1594,64 @@ void CZ80Core::RES_7_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_7_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_7_A(uint8_t)
 {
     Res(m_CPURegisters.regs.regA, 7);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_0_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_0_B(uint8_t)
 {
     Set(m_CPURegisters.regs.regB, 0);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_0_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_0_C(uint8_t)
 {
     Set(m_CPURegisters.regs.regC, 0);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_0_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_0_D(uint8_t)
 {
     Set(m_CPURegisters.regs.regD, 0);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_0_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_0_E(uint8_t)
 {
     Set(m_CPURegisters.regs.regE, 0);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_0_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_0_H(uint8_t)
 {
     Set(m_CPURegisters.regs.regH, 0);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_0_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_0_L(uint8_t)
 {
     Set(m_CPURegisters.regs.regL, 0);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_0_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_0_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -1462,56 +1661,64 @@ void CZ80Core::SET_0_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_0_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_0_A(uint8_t)
 {
     Set(m_CPURegisters.regs.regA, 0);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_1_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_1_B(uint8_t)
 {
     Set(m_CPURegisters.regs.regB, 1);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_1_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_1_C(uint8_t)
 {
     Set(m_CPURegisters.regs.regC, 1);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_1_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_1_D(uint8_t)
 {
     Set(m_CPURegisters.regs.regD, 1);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_1_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_1_E(uint8_t)
 {
     Set(m_CPURegisters.regs.regE, 1);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_1_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_1_H(uint8_t)
 {
     Set(m_CPURegisters.regs.regH, 1);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_1_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_1_L(uint8_t)
 {
     Set(m_CPURegisters.regs.regL, 1);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_1_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_1_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -1521,56 +1728,64 @@ void CZ80Core::SET_1_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_1_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_1_A(uint8_t)
 {
     Set(m_CPURegisters.regs.regA, 1);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_2_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_2_B(uint8_t)
 {
     Set(m_CPURegisters.regs.regB, 2);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_2_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_2_C(uint8_t)
 {
     Set(m_CPURegisters.regs.regC, 2);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_2_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_2_D(uint8_t)
 {
     Set(m_CPURegisters.regs.regD, 2);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_2_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_2_E(uint8_t)
 {
     Set(m_CPURegisters.regs.regE, 2);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_2_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_2_H(uint8_t)
 {
     Set(m_CPURegisters.regs.regH, 2);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_2_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_2_L(uint8_t)
 {
     Set(m_CPURegisters.regs.regL, 2);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_2_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_2_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -1580,56 +1795,64 @@ void CZ80Core::SET_2_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_2_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_2_A(uint8_t)
 {
     Set(m_CPURegisters.regs.regA, 2);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_3_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_3_B(uint8_t)
 {
     Set(m_CPURegisters.regs.regB, 3);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_3_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_3_C(uint8_t)
 {
     Set(m_CPURegisters.regs.regC, 3);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_3_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_3_D(uint8_t)
 {
     Set(m_CPURegisters.regs.regD, 3);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_3_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_3_E(uint8_t)
 {
     Set(m_CPURegisters.regs.regE, 3);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_3_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_3_H(uint8_t)
 {
     Set(m_CPURegisters.regs.regH, 3);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_3_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_3_L(uint8_t)
 {
     Set(m_CPURegisters.regs.regL, 3);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_3_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_3_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -1639,56 +1862,64 @@ void CZ80Core::SET_3_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_3_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_3_A(uint8_t)
 {
     Set(m_CPURegisters.regs.regA, 3);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_4_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_4_B(uint8_t)
 {
     Set(m_CPURegisters.regs.regB, 4);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_4_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_4_C(uint8_t)
 {
     Set(m_CPURegisters.regs.regC, 4);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_4_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_4_D(uint8_t)
 {
     Set(m_CPURegisters.regs.regD, 4);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_4_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_4_E(uint8_t)
 {
     Set(m_CPURegisters.regs.regE, 4);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_4_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_4_H(uint8_t)
 {
     Set(m_CPURegisters.regs.regH, 4);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_4_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_4_L(uint8_t)
 {
     Set(m_CPURegisters.regs.regL, 4);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_4_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_4_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -1698,56 +1929,64 @@ void CZ80Core::SET_4_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_4_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_4_A(uint8_t)
 {
     Set(m_CPURegisters.regs.regA, 4);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_5_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_5_B(uint8_t)
 {
     Set(m_CPURegisters.regs.regB, 5);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_5_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_5_C(uint8_t)
 {
     Set(m_CPURegisters.regs.regC, 5);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_5_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_5_D(uint8_t)
 {
     Set(m_CPURegisters.regs.regD, 5);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_5_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_5_E(uint8_t)
 {
     Set(m_CPURegisters.regs.regE, 5);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_5_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_5_H(uint8_t)
 {
     Set(m_CPURegisters.regs.regH, 5);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_5_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_5_L(uint8_t)
 {
     Set(m_CPURegisters.regs.regL, 5);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_5_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_5_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -1757,56 +1996,64 @@ void CZ80Core::SET_5_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_5_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_5_A(uint8_t)
 {
     Set(m_CPURegisters.regs.regA, 5);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_6_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_6_B(uint8_t)
 {
     Set(m_CPURegisters.regs.regB, 6);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_6_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_6_C(uint8_t)
 {
     Set(m_CPURegisters.regs.regC, 6);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_6_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_6_D(uint8_t)
 {
     Set(m_CPURegisters.regs.regD, 6);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_6_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_6_E(uint8_t)
 {
     Set(m_CPURegisters.regs.regE, 6);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_6_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_6_H(uint8_t)
 {
     Set(m_CPURegisters.regs.regH, 6);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_6_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_6_L(uint8_t)
 {
     Set(m_CPURegisters.regs.regL, 6);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_6_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_6_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -1816,56 +2063,64 @@ void CZ80Core::SET_6_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_6_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_6_A(uint8_t)
 {
     Set(m_CPURegisters.regs.regA, 6);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_7_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_7_B(uint8_t)
 {
     Set(m_CPURegisters.regs.regB, 7);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_7_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_7_C(uint8_t)
 {
     Set(m_CPURegisters.regs.regC, 7);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_7_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_7_D(uint8_t)
 {
     Set(m_CPURegisters.regs.regD, 7);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_7_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_7_E(uint8_t)
 {
     Set(m_CPURegisters.regs.regE, 7);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_7_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_7_H(uint8_t)
 {
     Set(m_CPURegisters.regs.regH, 7);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_7_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_7_L(uint8_t)
 {
     Set(m_CPURegisters.regs.regL, 7);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_7_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_7_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -1875,9 +2130,12 @@ void CZ80Core::SET_7_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_7_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_7_A(uint8_t)
 {
     Set(m_CPURegisters.regs.regA, 7);
 }
 
 //-----------------------------------------------------------------------------------------
+
+#include "Z80CoreInstances.h"
@@ -4,7 +4,8 @@
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_RLC_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_RLC_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -18,7 +19,8 @@ void CZ80Core::LD_B_RLC_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_RLC_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_RLC_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -32,7 +34,8 @@ void CZ80Core::LD_C_RLC_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_RLC_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_RLC_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -46,7 +49,8 @@ void CZ80Core::LD_D_RLC_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_RLC_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_RLC_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -60,7 +64,8 @@ void CZ80Core::LD_E_RLC_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_RLC_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_RLC_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -74,7 +79,8 @@ void CZ80Core::LD_H_RLC_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_RLC_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_RLC_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -88,7 +94,8 @@ void CZ80Core::LD_L_RLC_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RLC_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RLC_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -100,7 +107,8 @@ void CZ80Core::RLC_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_RLC_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_RLC_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -114,7 +122,8 @@ void CZ80Core::LD_A_RLC_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_RRC_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_RRC_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -128,7 +137,8 @@ void CZ80Core::LD_B_RRC_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_RRC_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_RRC_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -142,7 +152,8 @@ void CZ80Core::LD_C_RRC_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_RRC_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_RRC_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -156,7 +167,8 @@ void CZ80Core::LD_D_RRC_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_RRC_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_RRC_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -170,7 +182,8 @@ void CZ80Core::LD_E_RRC_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_RRC_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_RRC_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -184,7 +197,8 @@ void CZ80Core::LD_H_RRC_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_RRC_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_RRC_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -198,7 +212,8 @@ void CZ80Core::LD_L_RRC_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RRC_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RRC_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -210,7 +225,8 @@ void CZ80Core::RRC_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_RRC_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_RRC_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -224,7 +240,8 @@ void CZ80Core::LD_A_RRC_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_RL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_RL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -238,7 +255,8 @@ void CZ80Core::LD_B_RL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_RL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_RL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -252,7 +270,8 @@ void CZ80Core::LD_C_RL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_RL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_RL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -266,7 +285,8 @@ void CZ80Core::LD_D_RL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_RL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_RL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -280,7 +300,8 @@ void CZ80Core::LD_E_RL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_RL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_RL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -294,7 +315,8 @@ void CZ80Core::LD_H_RL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_RL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_RL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -308,7 +330,8 @@ void CZ80Core::LD_L_RL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -320,7 +343,8 @@ void CZ80Core::RL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_RL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_RL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -334,7 +358,8 @@ void CZ80Core::LD_A_RL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_RR_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_RR_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -348,7 +373,8 @@ void CZ80Core::LD_B_RR_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_RR_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_RR_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -362,7 +388,8 @@ void CZ80Core::LD_C_RR_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_RR_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_RR_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -376,7 +403,8 @@ void CZ80Core::LD_D_RR_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_RR_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_RR_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -390,7 +418,8 @@ void CZ80Core::LD_E_RR_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_RR_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_RR_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -404,7 +433,8 @@ void CZ80Core::LD_H_RR_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_RR_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_RR_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -418,7 +448,8 @@ void CZ80Core::LD_L_RR_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RR_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RR_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -430,7 +461,8 @@ void CZ80Core::RR_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_RR_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_RR_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -444,7 +476,8 @@ void CZ80Core::LD_A_RR_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_SLA_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_SLA_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -458,7 +491,8 @@ void CZ80Core::LD_B_SLA_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_SLA_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_SLA_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -472,7 +506,8 @@ void CZ80Core::LD_C_SLA_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_SLA_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_SLA_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -486,7 +521,8 @@ void CZ80Core::LD_D_SLA_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_SLA_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_SLA_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -500,7 +536,8 @@ void CZ80Core::LD_E_SLA_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_SLA_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_SLA_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -514,7 +551,8 @@ void CZ80Core::LD_H_SLA_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_SLA_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_SLA_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -528,7 +566,8 @@ void CZ80Core::LD_L_SLA_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SLA_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SLA_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -540,7 +579,8 @@ void CZ80Core::SLA_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_SLA_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_SLA_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -554,7 +594,8 @@ void CZ80Core::LD_A_SLA_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_SRA_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_SRA_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -568,7 +609,8 @@ void CZ80Core::LD_B_SRA_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_SRA_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_SRA_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -582,7 +624,8 @@ void CZ80Core::LD_C_SRA_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_SRA_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_SRA_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -596,7 +639,8 @@ void CZ80Core::LD_D_SRA_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_SRA_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_SRA_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -610,7 +654,8 @@ void CZ80Core::LD_E_SRA_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_SRA_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_SRA_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -624,7 +669,8 @@ void CZ80Core::LD_H_SRA_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_SRA_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_SRA_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -638,7 +684,8 @@ void CZ80Core::LD_L_SRA_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SRA_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SRA_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -650,7 +697,8 @@ void CZ80Core::SRA_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_SRA_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_SRA_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -664,7 +712,8 @@ void CZ80Core::LD_A_SRA_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_SLL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_SLL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -678,7 +727,8 @@ void CZ80Core::LD_B_SLL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_SLL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_SLL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -692,7 +742,8 @@ void CZ80Core::LD_C_SLL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_SLL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_SLL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -706,7 +757,8 @@ void CZ80Core::LD_D_SLL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_SLL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_SLL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -720,7 +772,8 @@ void CZ80Core::LD_E_SLL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_SLL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_SLL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -734,7 +787,8 @@ void CZ80Core::LD_H_SLL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_SLL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_SLL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -748,7 +802,8 @@ void CZ80Core::LD_L_SLL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SLL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SLL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -760,7 +815,8 @@ void CZ80Core::SLL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_SLL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_SLL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -774,7 +830,8 @@ void CZ80Core::LD_A_SLL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_SRL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_SRL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -788,7 +845,8 @@ void CZ80Core::LD_B_SRL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_SRL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_SRL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -802,7 +860,8 @@ void CZ80Core::LD_C_SRL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_SRL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_SRL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -816,7 +875,8 @@ void CZ80Core::LD_D_SRL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_SRL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_SRL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -830,7 +890,8 @@ void CZ80Core::LD_E_SRL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_SRL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_SRL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -844,7 +905,8 @@ void CZ80Core::LD_H_SRL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_SRL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_SRL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -858,7 +920,8 @@ void CZ80Core::LD_L_SRL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SRL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SRL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -870,7 +933,8 @@ void CZ80Core::SRL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_SRL_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_SRL_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -884,7 +948,8 @@ void CZ80Core::LD_A_SRL_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_0_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_0_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -895,7 +960,8 @@ void CZ80Core::BIT_0_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_1_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_1_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -906,7 +972,8 @@ void CZ80Core::BIT_1_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_2_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_2_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -917,7 +984,8 @@ void CZ80Core::BIT_2_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_3_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_3_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -928,7 +996,8 @@ void CZ80Core::BIT_3_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_4_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_4_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -939,7 +1008,8 @@ void CZ80Core::BIT_4_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_5_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_5_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -950,7 +1020,8 @@ void CZ80Core::BIT_5_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_6_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_6_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -961,7 +1032,8 @@ void CZ80Core::BIT_6_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::BIT_7_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::BIT_7_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -972,7 +1044,8 @@ void CZ80Core::BIT_7_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_RES_0_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_RES_0_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -986,7 +1059,8 @@ void CZ80Core::LD_B_RES_0_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_RES_0_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_RES_0_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1000,7 +1074,8 @@ void CZ80Core::LD_C_RES_0_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_RES_0_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_RES_0_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1014,7 +1089,8 @@ void CZ80Core::LD_D_RES_0_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_RES_0_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_RES_0_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1028,7 +1104,8 @@ void CZ80Core::LD_E_RES_0_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_RES_0_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_RES_0_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1042,7 +1119,8 @@ void CZ80Core::LD_H_RES_0_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_RES_0_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_RES_0_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1056,7 +1134,8 @@ void CZ80Core::LD_L_RES_0_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_0_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_0_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1068,7 +1147,8 @@ void CZ80Core::RES_0_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_RES_0_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_RES_0_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1082,7 +1162,8 @@ void CZ80Core::LD_A_RES_0_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_RES_1_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_RES_1_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1096,7 +1177,8 @@ void CZ80Core::LD_B_RES_1_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_RES_1_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_RES_1_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1110,7 +1192,8 @@ void CZ80Core::LD_C_RES_1_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_RES_1_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_RES_1_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1124,7 +1207,8 @@ void CZ80Core::LD_D_RES_1_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_RES_1_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_RES_1_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1138,7 +1222,8 @@ void CZ80Core::LD_E_RES_1_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_RES_1_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_RES_1_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1152,7 +1237,8 @@ void CZ80Core::LD_H_RES_1_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_RES_1_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_RES_1_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1166,7 +1252,8 @@ void CZ80Core::LD_L_RES_1_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_1_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_1_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1178,7 +1265,8 @@ void CZ80Core::RES_1_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_RES_1_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_RES_1_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1192,7 +1280,8 @@ void CZ80Core::LD_A_RES_1_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_RES_2_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_RES_2_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1206,7 +1295,8 @@ void CZ80Core::LD_B_RES_2_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_RES_2_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_RES_2_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1220,7 +1310,8 @@ void CZ80Core::LD_C_RES_2_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_RES_2_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_RES_2_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1234,7 +1325,8 @@ void CZ80Core::LD_D_RES_2_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_RES_2_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_RES_2_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1248,7 +1340,8 @@ void CZ80Core::LD_E_RES_2_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_RES_2_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_RES_2_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1262,7 +1355,8 @@ void CZ80Core::LD_H_RES_2_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_RES_2_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_RES_2_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1276,7 +1370,8 @@ void CZ80Core::LD_L_RES_2_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_2_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_2_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1288,7 +1383,8 @@ void CZ80Core::RES_2_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_RES_2_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_RES_2_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1302,7 +1398,8 @@ void CZ80Core::LD_A_RES_2_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_RES_3_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_RES_3_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1316,7 +1413,8 @@ void CZ80Core::LD_B_RES_3_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_RES_3_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_RES_3_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1330,7 +1428,8 @@ void CZ80Core::LD_C_RES_3_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_RES_3_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_RES_3_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1344,7 +1443,8 @@ void CZ80Core::LD_D_RES_3_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_RES_3_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_RES_3_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1358,7 +1458,8 @@ void CZ80Core::LD_E_RES_3_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_RES_3_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_RES_3_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1372,7 +1473,8 @@ void CZ80Core::LD_H_RES_3_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_RES_3_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_RES_3_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1386,7 +1488,8 @@ void CZ80Core::LD_L_RES_3_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_3_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_3_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1398,7 +1501,8 @@ void CZ80Core::RES_3_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_RES_3_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_RES_3_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1412,7 +1516,8 @@ void CZ80Core::LD_A_RES_3_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_RES_4_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_RES_4_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1426,7 +1531,8 @@ void CZ80Core::LD_B_RES_4_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_RES_4_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_RES_4_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1440,7 +1546,8 @@ void CZ80Core::LD_C_RES_4_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_RES_4_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_RES_4_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1454,7 +1561,8 @@ void CZ80Core::LD_D_RES_4_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_RES_4_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_RES_4_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1468,7 +1576,8 @@ void CZ80Core::LD_E_RES_4_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_RES_4_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_RES_4_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1482,7 +1591,8 @@ void CZ80Core::LD_H_RES_4_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_RES_4_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_RES_4_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1496,7 +1606,8 @@ void CZ80Core::LD_L_RES_4_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_4_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_4_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1508,7 +1619,8 @@ void CZ80Core::RES_4_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_RES_4_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_RES_4_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1522,7 +1634,8 @@ void CZ80Core::LD_A_RES_4_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_RES_5_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_RES_5_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1536,7 +1649,8 @@ void CZ80Core::LD_B_RES_5_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_RES_5_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_RES_5_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1550,7 +1664,8 @@ void CZ80Core::LD_C_RES_5_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_RES_5_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_RES_5_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1564,7 +1679,8 @@ void CZ80Core::LD_D_RES_5_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_RES_5_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_RES_5_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1578,7 +1694,8 @@ void CZ80Core::LD_E_RES_5_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_RES_5_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_RES_5_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1592,7 +1709,8 @@ void CZ80Core::LD_H_RES_5_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_RES_5_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_RES_5_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1606,7 +1724,8 @@ void CZ80Core::LD_L_RES_5_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_5_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_5_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1618,7 +1737,8 @@ void CZ80Core::RES_5_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_RES_5_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_RES_5_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1632,7 +1752,8 @@ void CZ80Core::LD_A_RES_5_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_RES_6_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_RES_6_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1646,7 +1767,8 @@ void CZ80Core::LD_B_RES_6_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_RES_6_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_RES_6_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1660,7 +1782,8 @@ void CZ80Core::LD_C_RES_6_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_RES_6_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_RES_6_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1674,7 +1797,8 @@ void CZ80Core::LD_D_RES_6_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_RES_6_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_RES_6_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1688,7 +1812,8 @@ void CZ80Core::LD_E_RES_6_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_RES_6_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_RES_6_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1702,7 +1827,8 @@ void CZ80Core::LD_H_RES_6_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_RES_6_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_RES_6_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1716,7 +1842,8 @@ void CZ80Core::LD_L_RES_6_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_6_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_6_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1728,7 +1855,8 @@ void CZ80Core::RES_6_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_RES_6_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_RES_6_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1742,7 +1870,8 @@ void CZ80Core::LD_A_RES_6_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_RES_7_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_RES_7_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1756,7 +1885,8 @@ void CZ80Core::LD_B_RES_7_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_RES_7_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_RES_7_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1770,7 +1900,8 @@ void CZ80Core::LD_C_RES_7_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_RES_7_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_RES_7_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1784,7 +1915,8 @@ void CZ80Core::LD_D_RES_7_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_RES_7_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_RES_7_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1798,7 +1930,8 @@ void CZ80Core::LD_E_RES_7_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_RES_7_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_RES_7_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1812,7 +1945,8 @@ void CZ80Core::LD_H_RES_7_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_RES_7_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_RES_7_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1826,7 +1960,8 @@ void CZ80Core::LD_L_RES_7_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RES_7_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RES_7_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1838,7 +1973,8 @@ void CZ80Core::RES_7_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_RES_7_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_RES_7_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1852,7 +1988,8 @@ void CZ80Core::LD_A_RES_7_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_SET_0_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_SET_0_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1866,7 +2003,8 @@ void CZ80Core::LD_B_SET_0_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_SET_0_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_SET_0_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1880,7 +2018,8 @@ void CZ80Core::LD_C_SET_0_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_SET_0_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_SET_0_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1894,7 +2033,8 @@ void CZ80Core::LD_D_SET_0_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_SET_0_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_SET_0_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1908,7 +2048,8 @@ void CZ80Core::LD_E_SET_0_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_SET_0_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_SET_0_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1922,7 +2063,8 @@ void CZ80Core::LD_H_SET_0_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_SET_0_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_SET_0_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1936,7 +2078,8 @@ void CZ80Core::LD_L_SET_0_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_0_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_0_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1948,7 +2091,8 @@ void CZ80Core::SET_0_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_SET_0_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_SET_0_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1962,7 +2106,8 @@ void CZ80Core::LD_A_SET_0_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_SET_1_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_SET_1_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1976,7 +2121,8 @@ void CZ80Core::LD_B_SET_1_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_SET_1_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_SET_1_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -1990,7 +2136,8 @@ void CZ80Core::LD_C_SET_1_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_SET_1_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_SET_1_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2004,7 +2151,8 @@ void CZ80Core::LD_D_SET_1_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_SET_1_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_SET_1_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2018,7 +2166,8 @@ void CZ80Core::LD_E_SET_1_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_SET_1_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_SET_1_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2032,7 +2181,8 @@ void CZ80Core::LD_H_SET_1_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_SET_1_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_SET_1_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2046,7 +2196,8 @@ void CZ80Core::LD_L_SET_1_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_1_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_1_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2058,7 +2209,8 @@ void CZ80Core::SET_1_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_SET_1_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_SET_1_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2072,7 +2224,8 @@ void CZ80Core::LD_A_SET_1_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_SET_2_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_SET_2_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2086,7 +2239,8 @@ void CZ80Core::LD_B_SET_2_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_SET_2_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_SET_2_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2100,7 +2254,8 @@ void CZ80Core::LD_C_SET_2_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_SET_2_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_SET_2_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2114,7 +2269,8 @@ void CZ80Core::LD_D_SET_2_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_SET_2_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_SET_2_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2128,7 +2284,8 @@ void CZ80Core::LD_E_SET_2_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_SET_2_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_SET_2_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2142,7 +2299,8 @@ void CZ80Core::LD_H_SET_2_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_SET_2_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_SET_2_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2156,7 +2314,8 @@ void CZ80Core::LD_L_SET_2_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_2_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_2_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2168,7 +2327,8 @@ void CZ80Core::SET_2_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_SET_2_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_SET_2_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2182,7 +2342,8 @@ void CZ80Core::LD_A_SET_2_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_SET_3_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_SET_3_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2196,7 +2357,8 @@ void CZ80Core::LD_B_SET_3_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_SET_3_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_SET_3_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2210,7 +2372,8 @@ void CZ80Core::LD_C_SET_3_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_SET_3_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_SET_3_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2224,7 +2387,8 @@ void CZ80Core::LD_D_SET_3_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_SET_3_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_SET_3_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2238,7 +2402,8 @@ void CZ80Core::LD_E_SET_3_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_SET_3_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_SET_3_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2252,7 +2417,8 @@ void CZ80Core::LD_H_SET_3_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_SET_3_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_SET_3_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2266,7 +2432,8 @@ void CZ80Core::LD_L_SET_3_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_3_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_3_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2278,7 +2445,8 @@ void CZ80Core::SET_3_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_SET_3_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_SET_3_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2292,7 +2460,8 @@ void CZ80Core::LD_A_SET_3_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_SET_4_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_SET_4_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2306,7 +2475,8 @@ void CZ80Core::LD_B_SET_4_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_SET_4_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_SET_4_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2320,7 +2490,8 @@ void CZ80Core::LD_C_SET_4_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_SET_4_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_SET_4_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2334,7 +2505,8 @@ void CZ80Core::LD_D_SET_4_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_SET_4_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_SET_4_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2348,7 +2520,8 @@ void CZ80Core::LD_E_SET_4_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_SET_4_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_SET_4_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2362,7 +2535,8 @@ void CZ80Core::LD_H_SET_4_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_SET_4_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_SET_4_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2376,7 +2550,8 @@ void CZ80Core::LD_L_SET_4_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_4_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_4_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2388,7 +2563,8 @@ void CZ80Core::SET_4_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_SET_4_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_SET_4_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2402,7 +2578,8 @@ void CZ80Core::LD_A_SET_4_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_SET_5_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_SET_5_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2416,7 +2593,8 @@ void CZ80Core::LD_B_SET_5_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_SET_5_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_SET_5_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2430,7 +2608,8 @@ void CZ80Core::LD_C_SET_5_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_SET_5_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_SET_5_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2444,7 +2623,8 @@ void CZ80Core::LD_D_SET_5_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_SET_5_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_SET_5_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2458,7 +2638,8 @@ void CZ80Core::LD_E_SET_5_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_SET_5_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_SET_5_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2472,7 +2653,8 @@ void CZ80Core::LD_H_SET_5_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_SET_5_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_SET_5_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2486,7 +2668,8 @@ void CZ80Core::LD_L_SET_5_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_5_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_5_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2498,7 +2681,8 @@ void CZ80Core::SET_5_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_SET_5_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_SET_5_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2512,7 +2696,8 @@ void CZ80Core::LD_A_SET_5_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_SET_6_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_SET_6_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2526,7 +2711,8 @@ void CZ80Core::LD_B_SET_6_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_SET_6_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_SET_6_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2540,7 +2726,8 @@ void CZ80Core::LD_C_SET_6_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_SET_6_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_SET_6_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2554,7 +2741,8 @@ void CZ80Core::LD_D_SET_6_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_SET_6_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_SET_6_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2568,7 +2756,8 @@ void CZ80Core::LD_E_SET_6_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_SET_6_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_SET_6_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2582,7 +2771,8 @@ void CZ80Core::LD_H_SET_6_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_SET_6_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_SET_6_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2596,7 +2786,8 @@ void CZ80Core::LD_L_SET_6_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_6_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_6_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2608,7 +2799,8 @@ void CZ80Core::SET_6_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_SET_6_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_SET_6_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2622,7 +2814,8 @@ void CZ80Core::LD_A_SET_6_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_SET_7_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_SET_7_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2636,7 +2829,8 @@ void CZ80Core::LD_B_SET_7_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_SET_7_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_SET_7_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2650,7 +2844,8 @@ void CZ80Core::LD_C_SET_7_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_SET_7_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_SET_7_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2664,7 +2859,8 @@ void CZ80Core::LD_D_SET_7_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_SET_7_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_SET_7_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2678,7 +2874,8 @@ void CZ80Core::LD_E_SET_7_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_SET_7_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_SET_7_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2692,7 +2889,8 @@ void CZ80Core::LD_H_SET_7_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_SET_7_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_SET_7_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2706,7 +2904,8 @@ void CZ80Core::LD_L_SET_7_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SET_7_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SET_7_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2718,7 +2917,8 @@ void CZ80Core::SET_7_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_SET_7_off_IX_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_SET_7_off_IX_IY_d(uint8_t)
 {
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -2732,4 +2932,4 @@ void CZ80Core::LD_A_SET_7_off_IX_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-
+#include "Z80CoreInstances.h"
@@ -3,7 +3,8 @@
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_IX_BC(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_IX_BC(uint8_t)
 {
     // Handle contention
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -19,7 +20,8 @@ void CZ80Core::ADD_IX_BC(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_IX_DE(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_IX_DE(uint8_t)
 {
     // Handle contention
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -35,7 +37,8 @@ void CZ80Core::ADD_IX_DE(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IX_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IX_nn(uint8_t)
 {
     m_CPURegisters.regs.regIXl = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_CPURegisters.regs.regIXh = Z80CoreMemRead(m_CPURegisters.regPC++);
@@ -43,7 +46,8 @@ void CZ80Core::LD_IX_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_nn_IX(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_nn_IX(uint8_t)
 {
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
@@ -54,7 +58,8 @@ void CZ80Core::LD_off_nn_IX(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::INC_IX(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::INC_IX(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -63,28 +68,32 @@ void CZ80Core::INC_IX(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::INC_IXh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::INC_IXh(uint8_t)
 {
     Inc(m_CPURegisters.regs.regIXh);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::DEC_IXh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::DEC_IXh(uint8_t)
 {
     Dec(m_CPURegisters.regs.regIXh);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IXh_n(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IXh_n(uint8_t)
 {
     m_CPURegisters.regs.regIXh = Z80CoreMemRead(m_CPURegisters.regPC++);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_IX_IX(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_IX_IX(uint8_t)
 {
     // Handle contention
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -100,7 +109,8 @@ void CZ80Core::ADD_IX_IX(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IX_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IX_off_nn(uint8_t)
 {
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
@@ -111,7 +121,8 @@ void CZ80Core::LD_IX_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::DEC_IX(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::DEC_IX(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -120,28 +131,32 @@ void CZ80Core::DEC_IX(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::INC_IXl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::INC_IXl(uint8_t)
 {
     Inc(m_CPURegisters.regs.regIXl);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::DEC_IXl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::DEC_IXl(uint8_t)
 {
     Dec(m_CPURegisters.regs.regIXl);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IXl_n(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IXl_n(uint8_t)
 {
     m_CPURegisters.regs.regIXl = Z80CoreMemRead(m_CPURegisters.regPC++);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::INC_off_IX_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::INC_off_IX_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -157,7 +172,8 @@ void CZ80Core::INC_off_IX_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::DEC_off_IX_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::DEC_off_IX_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -173,7 +189,8 @@ void CZ80Core::DEC_off_IX_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_IX_d_n(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_IX_d_n(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     uint8_t val = Z80CoreMemRead(m_CPURegisters.regPC++);
@@ -184,7 +201,8 @@ void CZ80Core::LD_off_IX_d_n(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_IX_SP(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_IX_SP(uint8_t)
 {
     // Handle contention
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -200,21 +218,24 @@ void CZ80Core::ADD_IX_SP(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_IXh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_IXh(uint8_t)
 {
     m_CPURegisters.regs.regB = m_CPURegisters.regs.regIXh;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_IXl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_IXl(uint8_t)
 {
     m_CPURegisters.regs.regB = m_CPURegisters.regs.regIXl;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_off_IX_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_off_IX_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -227,21 +248,24 @@ void CZ80Core::LD_B_off_IX_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_IXh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_IXh(uint8_t)
 {
     m_CPURegisters.regs.regC = m_CPURegisters.regs.regIXh;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_IXl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_IXl(uint8_t)
 {
     m_CPURegisters.regs.regC = m_CPURegisters.regs.regIXl;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_off_IX_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_off_IX_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -254,21 +278,24 @@ void CZ80Core::LD_C_off_IX_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_IXh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_IXh(uint8_t)
 {
     m_CPURegisters.regs.regD = m_CPURegisters.regs.regIXh;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_IXl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_IXl(uint8_t)
 {
     m_CPURegisters.regs.regD = m_CPURegisters.regs.regIXl;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_off_IX_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_off_IX_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -281,21 +308,24 @@ void CZ80Core::LD_D_off_IX_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_IXh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_IXh(uint8_t)
 {
     m_CPURegisters.regs.regE = m_CPURegisters.regs.regIXh;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_IXl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_IXl(uint8_t)
 {
     m_CPURegisters.regs.regE = m_CPURegisters.regs.regIXl;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_off_IX_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_off_IX_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -308,49 +338,56 @@ void CZ80Core::LD_E_off_IX_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IXh_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IXh_B(uint8_t)
 {
     m_CPURegisters.regs.regIXh = m_CPURegisters.regs.regB;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IXh_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IXh_C(uint8_t)
 {
     m_CPURegisters.regs.regIXh = m_CPURegisters.regs.regC;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IXh_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IXh_D(uint8_t)
 {
     m_CPURegisters.regs.regIXh = m_CPURegisters.regs.regD;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IXh_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IXh_E(uint8_t)
 {
     m_CPURegisters.regs.regIXh = m_CPURegisters.regs.regE;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IXh_IXh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IXh_IXh(uint8_t)
 {
     m_CPURegisters.regs.regIXh = m_CPURegisters.regs.regIXh;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IXh_IXl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IXh_IXl(uint8_t)
 {
     m_CPURegisters.regs.regIXh = m_CPURegisters.regs.regIXl;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_off_IX_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_off_IX_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -363,56 +400,64 @@ void CZ80Core::LD_H_off_IX_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IXh_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IXh_A(uint8_t)
 {
     m_CPURegisters.regs.regIXh = m_CPURegisters.regs.regA;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IXl_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IXl_B(uint8_t)
 {
     m_CPURegisters.regs.regIXl = m_CPURegisters.regs.regB;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IXl_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IXl_C(uint8_t)
 {
     m_CPURegisters.regs.regIXl = m_CPURegisters.regs.regC;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IXl_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IXl_D(uint8_t)
 {
     m_CPURegisters.regs.regIXl = m_CPURegisters.regs.regD;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IXl_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IXl_E(uint8_t)
 {
     m_CPURegisters.regs.regIXl = m_CPURegisters.regs.regE;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IXl_IXh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IXl_IXh(uint8_t)
 {
     m_CPURegisters.regs.regIXl = m_CPURegisters.regs.regIXh;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IXl_IXl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IXl_IXl(uint8_t)
 {
     m_CPURegisters.regs.regIXl = m_CPURegisters.regs.regIXl;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_off_IX_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_off_IX_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -425,14 +470,16 @@ void CZ80Core::LD_L_off_IX_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IXl_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IXl_A(uint8_t)
 {
     m_CPURegisters.regs.regIXl = m_CPURegisters.regs.regA;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_IX_d_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_IX_d_B(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -445,7 +492,8 @@ void CZ80Core::LD_off_IX_d_B(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_IX_d_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_IX_d_C(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -458,7 +506,8 @@ void CZ80Core::LD_off_IX_d_C(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_IX_d_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_IX_d_D(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -471,7 +520,8 @@ void CZ80Core::LD_off_IX_d_D(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_IX_d_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_IX_d_E(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -484,7 +534,8 @@ void CZ80Core::LD_off_IX_d_E(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_IX_d_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_IX_d_H(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -497,7 +548,8 @@ void CZ80Core::LD_off_IX_d_H(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_IX_d_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_IX_d_L(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -510,7 +562,8 @@ void CZ80Core::LD_off_IX_d_L(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_IX_d_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_IX_d_A(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -523,21 +576,24 @@ void CZ80Core::LD_off_IX_d_A(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_IXh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_IXh(uint8_t)
 {
     m_CPURegisters.regs.regA = m_CPURegisters.regs.regIXh;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_IXl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_IXl(uint8_t)
 {
     m_CPURegisters.regs.regA = m_CPURegisters.regs.regIXl;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_off_IX_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_off_IX_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -550,21 +606,24 @@ void CZ80Core::LD_A_off_IX_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_A_IXh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_A_IXh(uint8_t)
 {
     Add8(m_CPURegisters.regs.regIXh);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_A_IXl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_A_IXl(uint8_t)
 {
     Add8(m_CPURegisters.regs.regIXl);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_A_off_IX_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_A_off_IX_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -578,21 +637,24 @@ void CZ80Core::ADD_A_off_IX_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADC_A_IXh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADC_A_IXh(uint8_t)
 {
     Adc8(m_CPURegisters.regs.regIXh);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADC_A_IXl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADC_A_IXl(uint8_t)
 {
     Adc8(m_CPURegisters.regs.regIXl);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADC_A_off_IX_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADC_A_off_IX_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -606,21 +668,24 @@ void CZ80Core::ADC_A_off_IX_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SUB_A_IXh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SUB_A_IXh(uint8_t)
 {
     Sub8(m_CPURegisters.regs.regIXh);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SUB_A_IXl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SUB_A_IXl(uint8_t)
 {
     Sub8(m_CPURegisters.regs.regIXl);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SUB_A_off_IX_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SUB_A_off_IX_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -634,21 +699,24 @@ void CZ80Core::SUB_A_off_IX_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SBC_A_IXh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SBC_A_IXh(uint8_t)
 {
     Sbc8(m_CPURegisters.regs.regIXh);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SBC_A_IXl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SBC_A_IXl(uint8_t)
 {
     Sbc8(m_CPURegisters.regs.regIXl);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SBC_A_off_IX_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SBC_A_off_IX_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -662,21 +730,24 @@ void CZ80Core::SBC_A_off_IX_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::AND_IXh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::AND_IXh(uint8_t)
 {
     And(m_CPURegisters.regs.regIXh);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::AND_IXl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::AND_IXl(uint8_t)
 {
     And(m_CPURegisters.regs.regIXl);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::AND_off_IX_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::AND_off_IX_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -690,21 +761,24 @@ void CZ80Core::AND_off_IX_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::XOR_IXh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::XOR_IXh(uint8_t)
 {
     Xor(m_CPURegisters.regs.regIXh);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::XOR_IXl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::XOR_IXl(uint8_t)
 {
     Xor(m_CPURegisters.regs.regIXl);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::XOR_off_IX_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::XOR_off_IX_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -718,21 +792,24 @@ void CZ80Core::XOR_off_IX_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OR_IXh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OR_IXh(uint8_t)
 {
     Or(m_CPURegisters.regs.regIXh);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OR_IXl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OR_IXl(uint8_t)
 {
     Or(m_CPURegisters.regs.regIXl);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OR_off_IX_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OR_off_IX_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -746,21 +823,24 @@ void CZ80Core::OR_off_IX_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CP_IXh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CP_IXh(uint8_t)
 {
     Cp(m_CPURegisters.regs.regIXh);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CP_IXl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CP_IXl(uint8_t)
 {
     Cp(m_CPURegisters.regs.regIXl);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CP_off_IX_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CP_off_IX_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -774,7 +854,8 @@ void CZ80Core::CP_off_IX_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::POP_IX(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::POP_IX(uint8_t)
 {
     m_CPURegisters.regs.regIXl = Z80CoreMemRead(m_CPURegisters.regSP++);
     m_CPURegisters.regs.regIXh = Z80CoreMemRead(m_CPURegisters.regSP++);
@@ -782,7 +863,8 @@ void CZ80Core::POP_IX(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::EX_off_SP_IX(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::EX_off_SP_IX(uint8_t)
 {
     uint8_t tl = Z80CoreMemRead(m_CPURegisters.regSP + 0);
     uint8_t th = Z80CoreMemRead(m_CPURegisters.regSP + 1);
@@ -799,7 +881,8 @@ void CZ80Core::EX_off_SP_IX(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::PUSH_IX(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::PUSH_IX(uint8_t)
 {
     Z80CoreMemoryContention((m_CPURegisters.regI << 8) | m_CPURegisters.regR, 1);
     Z80CoreMemWrite(--m_CPURegisters.regSP, m_CPURegisters.regs.regIXh);
@@ -808,14 +891,16 @@ void CZ80Core::PUSH_IX(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::JP_off_IX(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::JP_off_IX(uint8_t)
 {
     m_CPURegisters.regPC = m_CPURegisters.reg_pairs.regIX;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_SP_IX(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_SP_IX(uint8_t)
 {
     Z80CoreMemoryContention((m_CPURegisters.regI << 8) | m_CPURegisters.regR, 1);
     Z80CoreMemoryContention((m_CPURegisters.regI << 8) | m_CPURegisters.regR, 1);
@@ -824,3 +909,4 @@ void CZ80Core::LD_SP_IX(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
+#include "Z80CoreInstances.h"
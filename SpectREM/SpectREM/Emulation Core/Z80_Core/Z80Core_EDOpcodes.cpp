@@ -3,18 +3,22 @@
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::IN_B_off_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::IN_B_off_C(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = m_CPURegisters.reg_pairs.regBC + 1;
     m_CPURegisters.regs.regB = Z80CoreIORead(m_CPURegisters.reg_pairs.regBC);
     m_CPURegisters.regs.regF &= FLAG_C;
-    m_CPURegisters.regs.regF |= m_SZ35Table[m_CPURegisters.regs.regB];
-    m_CPURegisters.regs.regF |= m_ParityTable[m_CPURegisters.regs.regB];
+    m_CPURegisters.regs.regF |= SZ35Table[m_CPURegisters.regs.regB];
+    m_CPURegisters.regs.regF |= ParityTable[m_CPURegisters.regs.regB];
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OUT_off_C_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OUT_off_C_B(uint8_t)
 {
     m_MEMPTR = m_CPURegisters.reg_pairs.regBC + 1;
     Z80CoreIOWrite(m_CPURegisters.reg_pairs.regBC, m_CPURegisters.regs.regB);
@@ -22,7 +26,8 @@ void CZ80Core::OUT_off_C_B(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SBC_HL_BC(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SBC_HL_BC(uint8_t)
 {
     // Handle contention
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -38,7 +43,8 @@ void CZ80Core::SBC_HL_BC(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_nn_BC(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_nn_BC(uint8_t)
 {
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
@@ -49,7 +55,8 @@ void CZ80Core::LD_off_nn_BC(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::NEG(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::NEG(uint8_t)
 {
     uint8_t t = m_CPURegisters.regs.regA;
     m_CPURegisters.regs.regA = 0;
@@ -58,7 +65,8 @@ void CZ80Core::NEG(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RETN(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RETN(uint8_t)
 {
     m_CPURegisters.IFF1 = m_CPURegisters.IFF2;
 
@@ -70,14 +78,16 @@ void CZ80Core::RETN(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::IM_0(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::IM_0(uint8_t)
 {
     m_CPURegisters.IM = 0;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_I_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_I_A(uint8_t)
 {
     Z80CoreMemoryContention((m_CPURegisters.regI << 8) | m_CPURegisters.regR, 1);
     m_CPURegisters.regI = m_CPURegisters.regs.regA;
@@ -86,18 +96,22 @@ void CZ80Core::LD_I_A(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::IN_C_off_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::IN_C_off_C(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = m_CPURegisters.reg_pairs.regBC + 1;
     m_CPURegisters.regs.regC = Z80CoreIORead(m_CPURegisters.reg_pairs.regBC);
     m_CPURegisters.regs.regF &= FLAG_C;
-    m_CPURegisters.regs.regF |= m_SZ35Table[m_CPURegisters.regs.regC];
-    m_CPURegisters.regs.regF |= m_ParityTable[m_CPURegisters.regs.regC];
+    m_CPURegisters.regs.regF |= SZ35Table[m_CPURegisters.regs.regC];
+    m_CPURegisters.regs.regF |= ParityTable[m_CPURegisters.regs.regC];
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OUT_off_C_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OUT_off_C_C(uint8_t)
 {
     m_MEMPTR = m_CPURegisters.reg_pairs.regBC + 1;
     Z80CoreIOWrite(m_CPURegisters.reg_pairs.regBC, m_CPURegisters.regs.regC);
@@ -105,7 +119,8 @@ void CZ80Core::OUT_off_C_C(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADC_HL_BC(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADC_HL_BC(uint8_t)
 {
     // Handle contention
     Z80CoreMemoryContention((m_CPURegisters.regI << 8) | m_CPURegisters.regR, 1);
@@ -121,7 +136,8 @@ void CZ80Core::ADC_HL_BC(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_BC_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_BC_off_nn(uint8_t)
 {
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
@@ -132,7 +148,8 @@ void CZ80Core::LD_BC_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RETI(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RETI(uint8_t)
 {
     m_CPURegisters.IFF1 = m_CPURegisters.IFF2;
 
@@ -144,7 +161,8 @@ void CZ80Core::RETI(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_R_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_R_A(uint8_t)
 {
     Z80CoreMemoryContention((m_CPURegisters.regI << 8) | m_CPURegisters.regR, 1);
     m_CPURegisters.regR = m_CPURegisters.regs.regA;
@@ -152,18 +170,22 @@ void CZ80Core::LD_R_A(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::IN_D_off_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::IN_D_off_C(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = m_CPURegisters.reg_pairs.regBC + 1;
     m_CPURegisters.regs.regD = Z80CoreIORead(m_CPURegisters.reg_pairs.regBC);
     m_CPURegisters.regs.regF &= FLAG_C;
-    m_CPURegisters.regs.regF |= m_SZ35Table[m_CPURegisters.regs.regD];
-    m_CPURegisters.regs.regF |= m_ParityTable[m_CPURegisters.regs.regD];
+    m_CPURegisters.regs.regF |= SZ35Table[m_CPURegisters.regs.regD];
+    m_CPURegisters.regs.regF |= ParityTable[m_CPURegisters.regs.regD];
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OUT_off_C_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OUT_off_C_D(uint8_t)
 {
     m_MEMPTR = m_CPURegisters.reg_pairs.regBC + 1;
     Z80CoreIOWrite(m_CPURegisters.reg_pairs.regBC, m_CPURegisters.regs.regD);
@@ -171,7 +193,8 @@ void CZ80Core::OUT_off_C_D(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SBC_HL_DE(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SBC_HL_DE(uint8_t)
 {
     // Handle contention
     Z80CoreMemoryContention((m_CPURegisters.regI << 8) | m_CPURegisters.regR, 1);
@@ -187,7 +210,8 @@ void CZ80Core::SBC_HL_DE(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_nn_DE(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_nn_DE(uint8_t)
 {
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
@@ -198,19 +222,23 @@ void CZ80Core::LD_off_nn_DE(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::IM_1(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::IM_1(uint8_t)
 {
     m_CPURegisters.IM = 1;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_I(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_I(uint8_t)
 {
+    EvaluateFlags();
+
     Z80CoreMemoryContention((m_CPURegisters.regI << 8) | m_CPURegisters.regR, 1);
     m_CPURegisters.regs.regA = m_CPURegisters.regI;
     m_CPURegisters.regs.regF = (m_CPURegisters.regs.regF & FLAG_C);
-    m_CPURegisters.regs.regF |= m_SZ35Table[m_CPURegisters.regs.regA];
+    m_CPURegisters.regs.regF |= SZ35Table[m_CPURegisters.regs.regA];
     m_CPURegisters.regs.regF |= (m_CPURegisters.IFF2 == 0) ? 0 : FLAG_V;
 
     m_Iff2_read = true;
@@ -220,18 +248,22 @@ void CZ80Core::LD_A_I(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::IN_E_off_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::IN_E_off_C(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = m_CPURegisters.reg_pairs.regBC + 1;
     m_CPURegisters.regs.regE = Z80CoreIORead(m_CPURegisters.reg_pairs.regBC);
     m_CPURegisters.regs.regF &= FLAG_C;
-    m_CPURegisters.regs.regF |= m_SZ35Table[m_CPURegisters.regs.regE];
-    m_CPURegisters.regs.regF |= m_ParityTable[m_CPURegisters.regs.regE];
+    m_CPURegisters.regs.regF |= SZ35Table[m_CPURegisters.regs.regE];
+    m_CPURegisters.regs.regF |= ParityTable[m_CPURegisters.regs.regE];
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OUT_off_C_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OUT_off_C_E(uint8_t)
 {
     m_MEMPTR = m_CPURegisters.reg_pairs.regBC + 1;
     Z80CoreIOWrite(m_CPURegisters.reg_pairs.regBC, m_CPURegisters.regs.regE);
@@ -239,7 +271,8 @@ void CZ80Core::OUT_off_C_E(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADC_HL_DE(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADC_HL_DE(uint8_t)
 {
     // Handle contention
     Z80CoreMemoryContention((m_CPURegisters.regI << 8) | m_CPURegisters.regR, 1);
@@ -255,7 +288,8 @@ void CZ80Core::ADC_HL_DE(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_DE_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_DE_off_nn(uint8_t)
 {
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
@@ -266,19 +300,23 @@ void CZ80Core::LD_DE_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::IM_2(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::IM_2(uint8_t)
 {
     m_CPURegisters.IM = 2;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_R(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_R(uint8_t)
 {
+    EvaluateFlags();
+
     Z80CoreMemoryContention((m_CPURegisters.regI << 8) | m_CPURegisters.regR, 1);
     m_CPURegisters.regs.regA = m_CPURegisters.regR;
     m_CPURegisters.regs.regF = (m_CPURegisters.regs.regF & FLAG_C);
-    m_CPURegisters.regs.regF |= m_SZ35Table[m_CPURegisters.regs.regA];
+    m_CPURegisters.regs.regF |= SZ35Table[m_CPURegisters.regs.regA];
     m_CPURegisters.regs.regF |= (m_CPURegisters.IFF2 == 0) ? 0 : FLAG_V;
 
     m_Iff2_read = true;
@@ -286,18 +324,22 @@ void CZ80Core::LD_A_R(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::IN_H_off_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::IN_H_off_C(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = m_CPURegisters.reg_pairs.regBC + 1;
     m_CPURegisters.regs.regH = Z80CoreIORead(m_CPURegisters.reg_pairs.regBC);
     m_CPURegisters.regs.regF &= FLAG_C;
-    m_CPURegisters.regs.regF |= m_SZ35Table[m_CPURegisters.regs.regH];
-    m_CPURegisters.regs.regF |= m_ParityTable[m_CPURegisters.regs.regH];
+    m_CPURegisters.regs.regF |= SZ35Table[m_CPURegisters.regs.regH];
+    m_CPURegisters.regs.regF |= ParityTable[m_CPURegisters.regs.regH];
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OUT_off_C_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OUT_off_C_H(uint8_t)
 {
     m_MEMPTR = m_CPURegisters.reg_pairs.regBC + 1;
     Z80CoreIOWrite(m_CPURegisters.reg_pairs.regBC, m_CPURegisters.regs.regH);
@@ -305,7 +347,8 @@ void CZ80Core::OUT_off_C_H(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SBC_HL_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SBC_HL_HL(uint8_t)
 {
     // Handle contention
     Z80CoreMemoryContention((m_CPURegisters.regI << 8) | m_CPURegisters.regR, 1);
@@ -321,8 +364,11 @@ void CZ80Core::SBC_HL_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RRD(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RRD(uint8_t)
 {
+    EvaluateFlags();
+
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -331,26 +377,30 @@ void CZ80Core::RRD(uint8_t)
     Z80CoreMemWrite(m_CPURegisters.reg_pairs.regHL, (m_CPURegisters.regs.regA << 4) | (t >> 4));
     m_CPURegisters.regs.regA = (m_CPURegisters.regs.regA & 0xf0) | (t & 0x0f);
     m_CPURegisters.regs.regF = m_CPURegisters.regs.regF & FLAG_C;
-    m_CPURegisters.regs.regF |= m_ParityTable[m_CPURegisters.regs.regA];
-    m_CPURegisters.regs.regF |= m_SZ35Table[m_CPURegisters.regs.regA];
+    m_CPURegisters.regs.regF |= ParityTable[m_CPURegisters.regs.regA];
+    m_CPURegisters.regs.regF |= SZ35Table[m_CPURegisters.regs.regA];
 
     m_MEMPTR = m_CPURegisters.reg_pairs.regHL + 1;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::IN_L_off_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::IN_L_off_C(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = m_CPURegisters.reg_pairs.regBC + 1;
     m_CPURegisters.regs.regL = Z80CoreIORead(m_CPURegisters.reg_pairs.regBC);
     m_CPURegisters.regs.regF &= FLAG_C;
-    m_CPURegisters.regs.regF |= m_SZ35Table[m_CPURegisters.regs.regL];
-    m_CPURegisters.regs.regF |= m_ParityTable[m_CPURegisters.regs.regL];
+    m_CPURegisters.regs.regF |= SZ35Table[m_CPURegisters.regs.regL];
+    m_CPURegisters.regs.regF |= ParityTable[m_CPURegisters.regs.regL];
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OUT_off_C_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OUT_off_C_L(uint8_t)
 {
     m_MEMPTR = m_CPURegisters.reg_pairs.regBC + 1;
     Z80CoreIOWrite(m_CPURegisters.reg_pairs.regBC, m_CPURegisters.regs.regL);
@@ -358,7 +408,8 @@ void CZ80Core::OUT_off_C_L(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADC_HL_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADC_HL_HL(uint8_t)
 {
     // Handle contention
     Z80CoreMemoryContention((m_CPURegisters.regI << 8) | m_CPURegisters.regR, 1);
@@ -374,8 +425,11 @@ void CZ80Core::ADC_HL_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RLD(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RLD(uint8_t)
 {
+    EvaluateFlags();
+
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -384,26 +438,30 @@ void CZ80Core::RLD(uint8_t)
     Z80CoreMemWrite(m_CPURegisters.reg_pairs.regHL, (m_CPURegisters.regs.regA & 0x0f) | (t << 4));
     m_CPURegisters.regs.regA = (m_CPURegisters.regs.regA & 0xf0) | (t >> 4);
     m_CPURegisters.regs.regF = m_CPURegisters.regs.regF & FLAG_C;
-    m_CPURegisters.regs.regF |= m_ParityTable[m_CPURegisters.regs.regA];
-    m_CPURegisters.regs.regF |= m_SZ35Table[m_CPURegisters.regs.regA];
+    m_CPURegisters.regs.regF |= ParityTable[m_CPURegisters.regs.regA];
+    m_CPURegisters.regs.regF |= SZ35Table[m_CPURegisters.regs.regA];
 
     m_MEMPTR = m_CPURegisters.reg_pairs.regHL + 1;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::IN_F_off_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::IN_F_off_C(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = m_CPURegisters.reg_pairs.regBC + 1;
     uint8_t t = Z80CoreIORead(m_CPURegisters.reg_pairs.regBC);
     m_CPURegisters.regs.regF &= FLAG_C;
-    m_CPURegisters.regs.regF |= m_SZ35Table[t];
-    m_CPURegisters.regs.regF |= m_ParityTable[t];
+    m_CPURegisters.regs.regF |= SZ35Table[t];
+    m_CPURegisters.regs.regF |= ParityTable[t];
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OUT_off_C_0(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OUT_off_C_0(uint8_t)
 {
     m_MEMPTR = m_CPURegisters.reg_pairs.regBC + 1;
     Z80CoreIOWrite(m_CPURegisters.reg_pairs.regBC, 0);
@@ -411,7 +469,8 @@ void CZ80Core::OUT_off_C_0(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SBC_HL_SP(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SBC_HL_SP(uint8_t)
 {
     // Handle contention
     Z80CoreMemoryContention((m_CPURegisters.regI << 8) | m_CPURegisters.regR, 1);
@@ -427,7 +486,8 @@ void CZ80Core::SBC_HL_SP(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_nn_SP(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_nn_SP(uint8_t)
 {
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
@@ -438,18 +498,22 @@ void CZ80Core::LD_off_nn_SP(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::IN_A_off_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::IN_A_off_C(uint8_t)
 {
+    EvaluateFlags();
+
     m_CPURegisters.regs.regA = Z80CoreIORead(m_CPURegisters.reg_pairs.regBC);
     m_MEMPTR = m_CPURegisters.reg_pairs.regBC + 1;
     m_CPURegisters.regs.regF &= FLAG_C;
-    m_CPURegisters.regs.regF |= m_SZ35Table[m_CPURegisters.regs.regA];
-    m_CPURegisters.regs.regF |= m_ParityTable[m_CPURegisters.regs.regA];
+    m_CPURegisters.regs.regF |= SZ35Table[m_CPURegisters.regs.regA];
+    m_CPURegisters.regs.regF |= ParityTable[m_CPURegisters.regs.regA];
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OUT_off_C_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OUT_off_C_A(uint8_t)
 {
     m_MEMPTR = m_CPURegisters.reg_pairs.regBC + 1;
     Z80CoreIOWrite(m_CPURegisters.reg_pairs.regBC, m_CPURegisters.regs.regA);
@@ -457,7 +521,8 @@ void CZ80Core::OUT_off_C_A(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADC_HL_SP(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADC_HL_SP(uint8_t)
 {
     // Handle contention
     Z80CoreMemoryContention((m_CPURegisters.regI << 8) | m_CPURegisters.regR, 1);
@@ -473,7 +538,8 @@ void CZ80Core::ADC_HL_SP(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_SP_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_SP_off_nn(uint8_t)
 {
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
@@ -484,8 +550,11 @@ void CZ80Core::LD_SP_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LDI(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LDI(uint8_t)
 {
+    EvaluateFlags();
+
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemWrite(m_CPURegisters.reg_pairs.regDE, t);
 
@@ -507,8 +576,11 @@ void CZ80Core::LDI(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CPI(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CPI(uint8_t)
 {
+    EvaluateFlags();
+
     static uint8_t halfcarry_lookup[] = { 0, 0, FLAG_H, 0, FLAG_H, 0, FLAG_H, FLAG_H };
 
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
@@ -543,8 +615,11 @@ void CZ80Core::CPI(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::INI(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::INI(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = m_CPURegisters.reg_pairs.regBC + 1;
 
     Z80CoreMemoryContention((m_CPURegisters.regI << 8) | m_CPURegisters.regR, 1);
@@ -555,16 +630,19 @@ void CZ80Core::INI(uint8_t)
 
     uint16_t temp = ((m_CPURegisters.regs.regC + 1) & 0xff) + t;
 
-    m_CPURegisters.regs.regF = m_SZ35Table[m_CPURegisters.regs.regB];
+    m_CPURegisters.regs.regF = SZ35Table[m_CPURegisters.regs.regB];
     m_CPURegisters.regs.regF |= ((t & 0x80) == 0x80) ? FLAG_N : 0;
     m_CPURegisters.regs.regF |= (temp > 255) ? (FLAG_H | FLAG_C) : 0;
-    m_CPURegisters.regs.regF |= m_ParityTable[((temp & 7) ^ m_CPURegisters.regs.regB)];
+    m_CPURegisters.regs.regF |= ParityTable[((temp & 7) ^ m_CPURegisters.regs.regB)];
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OUTI(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OUTI(uint8_t)
 {
+    EvaluateFlags();
+
     Z80CoreMemoryContention((m_CPURegisters.regI << 8) | m_CPURegisters.regR, 1);
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     m_CPURegisters.regs.regB--;
@@ -573,18 +651,21 @@ void CZ80Core::OUTI(uint8_t)
 
     uint16_t temp = m_CPURegisters.regs.regL + t;
 
-    m_CPURegisters.regs.regF = m_SZ35Table[m_CPURegisters.regs.regB];
+    m_CPURegisters.regs.regF = SZ35Table[m_CPURegisters.regs.regB];
     m_CPURegisters.regs.regF |= ((t & 0x80) == 0x80) ? FLAG_N : 0;
     m_CPURegisters.regs.regF |= (temp > 255) ? (FLAG_H | FLAG_C) : 0;
-    m_CPURegisters.regs.regF |= m_ParityTable[((temp & 7) ^ m_CPURegisters.regs.regB)];
+    m_CPURegisters.regs.regF |= ParityTable[((temp & 7) ^ m_CPURegisters.regs.regB)];
 
     m_MEMPTR = m_CPURegisters.reg_pairs.regBC + 1;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LDD(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LDD(uint8_t)
 {
+    EvaluateFlags();
+
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemWrite(m_CPURegisters.reg_pairs.regDE, t);
 
@@ -606,8 +687,11 @@ void CZ80Core::LDD(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CPD(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CPD(uint8_t)
 {
+    EvaluateFlags();
+
     static uint8_t halfcarry_lookup[] = { 0, 0, FLAG_H, 0, FLAG_H, 0, FLAG_H, FLAG_H };
 
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
@@ -642,8 +726,11 @@ void CZ80Core::CPD(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::IND(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::IND(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = m_CPURegisters.reg_pairs.regBC - 1;
 
     Z80CoreMemoryContention((m_CPURegisters.regI << 8) | m_CPURegisters.regR, 1);
@@ -654,16 +741,19 @@ void CZ80Core::IND(uint8_t)
 
     uint16_t temp = ((m_CPURegisters.regs.regC - 1) & 0xff) + t;
 
-    m_CPURegisters.regs.regF = m_SZ35Table[m_CPURegisters.regs.regB];
+    m_CPURegisters.regs.regF = SZ35Table[m_CPURegisters.regs.regB];
     m_CPURegisters.regs.regF |= ((t & 0x80) == 0x80) ? FLAG_N : 0;
     m_CPURegisters.regs.regF |= (temp > 255) ? (FLAG_H | FLAG_C) : 0;
-    m_CPURegisters.regs.regF |= m_ParityTable[((temp & 7) ^ m_CPURegisters.regs.regB)];
+    m_CPURegisters.regs.regF |= ParityTable[((temp & 7) ^ m_CPURegisters.regs.regB)];
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OUTD(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OUTD(uint8_t)
 {
+    EvaluateFlags();
+
     Z80CoreMemoryContention((m_CPURegisters.regI << 8) | m_CPURegisters.regR, 1);
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     m_CPURegisters.regs.regB--;
@@ -672,17 +762,18 @@ void CZ80Core::OUTD(uint8_t)
 
     uint16_t temp = m_CPURegisters.regs.regL + t;
 
-    m_CPURegisters.regs.regF = m_SZ35Table[m_CPURegisters.regs.regB];
+    m_CPURegisters.regs.regF = SZ35Table[m_CPURegisters.regs.regB];
     m_CPURegisters.regs.regF |= ((t & 0x80) == 0x80) ? FLAG_N : 0;
     m_CPURegisters.regs.regF |= (temp > 255) ? (FLAG_H | FLAG_C) : 0;
-    m_CPURegisters.regs.regF |= m_ParityTable[((temp & 7) ^ m_CPURegisters.regs.regB)];
+    m_CPURegisters.regs.regF |= ParityTable[((temp & 7) ^ m_CPURegisters.regs.regB)];
 
     m_MEMPTR = m_CPURegisters.reg_pairs.regBC - 1;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LDIR(uint8_t opcode)
+template <class Bus>
+void CZ80CoreT<Bus>::LDIR(uint8_t opcode)
 {
     LDI(opcode);
 
@@ -700,8 +791,11 @@ void CZ80Core::LDIR(uint8_t opcode)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CPIR(uint8_t opcode)
+template <class Bus>
+void CZ80CoreT<Bus>::CPIR(uint8_t opcode)
 {
+    EvaluateFlags();
+
     CPI(opcode);
 
     if (m_CPURegisters.reg_pairs.regBC != 0 && (m_CPURegisters.regs.regF & FLAG_Z) != FLAG_Z)
@@ -718,7 +812,8 @@ void CZ80Core::CPIR(uint8_t opcode)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::INIR(uint8_t opcode)
+template <class Bus>
+void CZ80CoreT<Bus>::INIR(uint8_t opcode)
 {
     INI(opcode);
 
@@ -735,7 +830,8 @@ void CZ80Core::INIR(uint8_t opcode)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OTIR(uint8_t opcode)
+template <class Bus>
+void CZ80CoreT<Bus>::OTIR(uint8_t opcode)
 {
     OUTI(opcode);
 
@@ -752,7 +848,8 @@ void CZ80Core::OTIR(uint8_t opcode)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LDDR(uint8_t opcode)
+template <class Bus>
+void CZ80CoreT<Bus>::LDDR(uint8_t opcode)
 {
     LDD(opcode);
 
@@ -770,8 +867,11 @@ void CZ80Core::LDDR(uint8_t opcode)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CPDR(uint8_t opcode)
+template <class Bus>
+void CZ80CoreT<Bus>::CPDR(uint8_t opcode)
 {
+    EvaluateFlags();
+
     CPD(opcode);
 
     if (m_CPURegisters.reg_pairs.regBC != 0 && (m_CPURegisters.regs.regF & FLAG_Z) != FLAG_Z)
@@ -788,7 +888,8 @@ void CZ80Core::CPDR(uint8_t opcode)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::INDR(uint8_t opcode)
+template <class Bus>
+void CZ80CoreT<Bus>::INDR(uint8_t opcode)
 {
     IND(opcode);
 
@@ -805,7 +906,8 @@ void CZ80Core::INDR(uint8_t opcode)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OTDR(uint8_t opcode)
+template <class Bus>
+void CZ80CoreT<Bus>::OTDR(uint8_t opcode)
 {
     OUTD(opcode);
 
@@ -822,3 +924,4 @@ void CZ80Core::OTDR(uint8_t opcode)
 
 //-----------------------------------------------------------------------------------------
 
+#include "Z80CoreInstances.h"
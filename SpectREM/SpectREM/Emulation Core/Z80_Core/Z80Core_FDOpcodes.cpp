@@ -3,7 +3,8 @@
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_IY_BC(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_IY_BC(uint8_t)
 {
     // Handle contention
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -19,7 +20,8 @@ void CZ80Core::ADD_IY_BC(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_IY_DE(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_IY_DE(uint8_t)
 {
     // Handle contention
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -35,7 +37,8 @@ void CZ80Core::ADD_IY_DE(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IY_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IY_nn(uint8_t)
 {
     m_CPURegisters.regs.regIYl = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_CPURegisters.regs.regIYh = Z80CoreMemRead(m_CPURegisters.regPC++);
@@ -43,7 +46,8 @@ void CZ80Core::LD_IY_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_nn_IY(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_nn_IY(uint8_t)
 {
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
@@ -54,7 +58,8 @@ void CZ80Core::LD_off_nn_IY(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::INC_IY(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::INC_IY(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -63,28 +68,32 @@ void CZ80Core::INC_IY(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::INC_IYh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::INC_IYh(uint8_t)
 {
     Inc(m_CPURegisters.regs.regIYh);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::DEC_IYh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::DEC_IYh(uint8_t)
 {
     Dec(m_CPURegisters.regs.regIYh);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IYh_n(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IYh_n(uint8_t)
 {
     m_CPURegisters.regs.regIYh = Z80CoreMemRead(m_CPURegisters.regPC++);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_IY_IY(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_IY_IY(uint8_t)
 {
     // Handle contention
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -100,7 +109,8 @@ void CZ80Core::ADD_IY_IY(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IY_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IY_off_nn(uint8_t)
 {
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
@@ -111,7 +121,8 @@ void CZ80Core::LD_IY_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::DEC_IY(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::DEC_IY(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -120,28 +131,32 @@ void CZ80Core::DEC_IY(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::INC_IYl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::INC_IYl(uint8_t)
 {
     Inc(m_CPURegisters.regs.regIYl);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::DEC_IYl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::DEC_IYl(uint8_t)
 {
     Dec(m_CPURegisters.regs.regIYl);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IYl_n(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IYl_n(uint8_t)
 {
     m_CPURegisters.regs.regIYl = Z80CoreMemRead(m_CPURegisters.regPC++);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::INC_off_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::INC_off_IY_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -157,7 +172,8 @@ void CZ80Core::INC_off_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::DEC_off_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::DEC_off_IY_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -173,7 +189,8 @@ void CZ80Core::DEC_off_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_IY_d_n(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_IY_d_n(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     uint8_t val = Z80CoreMemRead(m_CPURegisters.regPC++);
@@ -184,7 +201,8 @@ void CZ80Core::LD_off_IY_d_n(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_IY_SP(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_IY_SP(uint8_t)
 {
     // Handle contention
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -200,21 +218,24 @@ void CZ80Core::ADD_IY_SP(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_IYh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_IYh(uint8_t)
 {
     m_CPURegisters.regs.regB = m_CPURegisters.regs.regIYh;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_IYl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_IYl(uint8_t)
 {
     m_CPURegisters.regs.regB = m_CPURegisters.regs.regIYl;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_off_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_off_IY_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -227,21 +248,24 @@ void CZ80Core::LD_B_off_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_IYh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_IYh(uint8_t)
 {
     m_CPURegisters.regs.regC = m_CPURegisters.regs.regIYh;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_IYl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_IYl(uint8_t)
 {
     m_CPURegisters.regs.regC = m_CPURegisters.regs.regIYl;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_off_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_off_IY_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -254,21 +278,24 @@ void CZ80Core::LD_C_off_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_IYh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_IYh(uint8_t)
 {
     m_CPURegisters.regs.regD = m_CPURegisters.regs.regIYh;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_IYl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_IYl(uint8_t)
 {
     m_CPURegisters.regs.regD = m_CPURegisters.regs.regIYl;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_off_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_off_IY_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -281,21 +308,24 @@ void CZ80Core::LD_D_off_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_IYh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_IYh(uint8_t)
 {
     m_CPURegisters.regs.regE = m_CPURegisters.regs.regIYh;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_IYl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_IYl(uint8_t)
 {
     m_CPURegisters.regs.regE = m_CPURegisters.regs.regIYl;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_off_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_off_IY_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -308,49 +338,56 @@ void CZ80Core::LD_E_off_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IYh_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IYh_B(uint8_t)
 {
     m_CPURegisters.regs.regIYh = m_CPURegisters.regs.regB;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IYh_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IYh_C(uint8_t)
 {
     m_CPURegisters.regs.regIYh = m_CPURegisters.regs.regC;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IYh_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IYh_D(uint8_t)
 {
     m_CPURegisters.regs.regIYh = m_CPURegisters.regs.regD;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IYh_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IYh_E(uint8_t)
 {
     m_CPURegisters.regs.regIYh = m_CPURegisters.regs.regE;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IYh_IYh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IYh_IYh(uint8_t)
 {
     m_CPURegisters.regs.regIYh = m_CPURegisters.regs.regIYh;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IYh_IYl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IYh_IYl(uint8_t)
 {
     m_CPURegisters.regs.regIYh = m_CPURegisters.regs.regIYl;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_off_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_off_IY_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -363,56 +400,64 @@ void CZ80Core::LD_H_off_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IYh_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IYh_A(uint8_t)
 {
     m_CPURegisters.regs.regIYh = m_CPURegisters.regs.regA;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IYl_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IYl_B(uint8_t)
 {
     m_CPURegisters.regs.regIYl = m_CPURegisters.regs.regB;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IYl_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IYl_C(uint8_t)
 {
     m_CPURegisters.regs.regIYl = m_CPURegisters.regs.regC;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IYl_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IYl_D(uint8_t)
 {
     m_CPURegisters.regs.regIYl = m_CPURegisters.regs.regD;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IYl_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IYl_E(uint8_t)
 {
     m_CPURegisters.regs.regIYl = m_CPURegisters.regs.regE;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IYl_IYh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IYl_IYh(uint8_t)
 {
     m_CPURegisters.regs.regIYl = m_CPURegisters.regs.regIYh;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IYl_IYl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IYl_IYl(uint8_t)
 {
     m_CPURegisters.regs.regIYl = m_CPURegisters.regs.regIYl;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_off_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_off_IY_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -425,14 +470,16 @@ void CZ80Core::LD_L_off_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_IYl_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_IYl_A(uint8_t)
 {
     m_CPURegisters.regs.regIYl = m_CPURegisters.regs.regA;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_IY_d_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_IY_d_B(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -445,7 +492,8 @@ void CZ80Core::LD_off_IY_d_B(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_IY_d_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_IY_d_C(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -458,7 +506,8 @@ void CZ80Core::LD_off_IY_d_C(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_IY_d_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_IY_d_D(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -471,7 +520,8 @@ void CZ80Core::LD_off_IY_d_D(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_IY_d_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_IY_d_E(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -484,7 +534,8 @@ void CZ80Core::LD_off_IY_d_E(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_IY_d_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_IY_d_H(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -497,7 +548,8 @@ void CZ80Core::LD_off_IY_d_H(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_IY_d_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_IY_d_L(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -510,7 +562,8 @@ void CZ80Core::LD_off_IY_d_L(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_IY_d_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_IY_d_A(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -523,21 +576,24 @@ void CZ80Core::LD_off_IY_d_A(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_IYh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_IYh(uint8_t)
 {
     m_CPURegisters.regs.regA = m_CPURegisters.regs.regIYh;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_IYl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_IYl(uint8_t)
 {
     m_CPURegisters.regs.regA = m_CPURegisters.regs.regIYl;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_off_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_off_IY_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -550,21 +606,24 @@ void CZ80Core::LD_A_off_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_A_IYh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_A_IYh(uint8_t)
 {
     Add8(m_CPURegisters.regs.regIYh);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_A_IYl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_A_IYl(uint8_t)
 {
     Add8(m_CPURegisters.regs.regIYl);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_A_off_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_A_off_IY_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -578,21 +637,24 @@ void CZ80Core::ADD_A_off_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADC_A_IYh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADC_A_IYh(uint8_t)
 {
     Adc8(m_CPURegisters.regs.regIYh);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADC_A_IYl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADC_A_IYl(uint8_t)
 {
     Adc8(m_CPURegisters.regs.regIYl);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADC_A_off_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADC_A_off_IY_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -606,21 +668,24 @@ void CZ80Core::ADC_A_off_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SUB_A_IYh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SUB_A_IYh(uint8_t)
 {
     Sub8(m_CPURegisters.regs.regIYh);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SUB_A_IYl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SUB_A_IYl(uint8_t)
 {
     Sub8(m_CPURegisters.regs.regIYl);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SUB_A_off_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SUB_A_off_IY_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -634,21 +699,24 @@ void CZ80Core::SUB_A_off_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SBC_A_IYh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SBC_A_IYh(uint8_t)
 {
     Sbc8(m_CPURegisters.regs.regIYh);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SBC_A_IYl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SBC_A_IYl(uint8_t)
 {
     Sbc8(m_CPURegisters.regs.regIYl);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SBC_A_off_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SBC_A_off_IY_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -662,21 +730,24 @@ void CZ80Core::SBC_A_off_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::AND_IYh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::AND_IYh(uint8_t)
 {
     And(m_CPURegisters.regs.regIYh);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::AND_IYl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::AND_IYl(uint8_t)
 {
     And(m_CPURegisters.regs.regIYl);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::AND_off_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::AND_off_IY_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -690,21 +761,24 @@ void CZ80Core::AND_off_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::XOR_IYh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::XOR_IYh(uint8_t)
 {
     Xor(m_CPURegisters.regs.regIYh);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::XOR_IYl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::XOR_IYl(uint8_t)
 {
     Xor(m_CPURegisters.regs.regIYl);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::XOR_off_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::XOR_off_IY_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -718,21 +792,24 @@ void CZ80Core::XOR_off_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OR_IYh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OR_IYh(uint8_t)
 {
     Or(m_CPURegisters.regs.regIYh);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OR_IYl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OR_IYl(uint8_t)
 {
     Or(m_CPURegisters.regs.regIYl);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OR_off_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OR_off_IY_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -746,21 +823,24 @@ void CZ80Core::OR_off_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CP_IYh(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CP_IYh(uint8_t)
 {
     Cp(m_CPURegisters.regs.regIYh);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CP_IYl(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CP_IYl(uint8_t)
 {
     Cp(m_CPURegisters.regs.regIYl);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CP_off_IY_d(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CP_off_IY_d(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemoryContention(m_CPURegisters.regPC - 1, 1);
@@ -774,7 +854,8 @@ void CZ80Core::CP_off_IY_d(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::POP_IY(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::POP_IY(uint8_t)
 {
     m_CPURegisters.regs.regIYl = Z80CoreMemRead(m_CPURegisters.regSP++);
     m_CPURegisters.regs.regIYh = Z80CoreMemRead(m_CPURegisters.regSP++);
@@ -782,7 +863,8 @@ void CZ80Core::POP_IY(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::EX_off_SP_IY(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::EX_off_SP_IY(uint8_t)
 {
     uint8_t tl = Z80CoreMemRead(m_CPURegisters.regSP + 0);
     uint8_t th = Z80CoreMemRead(m_CPURegisters.regSP + 1);
@@ -799,7 +881,8 @@ void CZ80Core::EX_off_SP_IY(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::PUSH_IY(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::PUSH_IY(uint8_t)
 {
     Z80CoreMemoryContention((m_CPURegisters.regI << 8) | m_CPURegisters.regR, 1);
     Z80CoreMemWrite(--m_CPURegisters.regSP, m_CPURegisters.regs.regIYh);
@@ -808,14 +891,16 @@ void CZ80Core::PUSH_IY(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::JP_off_IY(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::JP_off_IY(uint8_t)
 {
     m_CPURegisters.regPC = m_CPURegisters.reg_pairs.regIY;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_SP_IY(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_SP_IY(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -824,3 +909,4 @@ void CZ80Core::LD_SP_IY(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
+#include "Z80CoreInstances.h"
@@ -3,14 +3,16 @@
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::NOP(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::NOP(uint8_t)
 {
     // Nothing to do...
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_BC_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_BC_nn(uint8_t)
 {
     m_CPURegisters.regs.regC = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_CPURegisters.regs.regB = Z80CoreMemRead(m_CPURegisters.regPC++);
@@ -18,7 +20,8 @@ void CZ80Core::LD_BC_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_BC_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_BC_A(uint8_t)
 {
     Z80CoreMemWrite(m_CPURegisters.reg_pairs.regBC, m_CPURegisters.regs.regA);
 
@@ -28,7 +31,8 @@ void CZ80Core::LD_off_BC_A(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::INC_BC(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::INC_BC(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -37,29 +41,35 @@ void CZ80Core::INC_BC(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::INC_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::INC_B(uint8_t)
 {
     Inc(m_CPURegisters.regs.regB);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::DEC_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::DEC_B(uint8_t)
 {
     Dec(m_CPURegisters.regs.regB);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_n(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_n(uint8_t)
 {
     m_CPURegisters.regs.regB = Z80CoreMemRead(m_CPURegisters.regPC++);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RLCA(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RLCA(uint8_t)
 {
+    EvaluateFlags();
+
     m_CPURegisters.regs.regA = (m_CPURegisters.regs.regA << 1) | (m_CPURegisters.regs.regA >> 7);
     m_CPURegisters.regs.regF = (m_CPURegisters.regs.regF & (FLAG_P | FLAG_Z | FLAG_S));
     m_CPURegisters.regs.regF |= (m_CPURegisters.regs.regA & 0x01) ? FLAG_C : 0;
@@ -68,8 +78,11 @@ void CZ80Core::RLCA(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::EX_AF_AF_(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::EX_AF_AF_(uint8_t)
 {
+    EvaluateFlags();
+
     uint16_t t = m_CPURegisters.reg_pairs.regAF;
     m_CPURegisters.reg_pairs.regAF = m_CPURegisters.reg_pairs.regAF_;
     m_CPURegisters.reg_pairs.regAF_ = t;
@@ -77,7 +90,8 @@ void CZ80Core::EX_AF_AF_(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_HL_BC(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_HL_BC(uint8_t)
 {
     // Handle contention
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -93,7 +107,8 @@ void CZ80Core::ADD_HL_BC(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_off_BC(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_off_BC(uint8_t)
 {
     m_CPURegisters.regs.regA = Z80CoreMemRead(m_CPURegisters.reg_pairs.regBC);
     m_MEMPTR = m_CPURegisters.reg_pairs.regBC + 1;
@@ -101,7 +116,8 @@ void CZ80Core::LD_A_off_BC(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::DEC_BC(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::DEC_BC(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -110,29 +126,35 @@ void CZ80Core::DEC_BC(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::INC_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::INC_C(uint8_t)
 {
     Inc(m_CPURegisters.regs.regC);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::DEC_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::DEC_C(uint8_t)
 {
     Dec(m_CPURegisters.regs.regC);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_n(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_n(uint8_t)
 {
     m_CPURegisters.regs.regC = Z80CoreMemRead(m_CPURegisters.regPC++);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RRCA(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RRCA(uint8_t)
 {
+    EvaluateFlags();
+
     m_CPURegisters.regs.regA = (m_CPURegisters.regs.regA >> 1) | (m_CPURegisters.regs.regA << 7);
     m_CPURegisters.regs.regF = (m_CPURegisters.regs.regF & (FLAG_P | FLAG_Z | FLAG_S));
     m_CPURegisters.regs.regF |= (m_CPURegisters.regs.regA & 0x80) ? FLAG_C : 0;
@@ -141,7 +163,8 @@ void CZ80Core::RRCA(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::DJNZ_off_PC_e(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::DJNZ_off_PC_e(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC);
@@ -166,7 +189,8 @@ void CZ80Core::DJNZ_off_PC_e(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_DE_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_DE_nn(uint8_t)
 {
     m_CPURegisters.regs.regE = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_CPURegisters.regs.regD = Z80CoreMemRead(m_CPURegisters.regPC++);
@@ -174,7 +198,8 @@ void CZ80Core::LD_DE_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_DE_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_DE_A(uint8_t)
 {
     Z80CoreMemWrite(m_CPURegisters.reg_pairs.regDE, m_CPURegisters.regs.regA);
 
@@ -184,7 +209,8 @@ void CZ80Core::LD_off_DE_A(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::INC_DE(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::INC_DE(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -193,29 +219,35 @@ void CZ80Core::INC_DE(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::INC_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::INC_D(uint8_t)
 {
     Inc(m_CPURegisters.regs.regD);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::DEC_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::DEC_D(uint8_t)
 {
     Dec(m_CPURegisters.regs.regD);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_n(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_n(uint8_t)
 {
     m_CPURegisters.regs.regD = Z80CoreMemRead(m_CPURegisters.regPC++);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RLA(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RLA(uint8_t)
 {
+    EvaluateFlags();
+
     uint8_t old_a = m_CPURegisters.regs.regA;
     m_CPURegisters.regs.regA = (m_CPURegisters.regs.regA << 1) | ((m_CPURegisters.regs.regF & FLAG_C) ? 0x01 : 0x00) ;
     m_CPURegisters.regs.regF = (m_CPURegisters.regs.regF & (FLAG_P | FLAG_Z | FLAG_S));
@@ -225,7 +257,8 @@ void CZ80Core::RLA(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::JR_off_PC_e(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::JR_off_PC_e(uint8_t)
 {
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC);
 
@@ -243,7 +276,8 @@ void CZ80Core::JR_off_PC_e(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_HL_DE(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_HL_DE(uint8_t)
 {
     // Handle contention
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -259,7 +293,8 @@ void CZ80Core::ADD_HL_DE(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_off_DE(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_off_DE(uint8_t)
 {
     m_CPURegisters.regs.regA = Z80CoreMemRead(m_CPURegisters.reg_pairs.regDE);
     m_MEMPTR = m_CPURegisters.reg_pairs.regDE + 1;
@@ -267,7 +302,8 @@ void CZ80Core::LD_A_off_DE(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::DEC_DE(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::DEC_DE(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -276,29 +312,35 @@ void CZ80Core::DEC_DE(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::INC_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::INC_E(uint8_t)
 {
     Inc(m_CPURegisters.regs.regE);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::DEC_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::DEC_E(uint8_t)
 {
     Dec(m_CPURegisters.regs.regE);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_n(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_n(uint8_t)
 {
     m_CPURegisters.regs.regE = Z80CoreMemRead(m_CPURegisters.regPC++);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RRA(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RRA(uint8_t)
 {
+    EvaluateFlags();
+
     uint8_t old_a = m_CPURegisters.regs.regA;
     m_CPURegisters.regs.regA = (m_CPURegisters.regs.regA >> 1) | ((m_CPURegisters.regs.regF & FLAG_C) ? 0x80 : 0x00);
     m_CPURegisters.regs.regF = (m_CPURegisters.regs.regF & (FLAG_P | FLAG_Z | FLAG_S));
@@ -308,8 +350,11 @@ void CZ80Core::RRA(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::JR_NZ_off_PC_e(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::JR_NZ_off_PC_e(uint8_t)
 {
+    EvaluateFlags();
+
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC);
 
     if ((m_CPURegisters.regs.regF & FLAG_Z) != FLAG_Z)
@@ -329,7 +374,8 @@ void CZ80Core::JR_NZ_off_PC_e(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_HL_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_HL_nn(uint8_t)
 {
 
     m_CPURegisters.regs.regL = Z80CoreMemRead(m_CPURegisters.regPC++);
@@ -338,7 +384,8 @@ void CZ80Core::LD_HL_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_nn_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_nn_HL(uint8_t)
 {
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
@@ -349,7 +396,8 @@ void CZ80Core::LD_off_nn_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::INC_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::INC_HL(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -358,29 +406,35 @@ void CZ80Core::INC_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::INC_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::INC_H(uint8_t)
 {
     Inc(m_CPURegisters.regs.regH);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::DEC_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::DEC_H(uint8_t)
 {
     Dec(m_CPURegisters.regs.regH);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_n(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_n(uint8_t)
 {
     m_CPURegisters.regs.regH = Z80CoreMemRead(m_CPURegisters.regPC++);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::DAA(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::DAA(uint8_t)
 {
+    EvaluateFlags();
+
     uint8_t daa_value = 0;
     uint8_t flags = (m_CPURegisters.regs.regF & FLAG_C);
 
@@ -408,15 +462,19 @@ void CZ80Core::DAA(uint8_t)
         Add8(daa_value);
     }
 
+    EvaluateFlags();
     m_CPURegisters.regs.regF &= ~(FLAG_C | FLAG_P);
     m_CPURegisters.regs.regF |= flags;
-    m_CPURegisters.regs.regF |= m_ParityTable[m_CPURegisters.regs.regA];
+    m_CPURegisters.regs.regF |= ParityTable[m_CPURegisters.regs.regA];
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::JR_Z_off_PC_e(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::JR_Z_off_PC_e(uint8_t)
 {
+    EvaluateFlags();
+
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC);
 
     if ((m_CPURegisters.regs.regF & FLAG_Z) == FLAG_Z)
@@ -436,7 +494,8 @@ void CZ80Core::JR_Z_off_PC_e(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_HL_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_HL_HL(uint8_t)
 {
     // Handle contention
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -452,7 +511,8 @@ void CZ80Core::ADD_HL_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_HL_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_HL_off_nn(uint8_t)
 {
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
@@ -464,7 +524,8 @@ void CZ80Core::LD_HL_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::DEC_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::DEC_HL(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -473,29 +534,35 @@ void CZ80Core::DEC_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::INC_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::INC_L(uint8_t)
 {
     Inc(m_CPURegisters.regs.regL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::DEC_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::DEC_L(uint8_t)
 {
     Dec(m_CPURegisters.regs.regL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_n(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_n(uint8_t)
 {
     m_CPURegisters.regs.regL = Z80CoreMemRead(m_CPURegisters.regPC++);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CPL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CPL(uint8_t)
 {
+    EvaluateFlags();
+
     m_CPURegisters.regs.regA ^= 0xff;
     m_CPURegisters.regs.regF &= (FLAG_C | FLAG_P | FLAG_Z | FLAG_S);
     m_CPURegisters.regs.regF |= (FLAG_N | FLAG_H);
@@ -504,8 +571,11 @@ void CZ80Core::CPL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::JR_NC_off_PC_e(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::JR_NC_off_PC_e(uint8_t)
 {
+    EvaluateFlags();
+
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC);
 
     if ((m_CPURegisters.regs.regF & FLAG_C) != FLAG_C)
@@ -525,7 +595,8 @@ void CZ80Core::JR_NC_off_PC_e(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_SP_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_SP_nn(uint8_t)
 {
     uint8_t t1 = Z80CoreMemRead(m_CPURegisters.regPC++);
     uint8_t t2 = Z80CoreMemRead(m_CPURegisters.regPC++);
@@ -535,7 +606,8 @@ void CZ80Core::LD_SP_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_nn_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_nn_A(uint8_t)
 {
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
@@ -548,7 +620,8 @@ void CZ80Core::LD_off_nn_A(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::INC_SP(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::INC_SP(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -557,7 +630,8 @@ void CZ80Core::INC_SP(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::INC_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::INC_off_HL(uint8_t)
 {
     uint8_t temp = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -567,7 +641,8 @@ void CZ80Core::INC_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::DEC_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::DEC_off_HL(uint8_t)
 {
     uint8_t temp = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Z80CoreMemoryContention(m_CPURegisters.reg_pairs.regHL, 1);
@@ -577,7 +652,8 @@ void CZ80Core::DEC_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_HL_n(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_HL_n(uint8_t)
 {
     uint8_t temp = Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreMemWrite(m_CPURegisters.reg_pairs.regHL, temp);
@@ -585,8 +661,11 @@ void CZ80Core::LD_off_HL_n(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SCF(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SCF(uint8_t)
 {
+    EvaluateFlags();
+
     if ( m_CPUType == eCPUTYPE_Zilog )
     {
         if ( m_PrevOpcodeFlags & OPCODEFLAG_AltersFlags )
@@ -620,8 +699,11 @@ void CZ80Core::SCF(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::JR_C_off_PC_e(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::JR_C_off_PC_e(uint8_t)
 {
+    EvaluateFlags();
+
     int8_t offset = Z80CoreMemRead(m_CPURegisters.regPC);
 
     if ((m_CPURegisters.regs.regF & FLAG_C) == FLAG_C)
@@ -641,7 +723,8 @@ void CZ80Core::JR_C_off_PC_e(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_HL_SP(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_HL_SP(uint8_t)
 {
     // Handle contention
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -657,7 +740,8 @@ void CZ80Core::ADD_HL_SP(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_off_nn(uint8_t)
 {
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
@@ -667,7 +751,8 @@ void CZ80Core::LD_A_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::DEC_SP(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::DEC_SP(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -676,29 +761,35 @@ void CZ80Core::DEC_SP(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::INC_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::INC_A(uint8_t)
 {
     Inc(m_CPURegisters.regs.regA);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::DEC_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::DEC_A(uint8_t)
 {
     Dec(m_CPURegisters.regs.regA);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_n(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_n(uint8_t)
 {
     m_CPURegisters.regs.regA = Z80CoreMemRead(m_CPURegisters.regPC++);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CCF(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CCF(uint8_t)
 {
+    EvaluateFlags();
+
     uint8_t tf = m_CPURegisters.regs.regF;
 
     if ( m_CPUType == eCPUTYPE_Zilog )
@@ -734,385 +825,440 @@ void CZ80Core::CCF(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_B(uint8_t)
 {
     m_CPURegisters.regs.regB = m_CPURegisters.regs.regB;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_C(uint8_t)
 {
     m_CPURegisters.regs.regB = m_CPURegisters.regs.regC;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_D(uint8_t)
 {
     m_CPURegisters.regs.regB = m_CPURegisters.regs.regD;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_E(uint8_t)
 {
     m_CPURegisters.regs.regB = m_CPURegisters.regs.regE;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_H(uint8_t)
 {
     m_CPURegisters.regs.regB = m_CPURegisters.regs.regH;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_L(uint8_t)
 {
     m_CPURegisters.regs.regB = m_CPURegisters.regs.regL;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_off_HL(uint8_t)
 {
     m_CPURegisters.regs.regB = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_B_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_B_A(uint8_t)
 {
     m_CPURegisters.regs.regB = m_CPURegisters.regs.regA;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_B(uint8_t)
 {
     m_CPURegisters.regs.regC = m_CPURegisters.regs.regB;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_C(uint8_t)
 {
     m_CPURegisters.regs.regC = m_CPURegisters.regs.regC;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_D(uint8_t)
 {
     m_CPURegisters.regs.regC = m_CPURegisters.regs.regD;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_E(uint8_t)
 {
     m_CPURegisters.regs.regC = m_CPURegisters.regs.regE;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_H(uint8_t)
 {
     m_CPURegisters.regs.regC = m_CPURegisters.regs.regH;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_L(uint8_t)
 {
     m_CPURegisters.regs.regC = m_CPURegisters.regs.regL;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_off_HL(uint8_t)
 {
     m_CPURegisters.regs.regC = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_C_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_C_A(uint8_t)
 {
     m_CPURegisters.regs.regC = m_CPURegisters.regs.regA;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_B(uint8_t)
 {
     m_CPURegisters.regs.regD = m_CPURegisters.regs.regB;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_C(uint8_t)
 {
     m_CPURegisters.regs.regD = m_CPURegisters.regs.regC;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_D(uint8_t)
 {
     m_CPURegisters.regs.regD = m_CPURegisters.regs.regD;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_E(uint8_t)
 {
     m_CPURegisters.regs.regD = m_CPURegisters.regs.regE;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_H(uint8_t)
 {
     m_CPURegisters.regs.regD = m_CPURegisters.regs.regH;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_L(uint8_t)
 {
     m_CPURegisters.regs.regD = m_CPURegisters.regs.regL;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_off_HL(uint8_t)
 {
     m_CPURegisters.regs.regD = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_D_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_D_A(uint8_t)
 {
     m_CPURegisters.regs.regD = m_CPURegisters.regs.regA;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_B(uint8_t)
 {
     m_CPURegisters.regs.regE = m_CPURegisters.regs.regB;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_C(uint8_t)
 {
     m_CPURegisters.regs.regE = m_CPURegisters.regs.regC;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_D(uint8_t)
 {
     m_CPURegisters.regs.regE = m_CPURegisters.regs.regD;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_E(uint8_t)
 {
     m_CPURegisters.regs.regE = m_CPURegisters.regs.regE;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_H(uint8_t)
 {
     m_CPURegisters.regs.regE = m_CPURegisters.regs.regH;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_L(uint8_t)
 {
     m_CPURegisters.regs.regE = m_CPURegisters.regs.regL;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_off_HL(uint8_t)
 {
     m_CPURegisters.regs.regE = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_E_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_E_A(uint8_t)
 {
     m_CPURegisters.regs.regE = m_CPURegisters.regs.regA;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_B(uint8_t)
 {
     m_CPURegisters.regs.regH = m_CPURegisters.regs.regB;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_C(uint8_t)
 {
     m_CPURegisters.regs.regH = m_CPURegisters.regs.regC;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_D(uint8_t)
 {
     m_CPURegisters.regs.regH = m_CPURegisters.regs.regD;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_E(uint8_t)
 {
     m_CPURegisters.regs.regH = m_CPURegisters.regs.regE;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_H(uint8_t)
 {
     m_CPURegisters.regs.regH = m_CPURegisters.regs.regH;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_L(uint8_t)
 {
     m_CPURegisters.regs.regH = m_CPURegisters.regs.regL;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_off_HL(uint8_t)
 {
     m_CPURegisters.regs.regH = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_H_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_H_A(uint8_t)
 {
     m_CPURegisters.regs.regH = m_CPURegisters.regs.regA;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_B(uint8_t)
 {
     m_CPURegisters.regs.regL = m_CPURegisters.regs.regB;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_C(uint8_t)
 {
     m_CPURegisters.regs.regL = m_CPURegisters.regs.regC;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_D(uint8_t)
 {
     m_CPURegisters.regs.regL = m_CPURegisters.regs.regD;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_E(uint8_t)
 {
     m_CPURegisters.regs.regL = m_CPURegisters.regs.regE;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_H(uint8_t)
 {
     m_CPURegisters.regs.regL = m_CPURegisters.regs.regH;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_L(uint8_t)
 {
     m_CPURegisters.regs.regL = m_CPURegisters.regs.regL;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_off_HL(uint8_t)
 {
     m_CPURegisters.regs.regL = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_L_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_L_A(uint8_t)
 {
     m_CPURegisters.regs.regL = m_CPURegisters.regs.regA;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_HL_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_HL_B(uint8_t)
 {
     Z80CoreMemWrite(m_CPURegisters.reg_pairs.regHL, m_CPURegisters.regs.regB);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_HL_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_HL_C(uint8_t)
 {
     Z80CoreMemWrite(m_CPURegisters.reg_pairs.regHL, m_CPURegisters.regs.regC);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_HL_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_HL_D(uint8_t)
 {
     Z80CoreMemWrite(m_CPURegisters.reg_pairs.regHL, m_CPURegisters.regs.regD);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_HL_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_HL_E(uint8_t)
 {
     Z80CoreMemWrite(m_CPURegisters.reg_pairs.regHL, m_CPURegisters.regs.regE);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_HL_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_HL_H(uint8_t)
 {
     Z80CoreMemWrite(m_CPURegisters.reg_pairs.regHL, m_CPURegisters.regs.regH);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_HL_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_HL_L(uint8_t)
 {
     Z80CoreMemWrite(m_CPURegisters.reg_pairs.regHL, m_CPURegisters.regs.regL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::HALT(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::HALT(uint8_t)
 {
     m_CPURegisters.Halted = 1;
     m_CPURegisters.regPC--;
@@ -1120,77 +1266,88 @@ void CZ80Core::HALT(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_off_HL_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_off_HL_A(uint8_t)
 {
     Z80CoreMemWrite(m_CPURegisters.reg_pairs.regHL, m_CPURegisters.regs.regA);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_B(uint8_t)
 {
     m_CPURegisters.regs.regA = m_CPURegisters.regs.regB;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_C(uint8_t)
 {
     m_CPURegisters.regs.regA = m_CPURegisters.regs.regC;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_D(uint8_t)
 {
     m_CPURegisters.regs.regA = m_CPURegisters.regs.regD;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_E(uint8_t)
 {
     m_CPURegisters.regs.regA = m_CPURegisters.regs.regE;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_H(uint8_t)
 {
     m_CPURegisters.regs.regA = m_CPURegisters.regs.regH;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_L(uint8_t)
 {
     m_CPURegisters.regs.regA = m_CPURegisters.regs.regL;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_off_HL(uint8_t)
 {
     m_CPURegisters.regs.regA = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_A_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_A_A(uint8_t)
 {
     m_CPURegisters.regs.regA = m_CPURegisters.regs.regA;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_A_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_A_B(uint8_t)
 {
     Add8(m_CPURegisters.regs.regB);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_A_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_A_C(uint8_t)
 {
     Add8(m_CPURegisters.regs.regC);
 
@@ -1198,35 +1355,40 @@ void CZ80Core::ADD_A_C(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_A_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_A_D(uint8_t)
 {
     Add8(m_CPURegisters.regs.regD);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_A_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_A_E(uint8_t)
 {
     Add8(m_CPURegisters.regs.regE);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_A_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_A_H(uint8_t)
 {
     Add8(m_CPURegisters.regs.regH);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_A_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_A_L(uint8_t)
 {
     Add8(m_CPURegisters.regs.regL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_A_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_A_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Add8(t);
@@ -1234,56 +1396,64 @@ void CZ80Core::ADD_A_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_A_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_A_A(uint8_t)
 {
     Add8(m_CPURegisters.regs.regA);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADC_A_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADC_A_B(uint8_t)
 {
     Adc8(m_CPURegisters.regs.regB);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADC_A_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADC_A_C(uint8_t)
 {
     Adc8(m_CPURegisters.regs.regC);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADC_A_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADC_A_D(uint8_t)
 {
     Adc8(m_CPURegisters.regs.regD);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADC_A_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADC_A_E(uint8_t)
 {
     Adc8(m_CPURegisters.regs.regE);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADC_A_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADC_A_H(uint8_t)
 {
     Adc8(m_CPURegisters.regs.regH);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADC_A_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADC_A_L(uint8_t)
 {
     Adc8(m_CPURegisters.regs.regL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADC_A_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADC_A_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Adc8(t);
@@ -1291,56 +1461,64 @@ void CZ80Core::ADC_A_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADC_A_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADC_A_A(uint8_t)
 {
     Adc8(m_CPURegisters.regs.regA);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SUB_A_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SUB_A_B(uint8_t)
 {
     Sub8(m_CPURegisters.regs.regB);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SUB_A_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SUB_A_C(uint8_t)
 {
     Sub8(m_CPURegisters.regs.regC);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SUB_A_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SUB_A_D(uint8_t)
 {
     Sub8(m_CPURegisters.regs.regD);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SUB_A_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SUB_A_E(uint8_t)
 {
     Sub8(m_CPURegisters.regs.regE);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SUB_A_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SUB_A_H(uint8_t)
 {
     Sub8(m_CPURegisters.regs.regH);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SUB_A_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SUB_A_L(uint8_t)
 {
     Sub8(m_CPURegisters.regs.regL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SUB_A_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SUB_A_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Sub8(t);
@@ -1348,56 +1526,64 @@ void CZ80Core::SUB_A_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SUB_A_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SUB_A_A(uint8_t)
 {
     Sub8(m_CPURegisters.regs.regA);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SBC_A_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SBC_A_B(uint8_t)
 {
     Sbc8(m_CPURegisters.regs.regB);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SBC_A_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SBC_A_C(uint8_t)
 {
     Sbc8(m_CPURegisters.regs.regC);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SBC_A_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SBC_A_D(uint8_t)
 {
     Sbc8(m_CPURegisters.regs.regD);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SBC_A_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SBC_A_E(uint8_t)
 {
     Sbc8(m_CPURegisters.regs.regE);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SBC_A_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SBC_A_H(uint8_t)
 {
     Sbc8(m_CPURegisters.regs.regH);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SBC_A_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SBC_A_L(uint8_t)
 {
     Sbc8(m_CPURegisters.regs.regL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SBC_A_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SBC_A_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Sbc8(t);
@@ -1405,56 +1591,64 @@ void CZ80Core::SBC_A_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SBC_A_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SBC_A_A(uint8_t)
 {
     Sbc8(m_CPURegisters.regs.regA);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::AND_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::AND_B(uint8_t)
 {
     And(m_CPURegisters.regs.regB);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::AND_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::AND_C(uint8_t)
 {
     And(m_CPURegisters.regs.regC);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::AND_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::AND_D(uint8_t)
 {
     And(m_CPURegisters.regs.regD);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::AND_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::AND_E(uint8_t)
 {
     And(m_CPURegisters.regs.regE);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::AND_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::AND_H(uint8_t)
 {
     And(m_CPURegisters.regs.regH);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::AND_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::AND_L(uint8_t)
 {
     And(m_CPURegisters.regs.regL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::AND_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::AND_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     And(t);
@@ -1462,56 +1656,64 @@ void CZ80Core::AND_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::AND_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::AND_A(uint8_t)
 {
     And(m_CPURegisters.regs.regA);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::XOR_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::XOR_B(uint8_t)
 {
     Xor(m_CPURegisters.regs.regB);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::XOR_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::XOR_C(uint8_t)
 {
     Xor(m_CPURegisters.regs.regC);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::XOR_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::XOR_D(uint8_t)
 {
     Xor(m_CPURegisters.regs.regD);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::XOR_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::XOR_E(uint8_t)
 {
     Xor(m_CPURegisters.regs.regE);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::XOR_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::XOR_H(uint8_t)
 {
     Xor(m_CPURegisters.regs.regH);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::XOR_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::XOR_L(uint8_t)
 {
     Xor(m_CPURegisters.regs.regL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::XOR_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::XOR_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Xor(t);
@@ -1519,56 +1721,64 @@ void CZ80Core::XOR_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::XOR_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::XOR_A(uint8_t)
 {
     Xor(m_CPURegisters.regs.regA);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OR_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OR_B(uint8_t)
 {
     Or(m_CPURegisters.regs.regB);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OR_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OR_C(uint8_t)
 {
     Or(m_CPURegisters.regs.regC);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OR_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OR_D(uint8_t)
 {
     Or(m_CPURegisters.regs.regD);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OR_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OR_E(uint8_t)
 {
 Or(m_CPURegisters.regs.regE);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OR_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OR_H(uint8_t)
 {
     Or(m_CPURegisters.regs.regH);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OR_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OR_L(uint8_t)
 {
     Or(m_CPURegisters.regs.regL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OR_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OR_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Or(t);
@@ -1576,56 +1786,64 @@ void CZ80Core::OR_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OR_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OR_A(uint8_t)
 {
     Or(m_CPURegisters.regs.regA);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CP_B(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CP_B(uint8_t)
 {
     Cp(m_CPURegisters.regs.regB);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CP_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CP_C(uint8_t)
 {
     Cp(m_CPURegisters.regs.regC);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CP_D(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CP_D(uint8_t)
 {
     Cp(m_CPURegisters.regs.regD);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CP_E(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CP_E(uint8_t)
 {
     Cp(m_CPURegisters.regs.regE);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CP_H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CP_H(uint8_t)
 {
     Cp(m_CPURegisters.regs.regH);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CP_L(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CP_L(uint8_t)
 {
     Cp(m_CPURegisters.regs.regL);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CP_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CP_off_HL(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.reg_pairs.regHL);
     Cp(t);
@@ -1633,15 +1851,19 @@ void CZ80Core::CP_off_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CP_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CP_A(uint8_t)
 {
     Cp(m_CPURegisters.regs.regA);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RET_NZ(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RET_NZ(uint8_t)
 {
+    EvaluateFlags();
+
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
 
     if ((m_CPURegisters.regs.regF & FLAG_Z) != FLAG_Z)
@@ -1655,7 +1877,8 @@ void CZ80Core::RET_NZ(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::POP_BC(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::POP_BC(uint8_t)
 {
     m_CPURegisters.regs.regC = Z80CoreMemRead(m_CPURegisters.regSP++);
     m_CPURegisters.regs.regB = Z80CoreMemRead(m_CPURegisters.regSP++);
@@ -1663,8 +1886,11 @@ void CZ80Core::POP_BC(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::JP_NZ_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::JP_NZ_off_nn(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
 
@@ -1676,7 +1902,8 @@ void CZ80Core::JP_NZ_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::JP_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::JP_off_nn(uint8_t)
 {
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
@@ -1686,8 +1913,11 @@ void CZ80Core::JP_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CALL_NZ_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CALL_NZ_off_nn(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
 
@@ -1703,7 +1933,8 @@ void CZ80Core::CALL_NZ_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::PUSH_BC(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::PUSH_BC(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemWrite(--m_CPURegisters.regSP, m_CPURegisters.regs.regB);
@@ -1712,7 +1943,8 @@ void CZ80Core::PUSH_BC(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADD_A_n(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADD_A_n(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.regPC++);
     Add8(t);
@@ -1720,7 +1952,8 @@ void CZ80Core::ADD_A_n(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RST_0H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RST_0H(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemWrite(--m_CPURegisters.regSP, (m_CPURegisters.regPC >> 8) & 0xff);
@@ -1732,8 +1965,11 @@ void CZ80Core::RST_0H(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RET_Z(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RET_Z(uint8_t)
 {
+    EvaluateFlags();
+
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
 
     if ((m_CPURegisters.regs.regF & FLAG_Z) == FLAG_Z)
@@ -1747,7 +1983,8 @@ void CZ80Core::RET_Z(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RET(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RET(uint8_t)
 {
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regSP++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regSP++) << 8;
@@ -1757,8 +1994,11 @@ void CZ80Core::RET(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::JP_Z_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::JP_Z_off_nn(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
 
@@ -1770,8 +2010,11 @@ void CZ80Core::JP_Z_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CALL_Z_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CALL_Z_off_nn(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
 
@@ -1787,7 +2030,8 @@ void CZ80Core::CALL_Z_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CALL_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CALL_off_nn(uint8_t)
 {
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
@@ -1801,7 +2045,8 @@ void CZ80Core::CALL_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::ADC_A_n(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::ADC_A_n(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.regPC++);
     Adc8(t);
@@ -1809,7 +2054,8 @@ void CZ80Core::ADC_A_n(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RST_8H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RST_8H(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemWrite(--m_CPURegisters.regSP, (m_CPURegisters.regPC >> 8) & 0xff);
@@ -1821,8 +2067,11 @@ void CZ80Core::RST_8H(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RET_NC(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RET_NC(uint8_t)
 {
+    EvaluateFlags();
+
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
 
     if ((m_CPURegisters.regs.regF & FLAG_C) != FLAG_C)
@@ -1836,7 +2085,8 @@ void CZ80Core::RET_NC(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::POP_DE(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::POP_DE(uint8_t)
 {
     m_CPURegisters.regs.regE = Z80CoreMemRead(m_CPURegisters.regSP++);
     m_CPURegisters.regs.regD = Z80CoreMemRead(m_CPURegisters.regSP++);
@@ -1844,8 +2094,11 @@ void CZ80Core::POP_DE(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::JP_NC_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::JP_NC_off_nn(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
 
@@ -1857,7 +2110,8 @@ void CZ80Core::JP_NC_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OUT_off_n_A(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OUT_off_n_A(uint8_t)
 {
     uint16_t address = (((uint16_t)m_CPURegisters.regs.regA) << 8) | Z80CoreMemRead(m_CPURegisters.regPC++);
     Z80CoreIOWrite(address, m_CPURegisters.regs.regA);
@@ -1867,8 +2121,11 @@ void CZ80Core::OUT_off_n_A(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CALL_NC_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CALL_NC_off_nn(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
 
@@ -1884,7 +2141,8 @@ void CZ80Core::CALL_NC_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::PUSH_DE(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::PUSH_DE(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemWrite(--m_CPURegisters.regSP, m_CPURegisters.regs.regD);
@@ -1893,7 +2151,8 @@ void CZ80Core::PUSH_DE(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SUB_A_n(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SUB_A_n(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.regPC++);
     Sub8(t);
@@ -1901,7 +2160,8 @@ void CZ80Core::SUB_A_n(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RST_10H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RST_10H(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemWrite(--m_CPURegisters.regSP, (m_CPURegisters.regPC >> 8) & 0xff);
@@ -1913,8 +2173,11 @@ void CZ80Core::RST_10H(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RET_C(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RET_C(uint8_t)
 {
+    EvaluateFlags();
+
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
 
     if ((m_CPURegisters.regs.regF & FLAG_C) == FLAG_C)
@@ -1928,7 +2191,8 @@ void CZ80Core::RET_C(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::EXX(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::EXX(uint8_t)
 {
     uint16_t t = m_CPURegisters.reg_pairs.regBC;
     m_CPURegisters.reg_pairs.regBC = m_CPURegisters.reg_pairs.regBC_;
@@ -1945,8 +2209,11 @@ void CZ80Core::EXX(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::JP_C_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::JP_C_off_nn(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
 
@@ -1958,7 +2225,8 @@ void CZ80Core::JP_C_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::IN_A_off_n(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::IN_A_off_n(uint8_t)
 {
     m_MEMPTR = (((uint16_t)m_CPURegisters.regs.regA) << 8) | Z80CoreMemRead(m_CPURegisters.regPC++);
     m_CPURegisters.regs.regA = Z80CoreIORead(m_MEMPTR++);
@@ -1966,8 +2234,11 @@ void CZ80Core::IN_A_off_n(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CALL_C_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CALL_C_off_nn(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
 
@@ -1983,7 +2254,8 @@ void CZ80Core::CALL_C_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::SBC_A_n(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::SBC_A_n(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.regPC++);
     Sbc8(t);
@@ -1991,7 +2263,8 @@ void CZ80Core::SBC_A_n(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RST_18H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RST_18H(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemWrite(--m_CPURegisters.regSP, (m_CPURegisters.regPC >> 8) & 0xff);
@@ -2003,8 +2276,11 @@ void CZ80Core::RST_18H(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RET_PO(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RET_PO(uint8_t)
 {
+    EvaluateFlags();
+
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
 
     if ((m_CPURegisters.regs.regF & FLAG_P) != FLAG_P)
@@ -2018,7 +2294,8 @@ void CZ80Core::RET_PO(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::POP_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::POP_HL(uint8_t)
 {
     m_CPURegisters.regs.regL = Z80CoreMemRead(m_CPURegisters.regSP++);
     m_CPURegisters.regs.regH = Z80CoreMemRead(m_CPURegisters.regSP++);
@@ -2026,8 +2303,11 @@ void CZ80Core::POP_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::JP_PO_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::JP_PO_off_nn(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
 
@@ -2039,7 +2319,8 @@ void CZ80Core::JP_PO_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::EX_off_SP_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::EX_off_SP_HL(uint8_t)
 {
     uint8_t tl = Z80CoreMemRead(m_CPURegisters.regSP + 0);
     uint8_t th = Z80CoreMemRead(m_CPURegisters.regSP + 1);
@@ -2056,8 +2337,11 @@ void CZ80Core::EX_off_SP_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CALL_PO_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CALL_PO_off_nn(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
 
@@ -2073,7 +2357,8 @@ void CZ80Core::CALL_PO_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::PUSH_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::PUSH_HL(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemWrite(--m_CPURegisters.regSP, m_CPURegisters.regs.regH);
@@ -2082,7 +2367,8 @@ void CZ80Core::PUSH_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::AND_n(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::AND_n(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.regPC++);
     And(t);
@@ -2090,7 +2376,8 @@ void CZ80Core::AND_n(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RST_20H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RST_20H(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemWrite(--m_CPURegisters.regSP, (m_CPURegisters.regPC >> 8) & 0xff);
@@ -2102,8 +2389,11 @@ void CZ80Core::RST_20H(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RET_PE(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RET_PE(uint8_t)
 {
+    EvaluateFlags();
+
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
 
     if ((m_CPURegisters.regs.regF & FLAG_P) == FLAG_P)
@@ -2117,15 +2407,19 @@ void CZ80Core::RET_PE(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::JP_off_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::JP_off_HL(uint8_t)
 {
     m_CPURegisters.regPC = m_CPURegisters.reg_pairs.regHL;
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::JP_PE_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::JP_PE_off_nn(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
 
@@ -2137,7 +2431,8 @@ void CZ80Core::JP_PE_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::EX_DE_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::EX_DE_HL(uint8_t)
 {
     uint16_t t = m_CPURegisters.reg_pairs.regHL;
     m_CPURegisters.reg_pairs.regHL = m_CPURegisters.reg_pairs.regDE;
@@ -2146,8 +2441,11 @@ void CZ80Core::EX_DE_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CALL_PE_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CALL_PE_off_nn(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
 
@@ -2163,7 +2461,8 @@ void CZ80Core::CALL_PE_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::XOR_n(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::XOR_n(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.regPC++);
     Xor(t);
@@ -2171,7 +2470,8 @@ void CZ80Core::XOR_n(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RST_28H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RST_28H(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemWrite(--m_CPURegisters.regSP, (m_CPURegisters.regPC >> 8) & 0xff);
@@ -2183,8 +2483,11 @@ void CZ80Core::RST_28H(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RET_P(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RET_P(uint8_t)
 {
+    EvaluateFlags();
+
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
 
     if ((m_CPURegisters.regs.regF & FLAG_S) != FLAG_S)
@@ -2198,16 +2501,22 @@ void CZ80Core::RET_P(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::POP_AF(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::POP_AF(uint8_t)
 {
+    EvaluateFlags();
+
     m_CPURegisters.regs.regF = Z80CoreMemRead(m_CPURegisters.regSP++);
     m_CPURegisters.regs.regA = Z80CoreMemRead(m_CPURegisters.regSP++);
 }
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::JP_P_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::JP_P_off_nn(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
 
@@ -2219,7 +2528,8 @@ void CZ80Core::JP_P_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::DI(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::DI(uint8_t)
 {
     m_CPURegisters.IFF1 = 0;
     m_CPURegisters.IFF2 = 0;
@@ -2227,8 +2537,11 @@ void CZ80Core::DI(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CALL_P_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CALL_P_off_nn(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
 
@@ -2244,8 +2557,11 @@ void CZ80Core::CALL_P_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::PUSH_AF(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::PUSH_AF(uint8_t)
 {
+    EvaluateFlags();
+
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemWrite(--m_CPURegisters.regSP, m_CPURegisters.regs.regA);
     Z80CoreMemWrite(--m_CPURegisters.regSP, m_CPURegisters.regs.regF);
@@ -2253,7 +2569,8 @@ void CZ80Core::PUSH_AF(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::OR_n(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::OR_n(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.regPC++);
     Or(t);
@@ -2261,7 +2578,8 @@ void CZ80Core::OR_n(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RST_30H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RST_30H(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemWrite(--m_CPURegisters.regSP, (m_CPURegisters.regPC >> 8) & 0xff);
@@ -2273,8 +2591,11 @@ void CZ80Core::RST_30H(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RET_M(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RET_M(uint8_t)
 {
+    EvaluateFlags();
+
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
 
     if ((m_CPURegisters.regs.regF & FLAG_S) == FLAG_S)
@@ -2288,7 +2609,8 @@ void CZ80Core::RET_M(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::LD_SP_HL(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::LD_SP_HL(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
@@ -2297,8 +2619,11 @@ void CZ80Core::LD_SP_HL(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::JP_M_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::JP_M_off_nn(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
 
@@ -2310,7 +2635,8 @@ void CZ80Core::JP_M_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::EI(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::EI(uint8_t)
 {
     m_CPURegisters.IFF1 = 1;
     m_CPURegisters.IFF2 = 1;
@@ -2319,8 +2645,11 @@ void CZ80Core::EI(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CALL_M_off_nn(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CALL_M_off_nn(uint8_t)
 {
+    EvaluateFlags();
+
     m_MEMPTR = Z80CoreMemRead(m_CPURegisters.regPC++);
     m_MEMPTR |= Z80CoreMemRead(m_CPURegisters.regPC++) << 8;
 
@@ -2336,7 +2665,8 @@ void CZ80Core::CALL_M_off_nn(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::CP_n(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::CP_n(uint8_t)
 {
     uint8_t t = Z80CoreMemRead(m_CPURegisters.regPC++);
     Cp(t);
@@ -2344,7 +2674,8 @@ void CZ80Core::CP_n(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
-void CZ80Core::RST_38H(uint8_t)
+template <class Bus>
+void CZ80CoreT<Bus>::RST_38H(uint8_t)
 {
     Z80CoreMemoryContention(static_cast<uint16_t>((m_CPURegisters.regI << 8) | m_CPURegisters.regR), 1);
     Z80CoreMemWrite(--m_CPURegisters.regSP, (m_CPURegisters.regPC >> 8) & 0xff);
@@ -2356,3 +2687,4 @@ void CZ80Core::RST_38H(uint8_t)
 
 //-----------------------------------------------------------------------------------------
 
+#include "Z80CoreInstances.h"
@@ -17,6 +17,11 @@
 static const char *cDEFAULT_ROM_0 = "128-0.ROM";
 static const char *cDEFAULT_ROM_1 = "128-1.ROM";
 
+// ROM addresses trapped to support instant tape loading and saving
+static const uint16_t cLOAD_TRAP_ADDRESS_1 = 0x056b;
+static const uint16_t cLOAD_TRAP_ADDRESS_2 = 0x0111;
+static const uint16_t cSAVE_TRAP_ADDRESS = 0x04d0;
+
 // - Constructor/Destructor
 
 ZXSpectrum128::ZXSpectrum128(Tape *t) : ZXSpectrum()
@@ -50,6 +55,10 @@ void ZXSpectrum128::initialise(string romPath)
     // Register an opcode callback function with the Z80 core so that opcodes can be intercepted
     // when handling things like ROM saving and loading
     z80Core.RegisterOpcodeCallback(opcodeCallback);
+    z80Core.ClearOpcodeTraps();
+    z80Core.AddOpcodeTrap(cLOAD_TRAP_ADDRESS_1);
+    z80Core.AddOpcodeTrap(cLOAD_TRAP_ADDRESS_2);
+    z80Core.AddOpcodeTrap(cSAVE_TRAP_ADDRESS);
     
     loadROM( cDEFAULT_ROM_0, 0 );
     loadROM( cDEFAULT_ROM_1, 1 );
@@ -66,14 +75,7 @@ void ZXSpectrum128::initialise(string romPath)
 
 uint8_t ZXSpectrum128::coreIORead(uint16_t address)
 {
-    bool contended = false;
-    int memoryPage = address / cMEMORY_PAGE_SIZE;
-    
-    if (machineInfo.hasPaging && (memoryPage == 1 || (memoryPage == 3 && (emuRAMPage == 1 || emuRAMPage == 3 || emuRAMPage == 5 || emuRAMPage == 7))))
-    {
-        contended = true;
-    }
-    
+    bool contended = memoryContendedSlot[address >> cMEMORY_SLOT_SHIFT];
     ZXSpectrum::ULAApplyIOContention(address, contended);
     
     // ULA Un-owned ports
@@ -129,16 +131,19 @@ uint8_t ZXSpectrum128::coreIORead(uint16_t address)
 
 void ZXSpectrum128::coreIOWrite(uint16_t address, uint8_t data)
 {
-    bool contended = false;
-    int memoryPage = address / cMEMORY_PAGE_SIZE;
-    
-    if (machineInfo.hasPaging && (memoryPage == 1 || (memoryPage == 3 && (emuRAMPage == 1 || emuRAMPage == 3 || emuRAMPage == 5 || emuRAMPage == 7))))
+    bool contended = memoryContendedSlot[address >> cMEMORY_SLOT_SHIFT];
+    ZXSpectrum::ULAApplyIOContention(address, contended);
+
+    // Bring the audio output up to date before the beeper, AY or SpecDRUM output is changed
+    audioUpdateWithTs(z80Core.GetTStates() - emuCurrentAudioTs);
+
+    // A machine writing to the ULA or AY data port is doing more than idling. The 128k editor pages between the ROMs
+    // and selects the AY IO port registers while it waits for a key, so those writes are left to the memory checks
+    if (!(address & 0x01) || (address & 0xc002) == 0x8000)
     {
-        contended = true;
+        idleReset();
     }
 
-    ZXSpectrum::ULAApplyIOContention(address, contended);
-    
     // Port: 0xFE
     //   7   6   5   4   3   2   1   0
     // +---+---+---+---+---+-----------+
@@ -149,7 +154,7 @@ void ZXSpectrum128::coreIOWrite(uint16_t address, uint8_t data)
         displayUpdateWithTs((z80Core.GetTStates() - emuCurrentDisplayTs) + machineInfo.borderDrawingOffset);
         audioEarBit = (data & 0x10) ? 1 : 0;
         audioMicBit = (data & 0x08) ? 1 : 0;
-        displayBorderColor = data & 0x07;
+        displaySetBorderColor(data & 0x07);
     }
     
     // AY-3-8912 ports
@@ -176,9 +181,13 @@ void ZXSpectrum128::UpdatePort7FFD(uint8_t data)
     // Save the last byte set, used when generating a Z80 snapshot
     ULAPortnnFDValue = data;
     
-    if (emuDisplayPage != (((data & 0x08ul) == 0x08ul) ? 7ul : 5ul))
+    // Nothing drawn from the old screen can be kept when the screen being displayed changes
+    uint32_t displayPage = ((data & 0x08) == 0x08) ? 7 : 5;
+    if (emuDisplayPage != displayPage)
     {
         displayUpdateWithTs((z80Core.GetTStates() - emuCurrentDisplayTs) + machineInfo.borderDrawingOffset);
+        emuDisplayPage = displayPage;
+        displayInvalidate();
     }
     
     // You should only be able to disable paging once. To enable paging again then a reset is necessary.
@@ -189,123 +198,103 @@ void ZXSpectrum128::UpdatePort7FFD(uint8_t data)
     
     emuROMPage = ((data & 0x10) == 0x10) ? 1 : 0;
     emuRAMPage = (data & 0x07);
-    emuDisplayPage = ((data & 0x08) == 0x08) ? 7 : 5;
     
+    memoryBuildMap();
+}
+
+void ZXSpectrum128::memoryBuildMap()
+{
+    // The 16K page in each quarter of the address space. Page 5 is always at 0x4000 and page 2 at 0x8000
+    uint8_t *pages[4] = {
+        const_cast<uint8_t *>(memoryRomPage[ emuROMPage ]),
+        memoryRamPage[ 5 ],
+        memoryRamPage[ 2 ],
+        memoryRamPage[ emuRAMPage ]
+    };
+    
+    // Pages 2 and 5 can also be paged in at 0xc000. Opcodes aren't decoded ahead of time from either address while they
+    // are, and anything decoded from them beforehand is dropped as it could be changed through the other address
+    bool aliased = (emuRAMPage == 2 || emuRAMPage == 5);
+    if (aliased && memoryCodeSlot[6] != nullptr)
+    {
+        z80Core.InvalidateDecodeCache();
+    }
+    
+    for (uint32_t slot = 0; slot < cMEMORY_SLOTS; slot++)
+    {
+        uint32_t memoryPage = slot / 2;
+        uint8_t *memory = pages[ memoryPage ] + ((slot & 1) * cMEMORY_SLOT_SIZE);
+        
+        // ROM writes are ignored and writes to the screen being displayed, which is in the first half of page 5 or 7,
+        // need the display brought up to date first, so both are left to coreMemoryWrite along with writes to RAM pages
+        // shared with a clone
+        bool screen = memoryRamPageForSlot(slot) == emuDisplayPage && !(slot & 1);
+        bool direct = memoryPage >= 1 && !screen && !memoryRamShared[ memoryRamPageForSlot(slot) ];
+        memoryReadSlot[slot] = memory;
+        memoryWriteSlot[slot] = direct ? memory : nullptr;
+        memoryCodeSlot[slot] = (aliased && pages[ memoryPage ] == pages[ 3 ]) ? nullptr : memory;
+        
+        // Odd RAM pages are contended, which includes page 5 at 0x4000
+        memoryContendedSlot[slot] = machineInfo.hasContention && (memoryPage == 1 || (memoryPage == 3 && (emuRAMPage & 1)));
+    }
 }
 
 // - Memory Read/Write
 
 void ZXSpectrum128::coreMemoryWrite(uint16_t address, uint8_t data)
 {
-    int memoryPage = address / cMEMORY_PAGE_SIZE;
-    address &= 16383;
-
-    if (memoryPage == 0)
+    uint32_t slot = address >> cMEMORY_SLOT_SHIFT;
+    
+    // ROM
+    if (slot < 2)
     {
         return;
     }
-    else if (memoryPage == 1)
+    
+    // The screen being displayed, which can be page 5 at 0x4000 or either page 5 or 7 at 0xc000
+    uint32_t page = memoryRamPageForSlot(slot);
+    if (page == emuDisplayPage && (address & (cMEMORY_PAGE_SIZE - 1)) < cBITMAP_SIZE + cATTR_SIZE)
     {
         displayUpdateWithTs((z80Core.GetTStates() - emuCurrentDisplayTs) + machineInfo.paperDrawingOffset);
-        memoryRam[(5 * cMEMORY_PAGE_SIZE) + address] = data;
-    }
-    else if (memoryPage == 2)
-    {
-        memoryRam[(2 * cMEMORY_PAGE_SIZE) + address] = data;
-    }
-    else if (memoryPage == 3)
-    {
-        memoryRam[(emuRAMPage * cMEMORY_PAGE_SIZE) + address] = data;
+        displayMarkDirty(page, address & (cMEMORY_PAGE_SIZE - 1));
     }
+    
+    memoryRamWritablePage(page)[address & (cMEMORY_PAGE_SIZE - 1)] = data;
 }
 
 uint8_t ZXSpectrum128::coreMemoryRead(uint16_t address)
 {
-    int page = address / cMEMORY_PAGE_SIZE;
-    address &= 16383;
-
-    if (page == 0)
-    {
-        return (memoryRom[(emuROMPage * cMEMORY_PAGE_SIZE) + address]);
-    }
-    else if (page == 1)
-    {
-        return (memoryRam[(5 * cMEMORY_PAGE_SIZE) + address]);
-    }
-    else if (page == 2)
-    {
-        return (memoryRam[(2 * cMEMORY_PAGE_SIZE) + address]);
-    }
-    else if (page == 3)
-    {
-        return (memoryRam[(emuRAMPage * cMEMORY_PAGE_SIZE) + address]);
-    }
-    
-    return 0;
+    return memoryReadSlot[address >> cMEMORY_SLOT_SHIFT][address & (cMEMORY_SLOT_SIZE - 1)];
 }
 
 // - Debug Memory Read/Write
 
 void ZXSpectrum128::coreDebugWrite(uint16_t address, uint8_t byte, void *)
 {
-    int memoryPage = address / cMEMORY_PAGE_SIZE;
-    address &= 16383;
+    uint32_t slot = address >> cMEMORY_SLOT_SHIFT;
     
-    if (memoryPage == 0)
+    // ROM
+    if (slot < 2)
     {
         return;
     }
-    else if (memoryPage == 1)
-    {
-        memoryRam[(5 * cMEMORY_PAGE_SIZE) + address] = byte;
-    }
-    else if (memoryPage == 2)
-    {
-        memoryRam[(2 * cMEMORY_PAGE_SIZE) + address] = byte;
-    }
-    else if (memoryPage == 3)
-    {
-        memoryRam[(emuRAMPage * cMEMORY_PAGE_SIZE) + address] = byte;
-    }
+    
+    displayMarkDirty(memoryRamPageForSlot(slot), address & (cMEMORY_PAGE_SIZE - 1));
+    memoryRamWritablePage(memoryRamPageForSlot(slot))[address & (cMEMORY_PAGE_SIZE - 1)] = byte;
 }
 
 uint8_t ZXSpectrum128::coreDebugRead(uint16_t address, void *)
 {
-    int page = address / cMEMORY_PAGE_SIZE;
-    address &= 16383;
-    
-    if (page == 0)
-    {
-        return (memoryRom[(emuROMPage * cMEMORY_PAGE_SIZE) + address]);
-    }
-    else if (page == 1)
-    {
-        return (memoryRam[(5 * cMEMORY_PAGE_SIZE) + address]);
-    }
-    else if (page == 2)
-    {
-        return (memoryRam[(2 * cMEMORY_PAGE_SIZE) + address]);
-    }
-    else if (page == 3)
-    {
-        return (memoryRam[(emuRAMPage * cMEMORY_PAGE_SIZE) + address]);
-    }
-    
-    return 0;
+    return memoryReadSlot[address >> cMEMORY_SLOT_SHIFT][address & (cMEMORY_SLOT_SIZE - 1)];
 }
 
-// - Memory Contention
+// - Clone
 
-void ZXSpectrum128::coreMemoryContention(uint16_t address, uint32_t)
+ZXSpectrum *ZXSpectrum128::clone()
 {
-    int memoryPage = address / cMEMORY_PAGE_SIZE;
-    
-    if (memoryPage == 1 ||
-        (memoryPage == 3 &&
-          (emuRAMPage == 1 || emuRAMPage == 3 || emuRAMPage == 5 || emuRAMPage == 7)))
-    {
-        z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates() % machineInfo.tsPerFrame] );
-    }
+    ZXSpectrum128 *machine = new ZXSpectrum128(*this);
+    emuFinishClone(machine);
+    return machine;
 }
 
 // - Release/Reset
@@ -336,10 +325,18 @@ bool ZXSpectrum128::opcodeCallback(uint8_t opcode, uint16_t address, void *param
 {
     ZXSpectrum128 *machine = static_cast<ZXSpectrum128*>(param);
     
+    // The tape routines being trapped only exist in the 48k BASIC ROM
+    if (machine->emuROMPage != 1)
+    {
+        machine->emuSaveTrapTriggered = false;
+        machine->emuLoadTrapTriggered = false;
+        return false;
+    }
+    
     if (machine->emuTapeInstantLoad)
     {
         // Trap ROM tap LOADING
-        if (address == 0x056b || address == 0x0111)
+        if (address == cLOAD_TRAP_ADDRESS_1 || address == cLOAD_TRAP_ADDRESS_2)
         {
             if (opcode == 0xc0)
             {
@@ -351,7 +348,7 @@ bool ZXSpectrum128::opcodeCallback(uint8_t opcode, uint16_t address, void *param
     }
     
     // Trap ROM tape SAVING
-    if (opcode == 0x08 && address == 0x04d0)
+    if (opcode == 0x08 && address == cSAVE_TRAP_ADDRESS)
     {
         if (opcode == 0x08)
         {
@@ -23,10 +23,10 @@ public:
     virtual void            release() override;
     virtual void            resetMachine(bool hard = true) override;
     virtual void            resetToSnapLoad() override;
+    virtual ZXSpectrum      *clone() override;
 
     virtual void            coreMemoryWrite(uint16_t address, uint8_t data) override;
     virtual uint8_t         coreMemoryRead(uint16_t address) override;
-    virtual void            coreMemoryContention(uint16_t address, uint32_t tStates) override;
     virtual uint8_t         coreIORead(uint16_t address) override;
     virtual void            coreIOWrite(uint16_t address, uint8_t data) override;
     
@@ -36,7 +36,11 @@ public:
     static bool             opcodeCallback(uint8_t opcode, uint16_t address, void *param);
 
     void                    UpdatePort7FFD(uint8_t data);
-    
+    virtual void            memoryBuildMap() override;
+
+private:
+    // The RAM page paged in at a slot above the ROM
+    uint32_t                memoryRamPageForSlot(uint32_t slot) const { return (slot < 4) ? 5 : (slot < 6) ? 2 : emuRAMPage; }
 };
 
 #endif /* ZXSpectrum128_hpp */
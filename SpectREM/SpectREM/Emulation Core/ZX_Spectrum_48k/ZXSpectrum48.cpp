@@ -17,13 +17,16 @@ static const int cROM_SIZE = 16384;
 static const char *cDEFAULT_ROM = "48.ROM";
 static const char *cSMART_ROM = "snapload.v31";
 
+// ROM addresses trapped to support instant tape loading and saving
+static const uint16_t cLOAD_TRAP_ADDRESS_1 = 0x056b;
+static const uint16_t cLOAD_TRAP_ADDRESS_2 = 0x0111;
+static const uint16_t cSAVE_TRAP_ADDRESS = 0x04d0;
+
 // SmartCard ROM and sundries
 static const uint8_t cFAFB_ROM_SWITCHOUT = 0x40;
 static const uint8_t cFAF3_SRAM_ENABLE = 0x80;
-
-static uint8_t smartCardPortFAF3 = 0;
-static uint8_t smartCardPortFAFB = 0;
-static uint8_t smartCardSRAM[8 * 64 * 1024];		// 8 * 8k banks, mapped @ $2000-$3FFF
+static const uint8_t cFAF3_SRAM_BANK = 0x07;
+static const uint32_t cSMART_SRAM_SIZE = 8 * 8192;    // 8 * 8k banks, mapped @ $2000-$3FFF
 
 // - Constructor/Destructor
 
@@ -53,26 +56,27 @@ void ZXSpectrum48::initialise(string romPath)
     std::cout << "ZXSpectrum48::initialise(char *rom)" << std::endl;
     
     machineInfo = machines[ eZXSpectrum48 ];
+
+    // The default ROM is looked up once here, as the SmartCard pages it back in from inside coreMemoryRead
+    emuROMPath = romPath;
+    defaultROM = findROM( cDEFAULT_ROM );
+
     ZXSpectrum::initialise( romPath );
 
     // Register an opcode callback function with the Z80 core so that opcodes can be intercepted
     // when handling things like ROM saving and loading
     z80Core.RegisterOpcodeCallback( ZXSpectrum48::opcodeCallback );
-    
-    loadROM( cDEFAULT_ROM, 0 );
+    z80Core.ClearOpcodeTraps();
+    z80Core.AddOpcodeTrap(cLOAD_TRAP_ADDRESS_1);
+    z80Core.AddOpcodeTrap(cLOAD_TRAP_ADDRESS_2);
+    z80Core.AddOpcodeTrap(cSAVE_TRAP_ADDRESS);
 }
 
 // - ULA
 
 uint8_t ZXSpectrum48::coreIORead(uint16_t address)
 {
-    bool contended = false;
-    int memoryPage = address / cMEMORY_PAGE_SIZE;
-    if (memoryPage == 1)
-    {
-        contended = true;
-    }
-    
+    bool contended = memoryContendedSlot[address >> cMEMORY_SLOT_SHIFT];
     ZXSpectrum::ULAApplyIOContention(address, contended);
         
     // ULA Un-owned ports
@@ -132,15 +136,15 @@ uint8_t ZXSpectrum48::coreIORead(uint16_t address)
 
 void ZXSpectrum48::coreIOWrite(uint16_t address, uint8_t data)
 {
-    bool contended = false;
-    int memoryPage = address / cMEMORY_PAGE_SIZE;
-    if (memoryPage == 1)
-    {
-        contended = true;
-    }
-    
+    bool contended = memoryContendedSlot[address >> cMEMORY_SLOT_SHIFT];
     ZXSpectrum::ULAApplyIOContention(address, contended);
 
+    // Bring the audio output up to date before the beeper, AY or SpecDRUM output is changed
+    audioUpdateWithTs(z80Core.GetTStates() - emuCurrentAudioTs);
+
+    // A machine writing to a port is doing more than idling
+    idleReset();
+
     // ULA owned ports
     if (!(address & 0x01))
     {
@@ -153,7 +157,7 @@ void ZXSpectrum48::coreIOWrite(uint16_t address, uint8_t data)
         // +---+---+---+---+---+-----------+
         audioEarBit = (data & 0x10) ? 1 : 0;
         audioMicBit = (data & 0x08) ? 1 : 0;
-        displayBorderColor = data & 0x07;
+        displaySetBorderColor(data & 0x07);
 
         //        qDebug() << static_cast<int>(audioEarBit)  ;
     }
@@ -182,24 +186,39 @@ void ZXSpectrum48::coreIOWrite(uint16_t address, uint8_t data)
 	{
 		if(address == 0xfaf3)
 		{
-			smartCardPortFAF3 = data;
+			smartCardWritePortFAF3(data);
+			memoryBuildMap();
 		}
 		else if(address == 0xfafb)
 		{
 			smartCardPortFAFB = data;
+			memoryBuildMap();
 		}
 	}
 }
 
+// - SmartCard
+
+void ZXSpectrum48::smartCardWritePortFAF3(uint8_t data)
+{
+    // Most machines never see a SmartCard so the SRAM is not allocated until it is first paged in
+    if ((data & cFAF3_SRAM_ENABLE) && smartCardSRAM.empty())
+    {
+        smartCardSRAM.resize(cSMART_SRAM_SIZE);
+    }
+
+    smartCardPortFAF3 = data;
+}
+
 // - Memory Read/Write
 
 void ZXSpectrum48::coreMemoryWrite(uint16_t address, uint8_t data)
 {
     if (address < cROM_SIZE)
     {
-		if ((smartCardPortFAF3 & 0x80) && address >= 8192 && address < 16384)
+		if ((smartCardPortFAF3 & cFAF3_SRAM_ENABLE) && address >= 8192 && address < 16384)
 		{
-			smartCardSRAM[ (address - 8192) + ((smartCardPortFAF3 & 0x07) * 8192) ] = data;
+			smartCardSRAM[ (address - 8192) + ((smartCardPortFAF3 & cFAF3_SRAM_BANK) * 8192) ] = data;
 		}
 		
         return;
@@ -207,6 +226,7 @@ void ZXSpectrum48::coreMemoryWrite(uint16_t address, uint8_t data)
     
     if (address >= cROM_SIZE && address < cBITMAP_ADDRESS + cBITMAP_SIZE + cATTR_SIZE){
         displayUpdateWithTs(static_cast<int32_t>((z80Core.GetTStates() - emuCurrentDisplayTs) + machineInfo.paperDrawingOffset));
+        displayMarkDirty(address >> cMEMORY_PAGE_SHIFT, address & (cMEMORY_PAGE_SIZE - 1));
     }
 
     if (debugOpCallbackBlock != nullptr)
@@ -219,16 +239,16 @@ void ZXSpectrum48::coreMemoryWrite(uint16_t address, uint8_t data)
     
     breakpointHit = false;
 
-    memoryRam[ address ] = static_cast<char>(data);
+    memoryRamWrite(address, data);
 }
 
 uint8_t ZXSpectrum48::coreMemoryRead(uint16_t address)
 {
     if (address < cROM_SIZE)
     {
-		if ((smartCardPortFAF3 & 0x80) && address >= 8192 && address < 16384)
+		if ((smartCardPortFAF3 & cFAF3_SRAM_ENABLE) && address >= 8192 && address < 16384)
 		{
-			return smartCardSRAM[  (address - 8192) + ((smartCardPortFAF3 & 0x07) * 8192) ];
+			return smartCardSRAM[  (address - 8192) + ((smartCardPortFAF3 & cFAF3_SRAM_BANK) * 8192) ];
 		}
 		if((address & 0xff) == 0x72)
 		{
@@ -236,8 +256,8 @@ uint8_t ZXSpectrum48::coreMemoryRead(uint16_t address)
 			{
                 smartCardPortFAFB &= ~cFAFB_ROM_SWITCHOUT;
                 smartCardPortFAF3 &= ~cFAF3_SRAM_ENABLE;
-                uint8_t retOpCode = static_cast<uint8_t>(memoryRom[ address ]);
-                loadROM( cDEFAULT_ROM, 0 );
+                uint8_t retOpCode = memoryRomPage[0][ address ];
+                memorySetROM( defaultROM, 0 );
 				return retOpCode;
 			}
 		}
@@ -251,7 +271,7 @@ uint8_t ZXSpectrum48::coreMemoryRead(uint16_t address)
         }
 
         breakpointHit = false;
-        return static_cast<uint8_t>(memoryRom[address]);
+        return memoryRomPage[0][address];
     }
 
     if (debugOpCallbackBlock != nullptr)
@@ -259,7 +279,7 @@ uint8_t ZXSpectrum48::coreMemoryRead(uint16_t address)
         debugOpCallbackBlock( address, eDebugReadOp );
     }
 
-    return static_cast<uint8_t>(memoryRam[ address ]);
+    return memoryRamRead(address);
 }
 
 // - Debug Memory Read/Write
@@ -268,32 +288,86 @@ uint8_t ZXSpectrum48::coreDebugRead(uint16_t address, void *)
 {
     if (address < cROM_SIZE)
     {
-        return static_cast<uint8_t>(memoryRom[address]);
+        return memoryRomPage[0][address];
     }
     
-    return static_cast<uint8_t>(memoryRam[address]);
+    return memoryRamRead(address);
 }
 
 void ZXSpectrum48::coreDebugWrite(uint16_t address, uint8_t byte, void *)
 {
     if (address < cROM_SIZE)
     {
-        memoryRom[address] = static_cast<char>(byte);
+        memoryWriteROM(0, address, byte);
     }
     else
     {
-        memoryRam[address] = static_cast<char>(byte);
+        displayMarkDirty(address >> cMEMORY_PAGE_SHIFT, address & (cMEMORY_PAGE_SIZE - 1));
+        memoryRamWrite(address, byte);
     }
 }
 
-// - Memory Contention
+// - Memory Map
 
-void ZXSpectrum48::coreMemoryContention(uint16_t address, uint32_t)
+void ZXSpectrum48::memoryBuildMap()
 {
-    if (address >= 16384 && address <= 32767)
+    // ROM slots are never written through, see below
+    uint8_t *rom = const_cast<uint8_t *>(memoryRomPage[0]);
+    
+    for (uint32_t slot = 0; slot < cMEMORY_SLOTS; slot++)
     {
-        z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates() % machineInfo.tsPerFrame] );
+        uint32_t address = slot * cMEMORY_SLOT_SIZE;
+        
+        if (address < cROM_SIZE)
+        {
+            // ROM writes are left to coreMemoryWrite, as are reads while the SmartCard is waiting to switch the ROM out
+            memoryReadSlot[slot] = (smartCardPortFAFB & cFAFB_ROM_SWITCHOUT) ? nullptr : rom + address;
+            memoryWriteSlot[slot] = nullptr;
+        }
+        else
+        {
+            // Screen writes are left to coreMemoryWrite so the display can be brought up to date first, along with
+            // writes to pages shared with a clone
+            uint32_t page = address >> cMEMORY_PAGE_SHIFT;
+            uint8_t *memory = memoryRamPage[ page ] + (address & (cMEMORY_PAGE_SIZE - 1));
+            bool screen = (address < cBITMAP_ADDRESS + cBITMAP_SIZE + cATTR_SIZE);
+            memoryReadSlot[slot] = memory;
+            memoryWriteSlot[slot] = (screen || memoryRamShared[ page ]) ? nullptr : memory;
+        }
+        
+        memoryContendedSlot[slot] = (machineInfo.hasContention && address >= 16384 && address < 32768);
     }
+    
+    // The SmartCard SRAM banks are paged in at 0x2000 - 0x3fff
+    if (smartCardPortFAF3 & cFAF3_SRAM_ENABLE)
+    {
+        memoryReadSlot[1] = smartCardSRAM.data() + ((smartCardPortFAF3 & cFAF3_SRAM_BANK) * cMEMORY_SLOT_SIZE);
+        memoryWriteSlot[1] = memoryReadSlot[1];
+    }
+    
+    // The debugger is called for every memory access so nothing can go straight to memory
+    if (debugOpCallbackBlock != nullptr)
+    {
+        for (uint32_t slot = 0; slot < cMEMORY_SLOTS; slot++)
+        {
+            memoryReadSlot[slot] = nullptr;
+            memoryWriteSlot[slot] = nullptr;
+        }
+    }
+    
+    for (uint32_t slot = 0; slot < cMEMORY_SLOTS; slot++)
+    {
+        memoryCodeSlot[slot] = memoryReadSlot[slot];
+    }
+}
+
+// - Clone
+
+ZXSpectrum *ZXSpectrum48::clone()
+{
+    ZXSpectrum48 *machine = new ZXSpectrum48(*this);
+    emuFinishClone(machine);
+    return machine;
 }
 
 // - Release/Reset
@@ -307,11 +381,11 @@ void ZXSpectrum48::resetMachine(bool hard)
 {
     if (hard)
     {
-        // If a hard reset is requested, reload the default ROM and make sure that the smart card
+        // If a hard reset is requested, page the default ROM back in and make sure that the smart card
         // ROM switch is disabled along with the smart card SRAM
-        loadROM( cDEFAULT_ROM, 0 );
         smartCardPortFAFB &= ~cFAFB_ROM_SWITCHOUT;
         smartCardPortFAF3 &= ~cFAF3_SRAM_ENABLE;
+        memorySetROM( defaultROM, 0 );
     }
 
     emuDisplayPage = 1;
@@ -329,12 +403,11 @@ void ZXSpectrum48::resetToSnapLoad()
 bool ZXSpectrum48::opcodeCallback(uint8_t opcode, uint16_t address, void *param)
 {
     ZXSpectrum48 *machine = static_cast<ZXSpectrum48*>(param);
-    CZ80Core core = machine->z80Core;
     
     if (machine->emuTapeInstantLoad)
     {
         // Trap ROM tap LOADING
-        if (address == 0x056b || address == 0x0111)
+        if (address == cLOAD_TRAP_ADDRESS_1 || address == cLOAD_TRAP_ADDRESS_2)
         {
             if (opcode == 0xc0)
             {
@@ -346,7 +419,7 @@ bool ZXSpectrum48::opcodeCallback(uint8_t opcode, uint16_t address, void *param)
     }
     
     // Trap ROM tape SAVING
-    if (opcode == 0x08 && address == 0x04d0)
+    if (opcode == 0x08 && address == cSAVE_TRAP_ADDRESS)
     {
         if (opcode == 0x08)
         {
@@ -22,17 +22,30 @@ public:
     virtual void            release() override;
     virtual void            resetMachine(bool hard = true) override;
     virtual void            resetToSnapLoad() override;
+    virtual ZXSpectrum      *clone() override;
     
     virtual void            coreMemoryWrite(uint16_t address, uint8_t data) override;
     virtual uint8_t         coreMemoryRead(uint16_t address) override;
-    virtual void            coreMemoryContention(uint16_t address, uint32_t tStates) override;
     virtual uint8_t         coreIORead(uint16_t address) override;
     virtual void            coreIOWrite(uint16_t address, uint8_t data) override;
     
     virtual uint8_t         coreDebugRead(uint16_t address, void *data) override;
     virtual void            coreDebugWrite(uint16_t address, uint8_t byte, void *data) override;
     
+    virtual void            memoryBuildMap() override;
+    
     static bool             opcodeCallback(uint8_t opcode, uint16_t address, void *param);
+
+private:
+    void                    smartCardWritePortFAF3(uint8_t data);
+
+    // Retroleum SmartCard state. The SRAM is only allocated the first time it is paged in
+    uint8_t                 smartCardPortFAF3 = 0;
+    uint8_t                 smartCardPortFAFB = 0;
+    vector<uint8_t>         smartCardSRAM;
+
+    // ROM image paged back in by a hard reset and by the SmartCard switching its own ROM out
+    shared_ptr<const ROMImage> defaultROM;
 };
 
 #endif /* ZXSpectrum48_h */
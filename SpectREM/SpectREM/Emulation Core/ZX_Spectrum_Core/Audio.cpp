@@ -51,6 +51,7 @@ void ZXSpectrum::audioReset()
     
     audioBuffer = new int16_t[ audioBufferSize ]();
     audioBufferIndex = 0;
+    emuCurrentAudioTs = z80Core.GetTStates();
     audioTsCounter = 0;
     audioTsStepCounter = 0;
 	audioOutputLevelLeft = 0;
@@ -82,6 +83,8 @@ void ZXSpectrum::audioReset()
 
 void ZXSpectrum::audioUpdateWithTs(uint32_t tStates)
 {
+    emuCurrentAudioTs += tStates;
+    
     if (emuPaused)
     {
         return;
@@ -8,8 +8,6 @@
 
 #include "ZXSpectrum.hpp"
 
-const uint32_t ZXSpectrum::ULAConentionValues[] = { 6, 5, 4, 3, 2, 1, 0, 0 };
-
 // - IO Contention
 
 /**
@@ -31,27 +29,27 @@ void ZXSpectrum::ULAApplyIOContention(uint16_t address, bool contended)
     {
         if ((address & 0x01) == 0)
         {
-            z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates() % machineInfo.tsPerFrame] );
+            ULAApplyMemoryContention();
             z80Core.AddTStates(1);
-            z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates() % machineInfo.tsPerFrame] );
+            ULAApplyMemoryContention();
             z80Core.AddTStates(3);
         }
         else
         {
-            z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates() % machineInfo.tsPerFrame] );
+            ULAApplyMemoryContention();
             z80Core.AddTStates(1);
-            z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates() % machineInfo.tsPerFrame] );
+            ULAApplyMemoryContention();
             z80Core.AddTStates(1);
-            z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates() % machineInfo.tsPerFrame] );
+            ULAApplyMemoryContention();
             z80Core.AddTStates(1);
-            z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates() % machineInfo.tsPerFrame] );
+            ULAApplyMemoryContention();
             z80Core.AddTStates(1);
         }
     } else {
         if ((address & 0x01) == 0)
         {
             z80Core.AddTStates(1);
-            z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates() % machineInfo.tsPerFrame] );
+            ULAApplyMemoryContention();
             z80Core.AddTStates(3);
         }
         else
@@ -60,26 +58,3 @@ void ZXSpectrum::ULAApplyIOContention(uint16_t address, bool contended)
         }
     }
 }
-
-// - Build Contention Table
-
-void ZXSpectrum::ULABuildContentionTable()
-{
-    for (uint32_t i = 0; i < machineInfo.tsPerFrame; i++)
-    {
-        ULAMemoryContentionTable[i] = 0;
-        ULAIOContentionTable[i] = 0;
-        
-        if (i >= machineInfo.tsToOrigin)
-        {
-            uint32_t line = (i - machineInfo.tsToOrigin) / machineInfo.tsPerLine;
-            uint32_t ts = (i - machineInfo.tsToOrigin) % machineInfo.tsPerLine;
-            
-            if (line < machineInfo.pxVerticalDisplay && ts < 128)
-            {
-                ULAMemoryContentionTable[i] = ULAConentionValues[ ts & 0x07 ];
-                ULAIOContentionTable[i] = ULAConentionValues[ ts & 0x07 ];
-            }
-        }
-    }
-}
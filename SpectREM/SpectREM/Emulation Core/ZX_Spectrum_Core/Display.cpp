@@ -8,64 +8,116 @@
 
 #include "ZXSpectrum.hpp"
 
-// - Spectrum displayPalette
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
 
-enum
+// Paper is drawn with SSE2 wherever it is available, which is every 64 bit Intel build. Defining DISPLAY_SCALAR forces
+// the plain C++ version
+#if !defined(DISPLAY_SCALAR) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define DISPLAY_SSE2
+#include <emmintrin.h>
+#endif
+
+// Multiplying a colour index by this repeats it in all 8 bytes
+static const uint64_t cREPEAT_BYTE = 0x0101010101010101ull;
+
+// Ink and paper colour indexes for an attribute repeated in all 8 bytes. Each is the ink or paper colour, plus 8 for
+// bright
+static inline void displayAttributeColours(uint8_t attributeByte, uint64_t &ink, uint64_t &paper)
 {
-    eDisplayBorder = 1,
-    eDisplayPaper = 2,
-    eDisplayRetrace = 3
-};
+    const uint64_t bright = ( attributeByte & 0x40 ) >> 3;
+    ink = ( ( attributeByte & 0x07 ) | bright ) * cREPEAT_BYTE;
+    paper = ( ( ( attributeByte >> 3 ) & 0x07 ) | bright ) * cREPEAT_BYTE;
+}
+
+#ifdef DISPLAY_SSE2
+// Repeats each of the 16 bytes in bytes 8 times, giving two characters worth in each of the 8 results
+static inline void displayRepeatCells(__m128i bytes, __m128i cells[8])
+{
+    const __m128i repeated2[2] = { _mm_unpacklo_epi8( bytes, bytes ), _mm_unpackhi_epi8( bytes, bytes ) };
+    
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        const __m128i repeated4[2] = { _mm_unpacklo_epi16( repeated2[ i ], repeated2[ i ] ), _mm_unpackhi_epi16( repeated2[ i ], repeated2[ i ] ) };
+        
+        for (uint32_t j = 0; j < 2; j++)
+        {
+            cells[ i * 4 + j * 2 ] = _mm_unpacklo_epi32( repeated4[ j ], repeated4[ j ] );
+            cells[ i * 4 + j * 2 + 1 ] = _mm_unpackhi_epi32( repeated4[ j ], repeated4[ j ] );
+        }
+    }
+}
+#endif
 
 // - Setup
 
+// The display buffers are only allocated the first time, as the presentation thread may be reading one. A new display
+// starts from a clear buffer and the other buffers are drawn from scratch when they are next drawn into
 void ZXSpectrum::displaySetup()
 {
-    displayBuffer = new uint8_t[ screenBufferSize ]();
+    displayFrames.allocate( screenBufferSize );
+    displayBuffer = displayFrames.frame( displayFrames.backIndex() );
+    std::fill( displayBuffer, displayBuffer + screenBufferSize, 0 );
+    
+    std::fill( std::begin( displayFrameNumber ), std::end( displayFrameNumber ), 0 );
+    displayInvalidate();
 }
 
 // - Generate Screen
 
+/**
+ Brings the display up to date by the number of T-states passed in. Each line is drawn as spans where the ULA is doing
+ the same thing, the left border, the paper or border between the borders and the right border, with nothing drawn for
+ retrace. Anything that changes the border colour or display memory brings the display up to date first, so a span never
+ covers a change part way through.
+ **/
 void ZXSpectrum::displayUpdateWithTs(int32_t tStates)
 {
-    const uint8_t *memoryAddress = reinterpret_cast<uint8_t *>( memoryRam.data() + emuDisplayPage * cBITMAP_ADDRESS );
-    const uint32_t yAdjust = ( machineInfo.pxVerticalBlank + machineInfo.pxVertBorder );
+    if (tStates <= 0)
+    {
+        return;
+    }
+    
+    // Only whole characters are drawn, so the display can finish up to a character ahead of the T-states asked for
+    const uint32_t tsTarget = emuCurrentDisplayTs + ( ( static_cast<uint32_t>(tStates) + machineInfo.tsPerChar - 1 ) / machineInfo.tsPerChar ) * machineInfo.tsPerChar;
+    
+    if (emuCurrentDisplayTs == 0)
+    {
+        displayStartFrame();
+    }
+    
+    // A frame that isn't drawn only needs to keep track of where the display is up to
+    if (!displayRenderFrame)
+    {
+        emuCurrentDisplayTs = tsTarget;
+        return;
+    }
     
     // By creating a new buffer which is interpreting the display buffer as 64bits rather than 8, on 64 bit machines an
     // entire display character is copied in a single assignment
     uint64_t *displayBuffer8 = reinterpret_cast<uint64_t*>( displayBuffer ) + displayBufferIndex;
     
-    const uint8_t flashMask = ( emuFrameCounter & 16 ) ? 0xff : 0x7f;
-    
-    while (tStates > 0)
+    while (emuCurrentDisplayTs < tsTarget && emuCurrentDisplayTs < machineInfo.tsPerFrame)
     {
-        uint32_t line = emuCurrentDisplayTs / machineInfo.tsPerLine;
-        uint32_t ts = emuCurrentDisplayTs % machineInfo.tsPerLine;
-
-        uint32_t action = displayTstateTable[ line ][ ts ];
-
-        switch ( action ) {
+        const uint32_t line = emuCurrentDisplayTs / machineInfo.tsPerLine;
+        const uint32_t tsLineStart = line * machineInfo.tsPerLine;
+        const uint32_t tsFrom = emuCurrentDisplayTs - tsLineStart;
+        const uint32_t tsTo = std::min( tsTarget - tsLineStart, machineInfo.tsPerLine );
+        
+        switch ( displayLineTable[ line ] ) {
                 
             case eDisplayBorder:
             {
-                uint64_t *colour8 = displayCLUT + ( displayBorderColor * 2048 );
-                *displayBuffer8++ = *colour8;
+                displayBuffer8 = displayBorderSpan( displayBuffer8, tsFrom, std::min( tsTo, displayTsRightBorderEnd ) );
                 break;
             }
-
+                
             case eDisplayPaper:
             {
-                const uint32_t y = line - yAdjust;
-                const uint32_t x = ( ts >> 2 ) - 4;
-                
-                uint32_t pixelAddress = displayLineAddrTable[ y ] + x;
-                uint32_t attributeAddress = cBITMAP_SIZE + ( ( y >> 3 ) << 5 ) + x;
-                
-                const uint8_t pixelByte = memoryAddress[ pixelAddress ];
-                uint8_t attributeByte = displayALUT[ memoryAddress[ attributeAddress ] & flashMask ];
-
-                uint64_t *colour8 = displayCLUT + ( ( attributeByte & 0x7f ) * 256 ) + pixelByte;
-                *displayBuffer8++ = *colour8;
+                displayBuffer8 = displayBorderSpan( displayBuffer8, tsFrom, std::min( tsTo, displayTsLeftBorderEnd ) );
+                displayBuffer8 = displayPaperSpan( displayBuffer8, line, std::max( tsFrom, displayTsLeftBorderEnd ), std::min( tsTo, displayTsRightBorderStart ) );
+                displayBuffer8 = displayBorderSpan( displayBuffer8, std::max( tsFrom, displayTsRightBorderStart ), std::min( tsTo, displayTsRightBorderEnd ) );
                 break;
             }
                 
@@ -73,146 +125,299 @@ void ZXSpectrum::displayUpdateWithTs(int32_t tStates)
                 break;
         }
         
-        displayBufferIndex += static_cast<uint32_t>( displayBuffer8 - ( reinterpret_cast<uint64_t*>( displayBuffer ) + displayBufferIndex ) );
-        emuCurrentDisplayTs += machineInfo.tsPerChar;
-        tStates -= machineInfo.tsPerChar;
+        emuCurrentDisplayTs = tsLineStart + tsTo;
     }
+    
+    displayBufferIndex = static_cast<uint32_t>( displayBuffer8 - reinterpret_cast<uint64_t*>( displayBuffer ) );
+    emuCurrentDisplayTs = tsTarget;
 }
 
-// - Reset Display
-
-void ZXSpectrum::displayFrameReset()
+// Whether a frame is drawn is decided when it starts so that a frame is either drawn completely or not at all. Cells
+// that flash need drawing when the flash changes
+void ZXSpectrum::displayStartFrame()
 {
-    emuCurrentDisplayTs = 0;
-    displayBufferIndex = 0;
-    audioBufferIndex = 0;
+    displayRenderFrame = displayFrameSkip == 0 || displayRenderRequested || emuFrameCounter % ( displayFrameSkip + 1 ) == 0;
+    displayRenderRequested = false;
+    
+    if (!displayRenderFrame)
+    {
+        return;
+    }
+    
+    const uint32_t flashPhase = emuFrameCounter & 16;
+    if (flashPhase != displayFlashPhase)
+    {
+        const uint8_t *attributes = memoryRamPage[ emuDisplayPage ] + cBITMAP_SIZE;
+        for (uint32_t i = 0; i < cATTR_SIZE; i++)
+        {
+            if (attributes[ i ] & 0x80)
+            {
+                displayMarkDirty(emuDisplayPage, cBITMAP_SIZE + i);
+            }
+        }
+        
+        displayFlashPhase = flashPhase;
+    }
+    
+    // A border change part way through the last frame drawn leaves the old colour at the top of that frame
+    displayBorderDirty = displayBorderDirtyNext;
+    displayBorderDirtyNext = false;
+    displayBorderChanged = displayBorderChangedNext;
+    displayBorderChangedNext = false;
+    std::fill( std::begin( displayFrameChangedLines ), std::end( displayFrameChangedLines ), 0 );
 }
 
-void ZXSpectrum::displayClear()
+// Fills the characters between two T-states in a line with the border colour
+uint64_t *ZXSpectrum::displayBorderSpan(uint64_t *displayBuffer8, uint32_t tsFrom, uint32_t tsTo)
 {
-    if (displayBuffer)
+    if (tsFrom >= tsTo)
     {
-        displaySetup();
+        return displayBuffer8;
+    }
+    
+    const uint64_t border = displayBorderColor * cREPEAT_BYTE;
+    uint64_t *spanEnd = displayBuffer8 + ( tsTo - tsFrom ) / machineInfo.tsPerChar;
+    
+    if (!displayBorderDirty)
+    {
+        return spanEnd;
     }
+    
+    while (displayBuffer8 < spanEnd)
+    {
+        *displayBuffer8++ = border;
+    }
+    
+    return spanEnd;
 }
 
-// - Build Display Tables
-
-void ZXSpectrum::displayBuildLineAddressTable()
+// Draws the paper characters between two T-states in a paper line
+uint64_t *ZXSpectrum::displayPaperSpan(uint64_t *displayBuffer8, uint32_t line, uint32_t tsFrom, uint32_t tsTo)
 {
-    for(uint32_t i = 0; i < 3; i++)
+    if (tsFrom >= tsTo)
+    {
+        return displayBuffer8;
+    }
+    
+    const uint8_t *memoryAddress = memoryRamPage[ emuDisplayPage ];
+    const uint32_t y = line - ( machineInfo.pxVerticalBlank + machineInfo.pxVertBorder );
+    const uint32_t xFrom = ( tsFrom - displayTsLeftBorderEnd ) / machineInfo.tsPerChar;
+    const uint32_t xTo = ( tsTo - displayTsLeftBorderEnd ) / machineInfo.tsPerChar;
+    
+    // Only the dirty cells in the span are drawn
+    const uint32_t spanCells = ( xTo - xFrom < 32 ) ? ( ( 1u << ( xTo - xFrom ) ) - 1 ) << xFrom : 0xffffffff;
+    const uint32_t dirty = displayDirtyLines[ y ] & spanCells;
+    
+    if (!dirty)
     {
-        for(uint32_t j = 0; j < 8; j++)
+        return displayBuffer8 + ( xTo - xFrom );
+    }
+    
+    displayDirtyLines[ y ] &= ~dirty;
+    displayFrameChangedLines[ y ] |= displayChangedLines[ y ] & spanCells;
+    displayChangedLines[ y ] &= ~spanCells;
+    
+    const uint8_t *pixels = memoryAddress + displayLineAddrTable[ y ];
+    const uint8_t *attributes = memoryAddress + cBITMAP_SIZE + ( ( y >> 3 ) << 5 );
+    const uint8_t flashMask = ( emuFrameCounter & 16 ) ? 0xff : 0x7f;
+    
+    uint32_t x = xFrom;
+    
+#ifdef DISPLAY_SSE2
+    // 16 characters at a time. The attribute logic is done on all 16 attributes at once, then each bitmap byte, ink and
+    // paper colour is repeated across 8 bytes so that each bitmap byte can be compared with the bit for each pixel. That
+    // gives the same mask as displayPixelMaskTable without the lookup, and the mask picks between ink and paper
+    const __m128i pixelBits = _mm_set_epi8( 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, static_cast<char>(0x80),
+                                            0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, static_cast<char>(0x80) );
+    const __m128i colourBits = _mm_set1_epi8( 0x07 );
+    const __m128i brightBit = _mm_set1_epi8( 0x40 );
+    const __m128i flashBit = _mm_set1_epi8( static_cast<char>(flashMask & 0x80) );
+    const __m128i flashSet = _mm_set1_epi8( static_cast<char>(0x80) );
+    
+    for (; x + 16 <= xTo; x += 16)
+    {
+        if (!( dirty & ( 0xffffu << x ) ))
         {
-            for(uint32_t k = 0; k < 8; k++)
-            {
-                displayLineAddrTable[ ( i << 6 ) + ( j << 3 ) + k ] = static_cast<uint16_t>(( i << 11 ) + ( j << 5 ) + ( k << 8 ));
-            }
+            displayBuffer8 += 16;
+            continue;
+        }
+        
+        const __m128i attributeBytes = _mm_loadu_si128( reinterpret_cast<const __m128i *>( attributes + x ) );
+        const __m128i pixelBytes = _mm_loadu_si128( reinterpret_cast<const __m128i *>( pixels + x ) );
+        
+        // Ink and paper plus 8 for bright, swapped where flash is set while flash is active
+        const __m128i bright = _mm_srli_epi16( _mm_and_si128( attributeBytes, brightBit ), 3 );
+        const __m128i ink = _mm_or_si128( _mm_and_si128( attributeBytes, colourBits ), bright );
+        const __m128i paper = _mm_or_si128( _mm_and_si128( _mm_srli_epi16( attributeBytes, 3 ), colourBits ), bright );
+        const __m128i flashing = _mm_cmpeq_epi8( _mm_and_si128( attributeBytes, flashBit ), flashSet );
+        
+        __m128i pixelCells[8], inkCells[8], paperCells[8];
+        displayRepeatCells( pixelBytes, pixelCells );
+        displayRepeatCells( _mm_or_si128( _mm_and_si128( flashing, paper ), _mm_andnot_si128( flashing, ink ) ), inkCells );
+        displayRepeatCells( _mm_or_si128( _mm_and_si128( flashing, ink ), _mm_andnot_si128( flashing, paper ) ), paperCells );
+        
+        for (uint32_t cells = 0; cells < 8; cells++)
+        {
+            const __m128i mask = _mm_cmpeq_epi8( _mm_and_si128( pixelCells[ cells ], pixelBits ), pixelBits );
+            _mm_storeu_si128( reinterpret_cast<__m128i *>( displayBuffer8 ), _mm_or_si128( _mm_and_si128( mask, inkCells[ cells ] ), _mm_andnot_si128( mask, paperCells[ cells ] ) ) );
+            displayBuffer8 += 2;
         }
     }
+#endif
+    
+    for (; x < xTo; x++)
+    {
+        if (!( dirty & ( 1u << x ) ))
+        {
+            displayBuffer8++;
+            continue;
+        }
+        
+        uint64_t ink, paper;
+        displayAttributeColours( displayALUT[ attributes[ x ] & flashMask ], ink, paper );
+        
+        const uint64_t mask = displayPixelMaskTable[ pixels[ x ] ];
+        *displayBuffer8++ = ( ink & mask ) | ( paper & ~mask );
+    }
+    
+    return displayBuffer8;
+}
+
+// - Changes
+
+// Any change to the border colour means the border is drawn for the rest of the frame and all of the next
+void ZXSpectrum::displaySetBorderColor(uint32_t color)
+{
+    if (color != displayBorderColor)
+    {
+        displayBorderColor = color;
+        displayBorderDirty = true;
+        displayBorderDirtyNext = true;
+        displayBorderChanged = true;
+        displayBorderChangedNext = true;
+    }
+}
+
+// Everything is drawn again, for when the screen memory or display buffer has changed without the cells being marked
+void ZXSpectrum::displayInvalidate()
+{
+    std::fill( std::begin( displayDirtyLines ), std::end( displayDirtyLines ), 0xffffffff );
+    std::fill( std::begin( displayChangedLines ), std::end( displayChangedLines ), 0xffffffff );
+    displayBorderDirty = true;
+    displayBorderDirtyNext = true;
+    displayBorderChanged = true;
+    displayBorderChangedNext = true;
 }
 
-void ZXSpectrum::displayBuildTsTable()
+/**
+ Builds displayChangedRects from the cells changed in the frame that has just been rendered. Runs of cells on a line
+ are joined with the same run on the line above, so a block of changed characters is a single rectangle. If the border
+ changed then the whole display is listed as a single rectangle.
+ **/
+void ZXSpectrum::displayBuildChangedRects()
 {
-    uint32_t tsRightBorderStart = ( machineInfo.pxEmuBorder / 2 ) + machineInfo.tsHorizontalDisplay;
-    uint32_t tsRightBorderEnd = ( machineInfo.pxEmuBorder / 2 ) + machineInfo.tsHorizontalDisplay + ( machineInfo.pxEmuBorder / 2 );
-    uint32_t tsLeftBorderStart = 0;
-    uint32_t tsLeftBorderEnd = machineInfo.pxEmuBorder / 2;
+    displayChangedRects.clear();
     
-    uint32_t pxLineTopBorderStart = machineInfo.pxVerticalBlank;
-    uint32_t pxLineTopBorderEnd = machineInfo.pxVerticalBlank + machineInfo.pxVertBorder;
-    uint32_t pxLinePaperStart = machineInfo.pxVerticalBlank + machineInfo.pxVertBorder;
-    uint32_t pxLinePaperEnd = machineInfo.pxVerticalBlank + machineInfo.pxVertBorder + machineInfo.pxVerticalDisplay;
-    uint32_t pxLineBottomBorderEnd = machineInfo.pxVerticalTotal - ( machineInfo.pxVertBorder - machineInfo.pxEmuBorder );
+    if (displayBorderChanged)
+    {
+        displayChangedRects.push_back( { 0, 0, screenWidth, screenHeight } );
+        return;
+    }
     
-    for (uint32_t line = 0; line < machineInfo.pxVerticalTotal; line++)
+    // The rectangle a run starting in each column was added to on the line above, if any
+    size_t openRects[32];
+    std::fill( std::begin( openRects ), std::end( openRects ), SIZE_MAX );
+    
+    for (uint32_t y = 0; y < machineInfo.pxVerticalDisplay; y++)
     {
-        for (uint32_t ts = 0 ; ts < machineInfo.tsPerLine; ts++)
+        const uint32_t drawn = displayFrameChangedLines[ y ];
+        uint32_t x = 0;
+        
+        while (x < 32)
         {
-            // Screen Retrace
-            if (line < machineInfo.pxVerticalBlank)
+            if (!( drawn & ( 1u << x ) ))
             {
-                displayTstateTable[ line ][ ts ] = eDisplayRetrace;
+                openRects[ x++ ] = SIZE_MAX;
+                continue;
             }
             
-            // Top Border
-            if (line >= pxLineTopBorderStart && line < pxLineTopBorderEnd)
+            uint32_t runEnd = x;
+            while (runEnd < 32 && ( drawn & ( 1u << runEnd ) ))
             {
-                if ( ( ts >= tsRightBorderEnd && ts < machineInfo.tsPerLine ) || line < pxLinePaperStart - machineInfo.pxEmuBorder )
-                {
-                    displayTstateTable[ line ][ ts ] = eDisplayRetrace;
-                }
-                else
-                {
-                    displayTstateTable[ line ][ ts ] = eDisplayBorder;
-                }
+                runEnd++;
             }
             
-            // Border + Paper + Border
-            if (line >= pxLinePaperStart && line < pxLinePaperEnd)
+            const DisplayRect rect = { machineInfo.pxEmuBorder + x * 8, machineInfo.pxEmuBorder + y, ( runEnd - x ) * 8, 1 };
+            const size_t open = openRects[ x ];
+            
+            if (open != SIZE_MAX && displayChangedRects[ open ].width == rect.width && displayChangedRects[ open ].y + displayChangedRects[ open ].height == rect.y)
             {
-                if ( ( ts >= tsLeftBorderStart && ts < tsLeftBorderEnd ) || ( ts >= tsRightBorderStart && ts < tsRightBorderEnd ) )
-                {
-                    displayTstateTable[ line ][ ts ] = eDisplayBorder;
-                }
-                else if (ts >= tsRightBorderEnd && ts < machineInfo.tsPerLine)
-                {
-                    displayTstateTable[ line ][ ts ] = eDisplayRetrace;
-                }
-                else
-                {
-                    displayTstateTable[ line ][ ts ] = eDisplayPaper;
-                }
+                displayChangedRects[ open ].height++;
+            }
+            else
+            {
+                openRects[ x ] = displayChangedRects.size();
+                displayChangedRects.push_back( rect );
             }
             
-            // Bottom Border
-            if (line >= pxLinePaperEnd && line < pxLineBottomBorderEnd)
+            for (x++; x < runEnd; x++)
             {
-                if (ts >= tsRightBorderEnd && ts < machineInfo.tsPerLine)
-                {
-                    displayTstateTable[ line ][ ts ] = eDisplayRetrace;
-                }
-                else
-                {
-                    displayTstateTable[ line ][ ts ] = eDisplayBorder;
-                }
+                openRects[ x ] = SIZE_MAX;
             }
         }
     }
 }
 
 /**
- Build a table that contains a colour lookup value for every combination of Bright, Paper, Ink and Pixel. This table is then
- used to populate an 8bit display buffer with an index to the colour to be used for each pixel rather than the colour data itself. The actual
- colour to be used is worked out in the Fragment Shader using a 1D lookup texture that contains the actual colour information.
+ Publishes the frame that has just been rendered and moves on to the next buffer, which holds the frame from one or two
+ frames ago if the presentation thread has kept up. The cells changed since then are marked as dirty so that the buffer is
+ brought up to date as the next frame is drawn, and anything older is drawn from scratch.
  **/
-void ZXSpectrum::displayBuildCLUT()
+void ZXSpectrum::displayPublishFrame()
 {
-    int32_t tableIdx = 0;
-    uint8_t *displayCLUT8 = reinterpret_cast<uint8_t *>( displayCLUT );
+    displayFramesRendered++;
+    
+    const uint32_t history = displayFramesRendered & 1;
+    std::copy( std::begin( displayFrameChangedLines ), std::end( displayFrameChangedLines ), displayFrameChangedHistory[ history ] );
+    displayBorderChangedHistory[ history ] = displayBorderChanged;
+    displayFrameNumber[ displayFrames.backIndex() ] = displayFramesRendered;
+    
+    const uint32_t back = displayFrames.publish();
+    displayBuffer = displayFrames.frame( back );
+    
+    const uint32_t framesBehind = displayFramesRendered - displayFrameNumber[ back ];
+    if (displayFrameNumber[ back ] == 0 || framesBehind > 2)
+    {
+        std::fill( std::begin( displayDirtyLines ), std::end( displayDirtyLines ), 0xffffffff );
+        displayBorderDirtyNext = true;
+        return;
+    }
     
-    // Bitmap LUT
-    for (uint32_t bright = 0; bright < 2; bright++)
+    for (uint32_t frame = displayFramesRendered - framesBehind + 1; frame <= displayFramesRendered; frame++)
     {
-        for (uint32_t paper = 0; paper < 8; paper++)
+        for (uint32_t y = 0; y < machineInfo.pxVerticalDisplay; y++)
         {
-            for (uint32_t ink = 0; ink < 8; ink++)
-            {
-                for (uint32_t pixels = 0; pixels < 256; pixels++)
-                {
-                    for (int8_t pixelbit = 7; pixelbit >= 0; pixelbit--)
-                    {
-                        displayCLUT8[ tableIdx++ ] = static_cast<uint8_t>(( pixels & ( 1 << pixelbit ) ? ink : paper ) + ( bright * 8 ));
-                    }
-                }
-            }
+            displayDirtyLines[ y ] |= displayFrameChangedHistory[ frame & 1 ][ y ];
         }
+        
+        displayBorderDirtyNext |= displayBorderChangedHistory[ frame & 1 ];
     }
-    
-    // Attribute LUT
-    for (uint32_t alutIdx = 0; alutIdx < 256; ++alutIdx)
+}
+
+// - Reset Display
+
+void ZXSpectrum::displayFrameReset()
+{
+    emuCurrentDisplayTs = 0;
+    displayBufferIndex = 0;
+    audioBufferIndex = 0;
+}
+
+void ZXSpectrum::displayClear()
+{
+    if (displayBuffer)
     {
-        displayALUT[ alutIdx ] = static_cast<uint8_t>(alutIdx & 0x80 ? ( ( alutIdx & 0xc0 ) | ( ( alutIdx & 0x07 ) << 3 ) | ( ( alutIdx & 0x38) >> 3 ) ) : alutIdx);
+        displaySetup();
     }
 }
 
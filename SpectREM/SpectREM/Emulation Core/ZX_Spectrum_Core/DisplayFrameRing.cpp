@@ -0,0 +1,56 @@
+//
+//  DisplayFrameRing.cpp
+//  SpectREM
+//
+
+#include "DisplayFrameRing.hpp"
+
+// - Copy
+
+/**
+ Used when a machine is cloned, which happens on the emulation side while the presentation thread may still be using
+ the original. Only what the emulation side owns is read from the original, so the copy presents the latest frame the
+ original published and draws into a copy of the buffer the original is drawing into.
+ **/
+DisplayFrameRing::DisplayFrameRing(const DisplayFrameRing &ring)
+:   memory(ring.memory)
+,   frameSize(ring.frameSize)
+,   back(ring.back)
+,   latest(ring.latest)
+,   front(ring.latest)
+,   ready(cFRAMES - ring.back - ring.latest)
+{
+}
+
+// - Emulation
+
+void DisplayFrameRing::allocate(size_t size)
+{
+    if (memory.empty())
+    {
+        memory.assign(size * cFRAMES, 0);
+        frameSize = size;
+    }
+}
+
+// Makes the buffer that has been drawn into the latest frame and returns the index of the buffer to draw into next
+uint32_t DisplayFrameRing::publish()
+{
+    latest = back;
+    back = ready.exchange(back | cFRESH, std::memory_order_acq_rel) & ~cFRESH;
+    return back;
+}
+
+// - Presentation
+
+// The latest frame published, or the frame that was acquired last time if nothing has been published since. The frame
+// stays the presentation threads until it next calls acquireLatest
+const uint8_t *DisplayFrameRing::acquireLatest()
+{
+    if (ready.load(std::memory_order_acquire) & cFRESH)
+    {
+        front = ready.exchange(front, std::memory_order_acq_rel) & ~cFRESH;
+    }
+
+    return frame(front);
+}
@@ -0,0 +1,61 @@
+//
+//  DisplayFrameRing.hpp
+//  SpectREM
+//
+
+#ifndef DisplayFrameRing_hpp
+#define DisplayFrameRing_hpp
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// - Display frame ring
+
+/**
+ Three display buffers shared between the emulation, which draws frames, and the presentation thread, which shows
+ them. At any time one buffer is being drawn into, one is being presented and one holds the latest finished frame.
+ Publishing a frame swaps the buffer being drawn into with the latest frame and acquiring swaps the buffer being
+ presented with it, so neither side ever waits for the other or sees the buffer the other is using. Frames the
+ presentation thread doesn't get to in time are dropped in favour of the newest. The buffers are allocated once and
+ never freed while the machine exists.
+ **/
+class DisplayFrameRing
+{
+public:
+    static const uint32_t   cFRAMES = 3;
+
+    DisplayFrameRing() = default;
+    DisplayFrameRing(const DisplayFrameRing &ring);
+    DisplayFrameRing &operator=(const DisplayFrameRing &ring) = delete;
+
+    // Emulation side. allocate only allocates the buffers the first time it's called
+    void                    allocate(size_t size);
+    uint8_t                 *frame(uint32_t index) { return memory.data() + index * frameSize; }
+    uint32_t                backIndex() const { return back; }
+    uint32_t                latestIndex() const { return latest; }
+    uint32_t                publish();
+
+    // Presentation side
+    const uint8_t           *acquireLatest();
+
+private:
+    // Set in ready when it holds a frame that hasn't been acquired yet
+    static const uint32_t   cFRESH = 0x80;
+
+    std::vector<uint8_t>    memory;
+    size_t                  frameSize = 0;
+
+    // The buffer being drawn into and the last one published, only used by the emulation
+    uint32_t                back = 0;
+    uint32_t                latest = 1;
+
+    // The buffer being presented, only used by the presentation thread
+    uint32_t                front = 1;
+
+    // The buffer handed between the two
+    std::atomic<uint32_t>   ready{2};
+};
+
+#endif /* DisplayFrameRing_hpp */
@@ -0,0 +1,168 @@
+//
+//  Idle.cpp
+//  SpectREM
+//
+
+#include "ZXSpectrum.hpp"
+
+#include <cstring>
+
+/**
+ A machine sitting at the BASIC prompt, or in any other ROM wait loop, spends the whole frame spinning in the ROM and
+ the only thing that changes from one frame to the next is what the interrupt handler does. Once the frame has ended
+ in the ROM, with the stack in the same place, for a number of frames without any RAM outside of the system variables
+ and stack changing, and without anything being written to a port, the machine is considered idle. Idle frames then
+ only run the interrupt handler before jumping straight to the end of the frame.
+
+ This is only an approximation of running the frame, as R and the point in the loop reached are left where the
+ interrupt handler returned to, so it is off unless emuSkipIdleFrames is set. It is never used while the debugger is
+ attached, a tape is playing or a key is held and anything typed, or any port write, drops the machine out of idle.
+ **/
+
+const uint32_t cIDLE_FRAMES = 10;               // Frames the machine must look idle for before frames are skipped
+const uint16_t cIDLE_SP_WINDOW = 16;            // Largest spread of end of frame SP values for an idle loop
+const uint16_t cIDLE_STACK_SIZE = 64;           // Bytes below the highest SP the idle loop and interrupt handler use
+const uint16_t cIDLE_SYSVARS_START = 0x5b00;    // Printer buffer and system variables the ROM updates every frame
+const uint16_t cIDLE_SYSVARS_END = 0x5cc0;
+const uint16_t cIDLE_RAM_START = 0x4000;
+
+void ZXSpectrum::idleReset()
+{
+    idleActive = false;
+    idleFrameCount = 0;
+}
+
+bool ZXSpectrum::idleAllowed()
+{
+    if (!emuSkipIdleFrames || debugOpCallbackBlock || breakpointHit || (tape && tape->playing))
+    {
+        return false;
+    }
+
+    for (int i = 0; i < 8; i++)
+    {
+        if ((keyboardMap[i] & 0x1f) != 0x1f)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Called at the end of every frame that was run in full to see if the machine has settled into an idle loop
+void ZXSpectrum::idleCheckFrame()
+{
+    if (!idleAllowed())
+    {
+        idleReset();
+        return;
+    }
+
+    uint16_t pc = z80Core.GetRegister(CZ80Core::eREG_PC);
+    uint16_t sp = z80Core.GetRegister(CZ80Core::eREG_SP);
+    uint16_t spLow = std::min(idleSPLow, sp);
+    uint16_t spHigh = std::max(idleSPHigh, sp);
+
+    if (pc >= cIDLE_RAM_START)
+    {
+        idleReset();
+        return;
+    }
+
+    if (idleFrameCount == 0 || spHigh - spLow >= cIDLE_SP_WINDOW || !idleMemoryUnchanged())
+    {
+        // Start watching again from this frame
+        idleFrameCount = 1;
+        idleSPLow = idleSPHigh = sp;
+
+        idleMemory.resize(0x10000 - cIDLE_RAM_START);
+        for (uint32_t slot = cIDLE_RAM_START >> cMEMORY_SLOT_SHIFT; slot < cMEMORY_SLOTS; slot++)
+        {
+            memcpy(&idleMemory[slot * cMEMORY_SLOT_SIZE - cIDLE_RAM_START], memoryReadSlot[slot], cMEMORY_SLOT_SIZE);
+        }
+        return;
+    }
+
+    idleSPLow = spLow;
+    idleSPHigh = spHigh;
+    idleActive = ++idleFrameCount >= cIDLE_FRAMES;
+}
+
+// Runs the interrupt handler for an idle frame and skips to the end of the frame. Returns false if the machine turned
+// out not to be idle, in which case the rest of the frame needs running as normal
+bool ZXSpectrum::idleSkipFrame()
+{
+    if (!idleAllowed())
+    {
+        idleReset();
+        return false;
+    }
+
+    if (z80Core.GetIFF1() && z80Core.IsInterruptRequesting())
+    {
+        // The interrupt handler has finished once the stack is back where it was before the interrupt
+        uint16_t sp = z80Core.GetRegister(CZ80Core::eREG_SP);
+        do
+        {
+            z80Core.ExecuteUntil(0, machineInfo.intLength);
+        } while (idleActive && z80Core.GetRegister(CZ80Core::eREG_SP) != sp && z80Core.GetTStates() < machineInfo.tsPerFrame);
+    }
+
+    uint16_t pc = z80Core.GetRegister(CZ80Core::eREG_PC);
+    uint16_t sp = z80Core.GetRegister(CZ80Core::eREG_SP);
+    if (!idleActive || pc >= cIDLE_RAM_START || sp < idleSPLow || sp > idleSPHigh
+        || z80Core.GetTStates() >= machineInfo.tsPerFrame || !idleMemoryUnchanged())
+    {
+        idleReset();
+        return false;
+    }
+
+    z80Core.AddTStates(machineInfo.tsPerFrame - z80Core.GetTStates());
+    audioUpdateWithTs(z80Core.GetTStates() - emuCurrentAudioTs);
+    emuEndFrame();
+    emuIdleFramesSkipped++;
+
+    return true;
+}
+
+// Compares RAM with the copy taken when the machine started to look idle, ignoring the system variables and the part of
+// the stack the interrupt handler uses
+bool ZXSpectrum::idleMemoryUnchanged()
+{
+    uint32_t stackStart = (idleSPHigh > cIDLE_RAM_START + cIDLE_STACK_SIZE) ? idleSPHigh - cIDLE_STACK_SIZE : cIDLE_RAM_START;
+    uint32_t stackEnd = std::max<uint32_t>(idleSPHigh, cIDLE_RAM_START);
+
+    // Ranges of RAM that are not compared, in address order
+    uint32_t skipped[2][2] = {
+        { cIDLE_SYSVARS_START, cIDLE_SYSVARS_END },
+        { stackStart, stackEnd }
+    };
+    if (stackStart < cIDLE_SYSVARS_START)
+    {
+        std::swap(skipped[0], skipped[1]);
+    }
+
+    uint32_t address = cIDLE_RAM_START;
+    for (int i = 0; i <= 2; i++)
+    {
+        uint32_t end = (i < 2) ? skipped[i][0] : 0x10000;
+        while (address < end)
+        {
+            uint32_t slot = address >> cMEMORY_SLOT_SHIFT;
+            uint32_t length = std::min<uint32_t>(end, (slot + 1) * cMEMORY_SLOT_SIZE) - address;
+            if (memcmp(&idleMemory[address - cIDLE_RAM_START], memoryReadSlot[slot] + (address & (cMEMORY_SLOT_SIZE - 1)), length))
+            {
+                return false;
+            }
+            address += length;
+        }
+        if (i < 2)
+        {
+            address = std::max(address, skipped[i][1]);
+        }
+    }
+
+    return true;
+}
+
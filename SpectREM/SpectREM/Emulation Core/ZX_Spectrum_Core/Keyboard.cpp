@@ -82,6 +82,9 @@ ZXSpectrum::KEYBOARD_ENTRY ZXSpectrum::keyboardLookup[] =
 
 void ZXSpectrum::keyboardKeyDown(ZXSpectrumKey key)
 {
+    // Anything typed means the machine is no longer idle
+    idleReset();
+
     for (int i = 0; i < static_cast<int>(sizeof(keyboardLookup) / sizeof(keyboardLookup[0])); i++)
     {
         if (keyboardLookup[i].key == key)
@@ -106,6 +109,9 @@ void ZXSpectrum::keyboardKeyDown(ZXSpectrumKey key)
 
 void ZXSpectrum::keyboardKeyUp(ZXSpectrumKey key)
 {
+    // Anything typed means the machine is no longer idle
+    idleReset();
+
     if (key != ZXSpectrumKey::Key_CapsLock)
     {
         for (int i = 0; i < static_cast<int>(sizeof(keyboardLookup) / sizeof(keyboardLookup[0])); i++)
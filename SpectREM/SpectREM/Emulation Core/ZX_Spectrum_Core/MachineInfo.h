@@ -53,12 +53,14 @@ typedef struct
     
     uint32_t machineType;           // 25
     
+    bool hasContention;             // 26 - false for machines with no memory or IO contention, such as the Pentagon
+    
 } MachineInfo;
 
-static const MachineInfo machines[] = {
-    //1   2      3      4    5      6     7      8    9  10 11  12   13   14   15   16  17     18      19  20  21     22      23  24        25
-    { 32, 69888, 14335, 224, 12544, 1792, 43008, 128, 4, 56, 8, 256, 192, 448, 312, 32, false, false,  10, 16, 16384, 65536,  -1, "48k",    eZXSpectrum48 },
-    { 36, 70908, 14361, 228, 12768, 1596, 43776, 128, 4, 56, 7, 256, 192, 448, 311, 32,  true,  true,  12, 16, 32768, 131072,  1, "128k",   eZXSpectrum128 }
+static constexpr MachineInfo machines[] = {
+    //1   2      3      4    5      6     7      8    9  10 11  12   13   14   15   16  17     18      19  20  21     22      23  24        25              26
+    { 32, 69888, 14335, 224, 12544, 1792, 43008, 128, 4, 56, 8, 256, 192, 448, 312, 32, false, false,  10, 16, 16384, 65536,  -1, "48k",    eZXSpectrum48,  true },
+    { 36, 70908, 14361, 228, 12768, 1596, 43776, 128, 4, 56, 7, 256, 192, 448, 311, 32,  true,  true,  12, 16, 32768, 131072,  1, "128k",   eZXSpectrum128, true }
 };
 
 #endif /* MachineInfo_h */
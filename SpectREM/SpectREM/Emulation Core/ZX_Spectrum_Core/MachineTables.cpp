@@ -0,0 +1,164 @@
+//
+//  MachineTables.cpp
+//  SpectREM
+//
+
+#include "MachineTables.hpp"
+
+static constexpr uint8_t cULA_CONTENTION_VALUES[] = { 6, 5, 4, 3, 2, 1, 0, 0 };
+
+// Fixed size tables the builders below can fill in and return at compile time
+template <typename T, uint32_t N>
+struct Table
+{
+    T values[N];
+};
+
+// - Display tables
+
+static constexpr Table<uint16_t, 192> displayBuildLineAddressTable()
+{
+    Table<uint16_t, 192> table = {};
+
+    for(uint32_t i = 0; i < 3; i++)
+    {
+        for(uint32_t j = 0; j < 8; j++)
+        {
+            for(uint32_t k = 0; k < 8; k++)
+            {
+                table.values[ ( i << 6 ) + ( j << 3 ) + k ] = static_cast<uint16_t>(( i << 11 ) + ( j << 5 ) + ( k << 8 ));
+            }
+        }
+    }
+
+    return table;
+}
+
+/**
+ The display buffer holds a colour index for every pixel, which is the ink or paper colour plus 8 when bright is set. The
+ actual colour is worked out in the Fragment Shader using a 1D lookup texture that contains the actual colour
+ information. Rather than looking up the 8 indexes for a byte of the bitmap and its attribute in a table covering every
+ combination, the 8 byte mask for the bitmap byte picks between the ink and paper index repeated 8 times. The leftmost
+ pixel, bit 7, is the first byte in the display buffer, which is the low byte of the mask on the little endian CPUs
+ SpectREM runs on.
+ **/
+static constexpr Table<uint64_t, 256> displayBuildPixelMaskTable()
+{
+    Table<uint64_t, 256> table = {};
+
+    for (uint32_t pixels = 0; pixels < 256; pixels++)
+    {
+        for (uint32_t pixelbit = 0; pixelbit < 8; pixelbit++)
+        {
+            if (pixels & ( 0x80 >> pixelbit ))
+            {
+                table.values[ pixels ] |= 0xffull << ( pixelbit * 8 );
+            }
+        }
+    }
+
+    return table;
+}
+
+static constexpr Table<uint8_t, 256> displayBuildALUT()
+{
+    Table<uint8_t, 256> table = {};
+
+    for (uint32_t alutIdx = 0; alutIdx < 256; ++alutIdx)
+    {
+        table.values[ alutIdx ] = static_cast<uint8_t>(alutIdx & 0x80 ? ( ( alutIdx & 0xc0 ) | ( ( alutIdx & 0x07 ) << 3 ) | ( ( alutIdx & 0x38) >> 3 ) ) : alutIdx);
+    }
+
+    return table;
+}
+
+// What happens across each line of the frame. Paper lines have the border either side of the paper
+template <uint32_t N>
+static constexpr Table<uint8_t, N> displayBuildLineTable(const MachineInfo &machineInfo)
+{
+    const uint32_t pxLineTopBorderStart = machineInfo.pxVerticalBlank + machineInfo.pxVertBorder - machineInfo.pxEmuBorder;
+    const uint32_t pxLinePaperStart = machineInfo.pxVerticalBlank + machineInfo.pxVertBorder;
+    const uint32_t pxLinePaperEnd = machineInfo.pxVerticalBlank + machineInfo.pxVertBorder + machineInfo.pxVerticalDisplay;
+    const uint32_t pxLineBottomBorderEnd = machineInfo.pxVerticalTotal - ( machineInfo.pxVertBorder - machineInfo.pxEmuBorder );
+
+    Table<uint8_t, N> table = {};
+
+    for (uint32_t line = 0; line < machineInfo.pxVerticalTotal; line++)
+    {
+        if (line >= pxLinePaperStart && line < pxLinePaperEnd)
+        {
+            table.values[ line ] = eDisplayPaper;
+        }
+        else if (line >= pxLineTopBorderStart && line < pxLineBottomBorderEnd)
+        {
+            table.values[ line ] = eDisplayBorder;
+        }
+        else
+        {
+            table.values[ line ] = eDisplayRetrace;
+        }
+    }
+
+    return table;
+}
+
+// - Contention table
+
+static constexpr uint32_t ULAContentionLength(const MachineInfo &machineInfo)
+{
+    return (machineInfo.hasContention) ? (machineInfo.pxVerticalDisplay - 1) * machineInfo.tsPerLine + 128 : 0;
+}
+
+template <uint32_t N>
+static constexpr Table<uint8_t, N> ULABuildContentionTable(const MachineInfo &machineInfo)
+{
+    Table<uint8_t, N> table = {};
+
+    if (machineInfo.hasContention)
+    {
+        for (uint32_t line = 0; line < machineInfo.pxVerticalDisplay; line++)
+        {
+            for (uint32_t ts = 0; ts < 128; ts++)
+            {
+                table.values[ machineInfo.tsToOrigin + line * machineInfo.tsPerLine + ts ] = cULA_CONTENTION_VALUES[ ts & 0x07 ];
+            }
+        }
+    }
+
+    return table;
+}
+
+// - Tables
+
+static constexpr auto cLINE_ADDRESS_TABLE = displayBuildLineAddressTable();
+static constexpr auto cPIXEL_MASK_TABLE = displayBuildPixelMaskTable();
+static constexpr auto cALUT = displayBuildALUT();
+
+static constexpr const MachineInfo &c48K = machines[ eZXSpectrum48 ];
+static constexpr auto c48K_CONTENTION_TABLE = ULABuildContentionTable<c48K.tsPerFrame>(c48K);
+static constexpr auto c48K_LINE_TABLE = displayBuildLineTable<c48K.pxVerticalTotal>(c48K);
+
+static constexpr const MachineInfo &c128K = machines[ eZXSpectrum128 ];
+static constexpr auto c128K_CONTENTION_TABLE = ULABuildContentionTable<c128K.tsPerFrame>(c128K);
+static constexpr auto c128K_LINE_TABLE = displayBuildLineTable<c128K.pxVerticalTotal>(c128K);
+
+// Indexed by machine type
+static constexpr MachineTables cMACHINE_TABLES[] = {
+    {
+        c48K.tsToOrigin, ULAContentionLength(c48K), c48K_CONTENTION_TABLE.values, c48K_LINE_TABLE.values,
+        c48K.pxEmuBorder / 2, ( c48K.pxEmuBorder / 2 ) + c48K.tsHorizontalDisplay,
+        ( c48K.pxEmuBorder / 2 ) + c48K.tsHorizontalDisplay + ( c48K.pxEmuBorder / 2 ),
+        cLINE_ADDRESS_TABLE.values, cPIXEL_MASK_TABLE.values, cALUT.values
+    },
+    {
+        c128K.tsToOrigin, ULAContentionLength(c128K), c128K_CONTENTION_TABLE.values, c128K_LINE_TABLE.values,
+        c128K.pxEmuBorder / 2, ( c128K.pxEmuBorder / 2 ) + c128K.tsHorizontalDisplay,
+        ( c128K.pxEmuBorder / 2 ) + c128K.tsHorizontalDisplay + ( c128K.pxEmuBorder / 2 ),
+        cLINE_ADDRESS_TABLE.values, cPIXEL_MASK_TABLE.values, cALUT.values
+    }
+};
+
+const MachineTables &machineTablesForMachine(const MachineInfo &machineInfo)
+{
+    return cMACHINE_TABLES[ machineInfo.machineType ];
+}
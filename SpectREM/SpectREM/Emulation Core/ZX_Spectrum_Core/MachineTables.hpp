@@ -0,0 +1,61 @@
+//
+//  MachineTables.hpp
+//  SpectREM
+//
+
+#ifndef MachineTables_hpp
+#define MachineTables_hpp
+
+#include <cstdint>
+
+#include "MachineInfo.h"
+
+// What the ULA is doing on each line of the frame
+enum
+{
+    eDisplayBorder = 1,
+    eDisplayPaper = 2,
+    eDisplayRetrace = 3
+};
+
+// - Machine tables
+
+/**
+ Lookup tables that only depend on the type of machine being emulated. Every table is built by the compiler from the
+ machines[] entry for the machine type, so there is nothing to build when a machine is initialised and a single read
+ only copy is shared by every machine in the process. The display tables are the same for every type of machine.
+ **/
+typedef struct
+{
+    // Contention only happens while the ULA is fetching the display, from the first T-state of the first display line
+    // to the last T-state of the last display line
+    uint32_t                ULAContentionStart;
+    uint32_t                ULAContentionLength;
+
+    // Extra T-states a contended memory access is delayed by at each T-state of the frame
+    const uint8_t           *ULAMemoryContentionTable;
+
+    // eDisplayBorder, eDisplayPaper or eDisplayRetrace for each line of the frame. Nothing is drawn on retrace lines. Border
+    // lines are border up to displayTsRightBorderEnd and paper lines have paper between the two borders
+    const uint8_t           *displayLineTable;
+
+    // Where the left border ends, the right border starts and the right border ends, in T-states from the start of a line.
+    // Each is a whole number of characters
+    uint32_t                displayTsLeftBorderEnd;
+    uint32_t                displayTsRightBorderStart;
+    uint32_t                displayTsRightBorderEnd;
+
+    // Offset of the first byte of each display line from the start of the bitmap
+    const uint16_t          *displayLineAddrTable;
+
+    // 0xff for each set pixel in a bitmap byte, in the order the 8 pixels are stored in the display buffer
+    const uint64_t          *displayPixelMaskTable;
+
+    // Attribute with ink and paper swapped when flash is set, indexed by the attribute with the flash bit masked off on
+    // the frames flash is not active
+    const uint8_t           *displayALUT;
+} MachineTables;
+
+const MachineTables &machineTablesForMachine(const MachineInfo &machineInfo);
+
+#endif /* MachineTables_hpp */
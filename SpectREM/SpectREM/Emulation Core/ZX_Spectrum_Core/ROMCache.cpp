@@ -0,0 +1,107 @@
+//
+//  ROMCache.cpp
+//  SpectREM
+//
+
+#include "ROMCache.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+
+#ifdef QT_SPECTRUM
+#include <QFile>
+#endif
+
+static const uintptr_t cROM_IMAGE_ALIGNMENT = 4096;
+
+// - ROM image
+
+ROMImage::ROMImage(const uint8_t *data, size_t size)
+{
+    size_t pageCount = ( size + cPAGE_SIZE - 1 ) / cPAGE_SIZE;
+    length = ( pageCount ? pageCount : 1 ) * cPAGE_SIZE;
+
+    storage.resize( length + cROM_IMAGE_ALIGNMENT );
+    uintptr_t address = reinterpret_cast<uintptr_t>(storage.data());
+    bytes = storage.data() + ( ( cROM_IMAGE_ALIGNMENT - ( address & ( cROM_IMAGE_ALIGNMENT - 1 ) ) ) & ( cROM_IMAGE_ALIGNMENT - 1 ) );
+
+    if (data)
+    {
+        std::memcpy(bytes, data, size);
+    }
+}
+
+// - ROM cache
+
+static std::mutex romCacheMutex;
+static std::map<std::string, std::shared_ptr<const ROMImage>> romCacheImages;
+
+static std::shared_ptr<const ROMImage> romCacheReadFile(const std::string &path)
+{
+#ifdef QT_SPECTRUM
+    QFile file(QString::fromStdString(path));
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return nullptr;
+    }
+    QByteArray romData = file.readAll();
+    return std::make_shared<const ROMImage>(reinterpret_cast<const uint8_t *>(romData.data()), static_cast<size_t>(romData.size()));
+#else
+    std::ifstream romFile(path, std::ios::binary | std::ios::ate);
+    if (!romFile.good())
+    {
+        return nullptr;
+    }
+
+    std::streampos fileSize = romFile.tellg();
+    romFile.seekg(0, std::ios::beg);
+    std::vector<char> romData( static_cast<size_t>(fileSize) );
+    romFile.read(romData.data(), fileSize);
+    romFile.close();
+
+    return std::make_shared<const ROMImage>(reinterpret_cast<const uint8_t *>(romData.data()), romData.size());
+#endif
+}
+
+std::shared_ptr<const ROMImage> romCacheImageForPath(const std::string &path)
+{
+    std::lock_guard<std::mutex> lock(romCacheMutex);
+
+    auto cached = romCacheImages.find(path);
+    if (cached != romCacheImages.end())
+    {
+        return cached->second;
+    }
+
+    // Failed reads aren't cached so a ROM that turns up later can still be loaded
+    std::shared_ptr<const ROMImage> image = romCacheReadFile(path);
+    if (image)
+    {
+        romCacheImages[ path ] = image;
+    }
+
+    return image;
+}
+
+void romCacheAddImage(const std::string &path, const uint8_t *data, size_t size)
+{
+    std::shared_ptr<const ROMImage> image = std::make_shared<const ROMImage>(data, size);
+
+    std::lock_guard<std::mutex> lock(romCacheMutex);
+    romCacheImages[ path ] = image;
+}
+
+void romCacheRemoveImage(const std::string &path)
+{
+    std::lock_guard<std::mutex> lock(romCacheMutex);
+    romCacheImages.erase(path);
+}
+
+std::shared_ptr<const ROMImage> romCacheEmptyImage()
+{
+    static const std::shared_ptr<const ROMImage> emptyImage = std::make_shared<const ROMImage>(nullptr, 0);
+    return emptyImage;
+}
@@ -0,0 +1,55 @@
+//
+//  ROMCache.hpp
+//  SpectREM
+//
+
+#ifndef ROMCache_hpp
+#define ROMCache_hpp
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// - ROM image
+
+/**
+ A ROM image loaded from disk or supplied by the host. The contents are padded with zeros to a whole number of 16K pages
+ and start on a page aligned address. Images are never changed once they have been built, so a single copy can be shared
+ by every machine in the process and paged in by pointer.
+ **/
+class ROMImage
+{
+public:
+    static const size_t     cPAGE_SIZE = 16384;
+
+    ROMImage(const uint8_t *data, size_t size);
+
+    const uint8_t           *data() const { return bytes; }
+    size_t                  size() const { return length; }
+    size_t                  pages() const { return length / cPAGE_SIZE; }
+    const uint8_t           *page(size_t page) const { return bytes + page * cPAGE_SIZE; }
+
+private:
+    std::vector<uint8_t>    storage;
+    uint8_t                 *bytes;
+    size_t                  length;
+};
+
+// - ROM cache
+
+// The image for path, read from disk the first time it is asked for or supplied earlier with romCacheAddImage. Returns
+// nullptr if there is no image for path and the file can't be read
+std::shared_ptr<const ROMImage> romCacheImageForPath(const std::string &path);
+
+// Supplies the image for path from memory, replacing any image already cached for it. Machines that already have the
+// previous image paged in keep using it until they next load that ROM
+void romCacheAddImage(const std::string &path, const uint8_t *data, size_t size);
+
+// Drops the image for path so that it's read from disk again the next time it is asked for
+void romCacheRemoveImage(const std::string &path);
+
+// A single page of zeros, paged in wherever a ROM could not be found
+std::shared_ptr<const ROMImage> romCacheEmptyImage();
+
+#endif /* ROMCache_hpp */
@@ -116,6 +116,7 @@ bool ZXSpectrum::snapshotSNALoadWithPath(const char *path)
     displayFrameReset();
     displayClear();
     audioReset();
+    z80Core.InvalidateDecodeCache();
 
     fseek(fileHandle, 0, SEEK_END);
     size_t size = static_cast<size_t>( ftell(fileHandle) );
@@ -157,12 +158,12 @@ bool ZXSpectrum::snapshotSNALoadWithPath(const char *path)
             uint32_t snaAddr = cSNA_HEADER_SIZE;
             for (uint32_t i = 16384; i < (64 * 1024); i++)
             {
-                memoryRam[i] = static_cast<char>( pFileBytes[snaAddr++] );
+                memoryRamWrite(i, pFileBytes[snaAddr++]);
             }
 
             // Set the PC
-            uint8_t pc_lsb = static_cast<uint8_t>(memoryRam[z80Core.GetRegister(CZ80Core::eREG_SP)]);
-            uint8_t pc_msb = static_cast<uint8_t>(memoryRam[(z80Core.GetRegister(CZ80Core::eREG_SP) + 1)]);
+            uint8_t pc_lsb = memoryRamRead(z80Core.GetRegister(CZ80Core::eREG_SP));
+            uint8_t pc_msb = memoryRamRead(static_cast<uint16_t>(z80Core.GetRegister(CZ80Core::eREG_SP) + 1));
             z80Core.SetRegister(CZ80Core::eREG_PC, static_cast<uint16_t>((pc_msb << 8) | pc_lsb));
             z80Core.SetRegister(CZ80Core::eREG_SP, z80Core.GetRegister(CZ80Core::eREG_SP) + 2);
         }
@@ -337,7 +338,7 @@ ZXSpectrum::Snap ZXSpectrum::snapshotCreateZ80()
 
             for (uint32_t memAddr = page * 0x4000ul; memAddr < (page * 0x4000ul) + 0x4000ul; memAddr++)
             {
-                snapData.data[snapPtr++] = static_cast<uint8_t>(memoryRam[static_cast<size_t>(memAddr)]);
+                snapData.data[snapPtr++] = memoryRamRead(memAddr);
             }
         }
     }
@@ -365,6 +366,7 @@ bool ZXSpectrum::snapshotZ80LoadWithPath(const char *path)
     displayFrameReset();
     displayClear();
     audioReset();
+    z80Core.InvalidateDecodeCache();
 
     fseek(fileHandle, 0, SEEK_END);
     size_t size = static_cast<size_t>( ftell(fileHandle) );
@@ -482,6 +484,8 @@ bool ZXSpectrum::snapshotZ80LoadWithPath(const char *path)
                 emuRAMPage = 0;
                 emuDisplayPage = 1;
             }
+            
+            memoryBuildMap();
 
             while (offset < size)
             {
@@ -543,7 +547,7 @@ void ZXSpectrum::snapshotExtractMemoryBlock(uint8_t *fileBytes, uint32_t memAddr
     {
         while (memoryPtr < unpackedLength + memAddr)
         {
-            memoryRam[memoryPtr++] = static_cast<int8_t>(fileBytes[filePtr++]);
+            memoryRamWrite(memoryPtr++, fileBytes[filePtr++]);
         }
     }
     else
@@ -559,13 +563,13 @@ void ZXSpectrum::snapshotExtractMemoryBlock(uint8_t *fileBytes, uint32_t memAddr
                 uint8_t value = fileBytes[filePtr + 3];
                 for (uint32_t i = 0; i < count; i++)
                 {
-                    memoryRam[memoryPtr++] = static_cast<int8_t>(value);
+                    memoryRamWrite(memoryPtr++, value);
                 }
                 filePtr += 4;
             }
             else
             {
-                memoryRam[memoryPtr++] = static_cast<int8_t>(fileBytes[filePtr++]);
+                memoryRamWrite(memoryPtr++, fileBytes[filePtr++]);
             }
         }
     }
@@ -7,11 +7,11 @@
 //
 
 #include "ZXSpectrum.hpp"
+#include <algorithm>
 #include <cstring>
 
 const uint32_t cSAMPLE_RATE = 44100;
 const uint32_t cFPS = 50;
-const uint32_t cROM_SIZE = 16384;
 //const char *cSMART_ROM = "smartload.v31";
 
 // - Constructor/Deconstructor
@@ -19,17 +19,11 @@ const uint32_t cROM_SIZE = 16384;
 ZXSpectrum::ZXSpectrum()
 {
     std::cout << "ZXSpectrum::Constructor" << std::endl;
-    
-    displayCLUT = new uint64_t[32 * 1024];
-    displayALUT = new uint8_t[256];
 }
 
 ZXSpectrum::~ZXSpectrum()
 {
     std::cout << "ZXSpectrum::Destructor" << std::endl;
-    
-    delete [] displayCLUT;
-    delete [] displayALUT; 
 }
 
 // - Initialise
@@ -53,15 +47,32 @@ void ZXSpectrum::initialise(string romPath)
     screenHeight = machineInfo.pxEmuBorder + machineInfo.pxVerticalDisplay + machineInfo.pxEmuBorder;
     screenBufferSize = screenHeight * screenWidth;
     
-    memoryRom.resize( machineInfo.romSize );
-    memoryRam.resize( machineInfo.ramSize );
+    for (uint32_t page = 0; page < cMEMORY_ROM_PAGES; page++)
+    {
+        memoryRomImage[ page ] = romCacheEmptyImage();
+        memoryRomPage[ page ] = memoryRomImage[ page ]->page(0);
+        memoryRomCopy[ page ].clear();
+    }
+    for (uint32_t page = 0; page < cMEMORY_RAM_PAGES; page++)
+    {
+        memoryRamPages[ page ] = (page * cMEMORY_PAGE_SIZE < machineInfo.ramSize) ? make_shared<MemoryPage>() : nullptr;
+        memoryRamPage[ page ] = memoryRamPages[ page ] ? memoryRamPages[ page ]->data() : nullptr;
+        memoryRamShared[ page ] = false;
+    }
 
     displaySetup();
-    displayBuildLineAddressTable();
-    displayBuildTsTable();
-    displayBuildCLUT();
-    
-    ULABuildContentionTable();
+
+    const MachineTables &machineTables = machineTablesForMachine(machineInfo);
+    displayLineTable = machineTables.displayLineTable;
+    displayTsLeftBorderEnd = machineTables.displayTsLeftBorderEnd;
+    displayTsRightBorderStart = machineTables.displayTsRightBorderStart;
+    displayTsRightBorderEnd = machineTables.displayTsRightBorderEnd;
+    displayLineAddrTable = machineTables.displayLineAddrTable;
+    displayPixelMaskTable = machineTables.displayPixelMaskTable;
+    displayALUT = machineTables.displayALUT;
+    ULAMemoryContentionTable = machineTables.ULAMemoryContentionTable;
+    ULAContentionStart = machineTables.ULAContentionStart;
+    ULAContentionLength = machineTables.ULAContentionLength;
 
     audioSetup(cSAMPLE_RATE, cFPS);
     audioBuildAYVolumesTable();
@@ -72,6 +83,9 @@ void ZXSpectrum::initialise(string romPath)
 void ZXSpectrum::registerDebugOpCallback(std::function<bool(uint16_t, uint8_t)> debugOpCallbackBlock)
 {
     this->debugOpCallbackBlock = debugOpCallbackBlock;
+    
+    // The debugger may need to see memory accesses
+    memoryBuildMap();
 }
 
 // - Generate a frame
@@ -80,6 +94,12 @@ void ZXSpectrum::generateFrame()
 {
     uint32_t currentFrameTstates = machineInfo.tsPerFrame;
     
+    // A machine that has been sitting in the same loop for a while only needs its interrupt handler run
+    if (idleActive && idleSkipFrame())
+    {
+        return;
+    }
+    
     while (currentFrameTstates > 0 && !emuPaused && !breakpointHit)
     {
         if (debugOpCallbackBlock)
@@ -90,7 +110,21 @@ void ZXSpectrum::generateFrame()
             }
         }
         
-        uint32_t tStates = z80Core.Execute(1, machineInfo.intLength);
+        // Run to the next event. That is the end of the frame or the next edge from a playing tape, unless the debugger
+        // needs to see every instruction, in which case a horizon of 0 runs a single instruction. Interrupts are handled by
+        // the core and the display and audio are brought up to date by whatever changes them, so neither needs updating
+        // per instruction
+        uint32_t eventTs = machineInfo.tsPerFrame;
+        if (debugOpCallbackBlock)
+        {
+            eventTs = 0;
+        }
+        else if (tape && tape->playing)
+        {
+            eventTs = std::min(eventTs, z80Core.GetTStates() + tape->tsToNextEdge());
+        }
+        
+        uint32_t tStates = z80Core.ExecuteUntil(eventTs, machineInfo.intLength);
                 
         if (tape && tape->playing)
         {
@@ -109,26 +143,44 @@ void ZXSpectrum::generateFrame()
         {
             currentFrameTstates -= tStates;
             
-            audioUpdateWithTs(tStates);
+            audioUpdateWithTs(z80Core.GetTStates() - emuCurrentAudioTs);
 
             if (z80Core.GetTStates() >= machineInfo.tsPerFrame)
             {
-                z80Core.ResetTStates( machineInfo.tsPerFrame );
-                z80Core.SignalInterrupt();
-                
-                displayUpdateWithTs(static_cast<int32_t>(machineInfo.tsPerFrame - emuCurrentDisplayTs));
-                
-                emuFrameCounter++;
-                
-                audioLastIndex = audioBufferIndex;
-                displayFrameReset();
-                keyboardCheckCapsLockStatus();
-                audioDecayAYFloatingRegister();
+                emuEndFrame();
+                idleCheckFrame();
                 
                 currentFrameTstates = 0;
             }
         }
+
+        // The trap flags only apply to the instruction that triggered them. The opcode callback is now only
+        // called on trapped addresses so it can no longer be relied upon to clear them
+        emuSaveTrapTriggered = false;
+        emuLoadTrapTriggered = false;
+    }
+}
+
+void ZXSpectrum::emuEndFrame()
+{
+    z80Core.ResetTStates( machineInfo.tsPerFrame );
+    emuCurrentAudioTs -= machineInfo.tsPerFrame;
+    z80Core.SignalInterrupt();
+    
+    displayUpdateWithTs(static_cast<int32_t>(machineInfo.tsPerFrame - emuCurrentDisplayTs));
+    
+    if (displayRenderFrame)
+    {
+        displayBuildChangedRects();
+        displayPublishFrame();
     }
+    
+    emuFrameCounter++;
+    
+    audioLastIndex = audioBufferIndex;
+    displayFrameReset();
+    keyboardCheckCapsLockStatus();
+    audioDecayAYFloatingRegister();
 }
 
 // - Debug
@@ -152,9 +204,13 @@ void ZXSpectrum::step()
     }
     else
     {
+        // No audio is generated while stepping
+        emuCurrentAudioTs = z80Core.GetTStates();
+        
         if (z80Core.GetTStates() >= machineInfo.tsPerFrame)
         {
             z80Core.ResetTStates( machineInfo.tsPerFrame );
+            emuCurrentAudioTs -= machineInfo.tsPerFrame;
             z80Core.SignalInterrupt();
             
             emuFrameCounter++;
@@ -166,6 +222,9 @@ void ZXSpectrum::step()
         }
     }
 
+    emuSaveTrapTriggered = false;
+    emuLoadTrapTriggered = false;
+
     displayUpdateWithTs(static_cast<int32_t>(machineInfo.tsPerFrame - emuCurrentDisplayTs));
 }
 
@@ -220,24 +279,43 @@ void ZXSpectrum::resume()
     emuPaused = false;
 }
 
+// - Frame skip
+
+// When fast-forwarding only the frames that are shown need drawing. With a frame skip of n only every (n + 1)th frame is
+// drawn into displayBuffer, and displayRenderNextFrame() makes sure the next frame is drawn whatever the frame skip. The
+// display timing still runs on the frames that are not drawn so the floating bus, contention and border are unaffected.
+// displayRenderFrame says whether displayBuffer holds the frame generateFrame has just finished
+void ZXSpectrum::setFrameSkip(uint32_t frames)
+{
+    displayFrameSkip = frames;
+}
+
+void ZXSpectrum::displayRenderNextFrame()
+{
+    displayRenderRequested = true;
+}
+
 // - Reset
 
 void ZXSpectrum::resetMachine(bool hard)
 {
     if (hard)
     {
-        for (uint32_t i = 0; i < machineInfo.ramSize; i++)
+        for (uint32_t page = 0; page < machineInfo.ramSize / cMEMORY_PAGE_SIZE; page++)
         {
-            memoryRam[i] = static_cast<char>(rand() % 255);
+            uint8_t *memory = memoryRamWritablePage(page);
+            for (uint32_t i = 0; i < cMEMORY_PAGE_SIZE; i++)
+            {
+                memory[i] = static_cast<uint8_t>(rand() % 255);
+            }
         }
     }
     
-    delete [] displayBuffer;
-    
     displaySetup();
     
     z80Core.Reset(hard);
     emuReset();
+    memoryBuildMap();
     keyboardMapReset();
     displayFrameReset();
     audioReset();
@@ -248,52 +326,159 @@ void ZXSpectrum::emuReset()
     emuFrameCounter = 0;
     emuSaveTrapTriggered = false;
     emuLoadTrapTriggered = false;
+    idleReset();
 }
 
 // - ROM Loading
 
 void ZXSpectrum::loadROM(const char *rom, uint32_t page)
 {
-    size_t romAddress = cROM_SIZE * page;
+    memorySetROM(findROM(rom), page);
+}
+
+/**
+ Returns the image for a ROM from the ROM cache, which only reads the file the first time any machine asks for it. Images
+ supplied with romCacheAddImage can be registered under either the full path or just the ROM name. Returns nullptr if
+ the ROM can't be found.
+ **/
+shared_ptr<const ROMImage> ZXSpectrum::findROM(const char *rom)
+{
+#ifdef QT_SPECTRUM
+    string romPath = rom;
+#else
+    string romPath = emuROMPath;
+    romPath.append(rom);
+#endif
 
-    if (memoryRom.size() < romAddress)
+    shared_ptr<const ROMImage> image = romCacheImageForPath(romPath);
+    if (!image)
+    {
+        image = romCacheImageForPath(rom);
+    }
+
+    if (!image)
+    {
+        std::cout << "ZXSpectrum::findROM - Unable to load ROM " << romPath << std::endl;
+    }
+
+    return image;
+}
+
+// Pages image in starting at ROM page, with images larger than 16K filling the pages that follow. A ROM that couldn't be
+// found leaves whatever was paged in before
+void ZXSpectrum::memorySetROM(const shared_ptr<const ROMImage> &image, uint32_t page)
+{
+    if (page * cMEMORY_PAGE_SIZE >= machineInfo.romSize)
     {
         std::cout << "ZXSpectrum::loadROM - Unable to load into ROM page " << page << std::endl;
         exit(1);
     }
 
-    string romPath = emuROMPath;
-    romPath.append(rom);
+    if (!image)
+    {
+        return;
+    }
 
-#ifdef QT_SPECTRUM
-    QFile file(rom);
-    if (!file.open(QIODevice::ReadOnly)) return;
-    QByteArray romData = file.readAll();
-    std::memcpy(memoryRom.data(), romData.data(), file.size());
-#else
-    ifstream romFile(romPath, ios::binary | ios::ate);
-    if (romFile.good())
+    for (size_t imagePage = 0; imagePage < image->pages() && page * cMEMORY_PAGE_SIZE < machineInfo.romSize; imagePage++, page++)
     {
-        std::streampos fileSize = romFile.tellg();
-        romFile.seekg(0, ios::beg);
-        romFile.read(memoryRom.data() + romAddress, fileSize);
-        romFile.close();
+        memoryRomImage[ page ] = image;
+        memoryRomPage[ page ] = image->page( imagePage );
+        memoryRomCopy[ page ].clear();
     }
-#endif
+
+    memoryBuildMap();
+    z80Core.InvalidateDecodeCache();
+}
+
+// Writes to a ROM page are only made by the debugger. They go to a copy of the page so the shared image is left alone
+void ZXSpectrum::memoryWriteROM(uint32_t page, uint16_t offset, uint8_t byte)
+{
+    if (memoryRomCopy[ page ].empty())
+    {
+        memoryRomCopy[ page ].assign(memoryRomPage[ page ], memoryRomPage[ page ] + cMEMORY_PAGE_SIZE);
+        memoryRomPage[ page ] = memoryRomCopy[ page ].data();
+        memoryBuildMap();
+    }
+
+    memoryRomCopy[ page ][ offset ] = byte;
+    z80Core.InvalidateDecodeCache();
+}
+
+// Gives the machine its own copy of a RAM page it shares with a clone, unless every other machine sharing it has since
+// taken their own copy. The decode cache knows instructions by where they were fetched from, and the page given up can
+// be freed and its memory reused for another page, so anything decoded so far is dropped
+uint8_t *ZXSpectrum::memoryRamUnsharePage(uint32_t page)
+{
+    if (memoryRamPages[ page ].use_count() > 1)
+    {
+        memoryRamPages[ page ] = make_shared<MemoryPage>(*memoryRamPages[ page ]);
+        memoryRamPage[ page ] = memoryRamPages[ page ]->data();
+        z80Core.InvalidateDecodeCache();
+    }
+
+    memoryRamShared[ page ] = false;
+    memoryBuildMap();
+
+    return memoryRamPage[ page ];
+}
+
+// - Clone
+
+// Called by clone() once machine has been copied from this machine. Anything the copy still shares with this machine
+// that it must not is replaced, and RAM pages are marked as shared in both machines. Both decode caches are dropped as
+// the copy's refers to the memory of this machine, and the pages behind both will move as the machines write to them
+void ZXSpectrum::emuFinishClone(ZXSpectrum *machine)
+{
+    machine->z80Core.Initialise(zxSpectrumMemoryRead,
+                                zxSpectrumMemoryWrite,
+                                zxSpectrumIORead,
+                                zxSpectrumIOWrite,
+                                zxSpectrumMemoryContention,
+                                zxSpectrumDebugRead,
+                                zxSpectrumDebugWrite,
+                                machine);
+
+    machine->displayBuffer = machine->displayFrames.frame( machine->displayFrames.backIndex() );
+    machine->audioBuffer = new int16_t[ audioBufferSize ];
+    memcpy(machine->audioBuffer, audioBuffer, audioBufferSize * sizeof(int16_t));
+
+    for (uint32_t page = 0; page < cMEMORY_ROM_PAGES; page++)
+    {
+        if (!memoryRomCopy[ page ].empty())
+        {
+            machine->memoryRomPage[ page ] = machine->memoryRomCopy[ page ].data();
+        }
+    }
+
+    for (uint32_t page = 0; page < cMEMORY_RAM_PAGES; page++)
+    {
+        memoryRamShared[ page ] = machine->memoryRamShared[ page ] = (memoryRamPages[ page ] != nullptr);
+    }
+
+    memoryBuildMap();
+    machine->memoryBuildMap();
+    z80Core.InvalidateDecodeCache();
+    machine->z80Core.InvalidateDecodeCache();
 }
 
 // - Getters
 
+// The frame generateFrame drew last. Only for use on the emulation side, as the buffer is drawn into again once the
+// presentation thread has moved on from it
 void* ZXSpectrum::getScreenBuffer()
 {
-    return displayBuffer;
+    return displayFrames.frame( displayFrames.latestIndex() );
+}
+
+const uint8_t *ZXSpectrum::acquireLatestFrame()
+{
+    return displayFrames.acquireLatest();
 }
 
 // - Release
 
 void ZXSpectrum::release()
 {
-    delete[] displayBuffer;
     delete[] audioBuffer;
 }
 
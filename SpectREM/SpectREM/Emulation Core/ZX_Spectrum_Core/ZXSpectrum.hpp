@@ -11,6 +11,8 @@
 
 #define QT = true
 
+#include <array>
+#include <memory>
 #include <vector>
 #include <iostream>
 #include <fstream>
@@ -23,12 +25,17 @@
 
 #include "../Z80_Core/Z80Core.h"
 #include "MachineInfo.h"
+#include "DisplayFrameRing.hpp"
+#include "MachineTables.hpp"
+#include "ROMCache.hpp"
 #include "../Tape/Tape.hpp"
 
 using namespace std;
 
 // - Base ZXSpectrum class
 
+class ZXSpectrumBus;
+
 typedef enum {
     eULAPlusPaletteGroup = 0,
     eULAPlusModeGroup
@@ -42,6 +49,12 @@ public:
     static const uint16_t    cBITMAP_SIZE       = 6144;
     static const uint16_t    cATTR_SIZE         = 768;
     static const uint16_t    cMEMORY_PAGE_SIZE  = 16384;
+    static const uint16_t    cMEMORY_SLOT_SIZE  = 8192;
+    static const uint16_t    cMEMORY_SLOT_SHIFT = 13;
+    static const uint16_t    cMEMORY_SLOTS      = 8;
+    static const uint16_t    cMEMORY_ROM_PAGES  = 2;
+    static const uint16_t    cMEMORY_RAM_PAGES  = 8;
+    static const uint16_t    cMEMORY_PAGE_SHIFT = 14;
     
     enum
     {
@@ -180,6 +193,14 @@ public:
         float b;
         float a;
     } Color;
+    
+    // An area of displayBuffer in pixels
+    struct DisplayRect {
+        uint32_t    x = 0;
+        uint32_t    y = 0;
+        uint32_t    width = 0;
+        uint32_t    height = 0;
+    };
 
     
 public:
@@ -192,12 +213,23 @@ public:
     virtual void            resetToSnapLoad() = 0;
     void                    pause();
     void                    resume();
+    void                    setFrameSkip(uint32_t frames);
+    void                    displayRenderNextFrame();
     virtual void            release();
 
+    // Returns a new machine in exactly the same state as this one. RAM pages are shared with the clone until either
+    // machine writes to them, so cloning is cheap however much RAM the machine has. The clone uses the same tape
+    virtual ZXSpectrum      *clone() = 0;
+
     // Main function that when called generates an entire frame, which includes processing interrupts, beeper sound and AY Sound.
-    // On completion the displayBuffer member variable will contain RGBA formatted image data that can then be used to build a display image
+    // On completion getScreenBuffer() returns the frame that has just been drawn and the frame is also published for
+    // acquireLatestFrame()
     void                    generateFrame();
     
+    // For presenting frames on another thread. Returns the latest frame drawn, which stays valid and unchanged until
+    // acquireLatestFrame() is next called however many frames the emulation draws in the meantime
+    const uint8_t           *acquireLatestFrame();
+    
     void                    keyboardKeyDown(ZXSpectrumKey key);
     void                    keyboardKeyUp(ZXSpectrumKey key);
     void                    keyboardFlagsChanged(uint64_t flags, ZXSpectrumKey key);
@@ -218,13 +250,26 @@ public:
 
 protected:
     void                    emuReset();
+    void                    idleReset();
     void                    loadROM(const char *rom, uint32_t page);
+    shared_ptr<const ROMImage> findROM(const char *rom);
+    void                    memorySetROM(const shared_ptr<const ROMImage> &image, uint32_t page);
+    void                    memoryWriteROM(uint32_t page, uint16_t offset, uint8_t byte);
+    uint8_t                 memoryRamRead(uint32_t address) const;
+    void                    memoryRamWrite(uint32_t address, uint8_t data);
+    uint8_t                 *memoryRamWritablePage(uint32_t page);
+    void                    emuFinishClone(ZXSpectrum *machine);
+    virtual void            memoryBuildMap() = 0;
+    uint8_t                 *memoryRamUnsharePage(uint32_t page);
     
     void                    displayFrameReset();
     void                    displayUpdateWithTs(int32_t tStates);
+    void                    displaySetBorderColor(uint32_t color);
+    void                    displayMarkDirty(uint32_t page, uint32_t offset);
+    void                    displayInvalidate();
 
     void                    ULAApplyIOContention(uint16_t address, bool contended);
-    void                    ULABuildFloatingBusTable();
+    void                    ULAApplyMemoryContention();
     uint8_t                 ULAFloatingBus();
 
     void                    audioAYSetRegister(uint8_t reg);
@@ -236,16 +281,22 @@ protected:
     void                    audioDecayAYFloatingRegister();
     
 private:
-    void                    displayBuildTsTable();
-    void                    displayBuildLineAddressTable();
-    void                    displayBuildCLUT();
-    void                    ULABuildContentionTable();
     void                    audioBuildAYVolumesTable();
     void                    keyboardCheckCapsLockStatus();
     void                    keyboardMapReset();
+    void                    emuEndFrame();
+    bool                    idleAllowed();
+    void                    idleCheckFrame();
+    bool                    idleSkipFrame();
+    bool                    idleMemoryUnchanged();
     string                  snapshotHardwareTypeForVersion(uint32_t version, uint32_t hardwareType);
     void                    snapshotExtractMemoryBlock(uint8_t *fileBytes, uint32_t memAddr, uint32_t fileOffset, bool isCompressed, uint32_t unpackedLength);
     void                    displaySetup();
+    void                    displayStartFrame();
+    void                    displayBuildChangedRects();
+    void                    displayPublishFrame();
+    uint64_t                *displayBorderSpan(uint64_t *displayBuffer8, uint32_t tsFrom, uint32_t tsTo);
+    uint64_t                *displayPaperSpan(uint64_t *displayBuffer8, uint32_t line, uint32_t tsFrom, uint32_t tsTo);
     void                    displayClear();
     void                    audioSetup(double sampleRate, double fps);
     
@@ -261,7 +312,7 @@ private:
 public:
     virtual uint8_t         coreMemoryRead(uint16_t address) = 0;
     virtual void            coreMemoryWrite(uint16_t address, uint8_t data) = 0;
-    virtual void            coreMemoryContention(uint16_t address, uint32_t tStates) = 0;
+    void                    coreMemoryContention(uint16_t address, uint32_t tStates);
     virtual uint8_t         coreIORead(uint16_t address) = 0;
     virtual void            coreIOWrite(uint16_t address, uint8_t data) = 0;
 
@@ -269,10 +320,32 @@ public:
     virtual void            coreDebugWrite(uint16_t address, uint8_t byte, void *data) = 0;
         
     // Machine hardware
-    CZ80Core                z80Core;
+    CZ80CoreT<ZXSpectrumBus> z80Core;
+    
+    // The ROM paged in to each 16K ROM page. Images come from the ROM cache and are shared with every other machine using
+    // the same ROM, so loading a ROM only swaps pointers. A page the debugger writes to is copied into memoryRomCopy first
+    shared_ptr<const ROMImage> memoryRomImage[cMEMORY_ROM_PAGES];
+    const uint8_t           *memoryRomPage[cMEMORY_ROM_PAGES]{nullptr};
+    vector<uint8_t>         memoryRomCopy[cMEMORY_ROM_PAGES];
+
+    // RAM in 16K pages, addressed from 0 to ramSize. Pages are shared between a machine and its clones until one of them
+    // writes to the page and takes its own copy. The memory map leaves shared pages out of the write slots so that the
+    // first write to one goes through coreMemoryWrite, which needs to use memoryRamWrite or memoryRamWritablePage
+    typedef array<uint8_t, cMEMORY_PAGE_SIZE> MemoryPage;
+    shared_ptr<MemoryPage>  memoryRamPages[cMEMORY_RAM_PAGES];
+    uint8_t                 *memoryRamPage[cMEMORY_RAM_PAGES]{nullptr};
+    bool                    memoryRamShared[cMEMORY_RAM_PAGES]{false};
     
-    vector<char>            memoryRom;
-    vector<char>            memoryRam;
+    // Memory map of 8K slots, rebuilt by memoryBuildMap() whenever the paging changes. The core reads and writes through
+    // these pointers and a null pointer sends the access to coreMemoryRead/coreMemoryWrite instead, for anything that is
+    // more than a plain memory access such as ROM and screen writes, the SmartCard ROM switch or the debugger
+    uint8_t                 *memoryReadSlot[cMEMORY_SLOTS]{nullptr};
+    uint8_t                 *memoryWriteSlot[cMEMORY_SLOTS]{nullptr};
+    bool                    memoryContendedSlot[cMEMORY_SLOTS]{false};
+    
+    // Where the Z80 decode cache can fetch opcodes from. Null for slots that can't be read directly and for memory that
+    // is paged in at more than one address, as a write through one address would not drop what was decoded at the other
+    uint8_t                 *memoryCodeSlot[cMEMORY_SLOTS]{nullptr};
     
     uint8_t                 keyboardMap[8]{0};
     static KEYBOARD_ENTRY   keyboardLookup[];
@@ -285,6 +358,7 @@ public:
     // Emulation
     MachineInfo             machineInfo;
     uint32_t                emuCurrentDisplayTs = 0;
+    uint32_t                emuCurrentAudioTs = 0;
     uint32_t                emuFrameCounter = 0;
     bool                    emuPaused = 0;
     uint32_t                emuRAMPage = 0;
@@ -297,19 +371,52 @@ public:
     bool                    emuLoadTrapTriggered = 0;
     bool                    emuSaveTrapTriggered = 0;
     bool                    emuUseSpecDRUM = 0;
+    bool                    emuSkipIdleFrames = 0;
+    uint32_t                emuIdleFramesSkipped = 0;
 
-    // Display
-    uint8_t                 *displayBuffer;
+    // Display. displayBuffer is the frame in displayFrames being drawn into
+    DisplayFrameRing        displayFrames;
+    uint8_t                 *displayBuffer = nullptr;
     uint32_t                displayBufferIndex = 0;
     uint32_t                screenWidth = 48 + 256 + 48;
     uint32_t                screenHeight = 48 + 192 + 48;
     uint32_t                screenBufferSize = 0;
-    uint32_t                displayTstateTable[312][228]{{0}};
-    uint16_t                displayLineAddrTable[192]{0};
-    uint64_t                *displayCLUT = nullptr;
-    uint8_t                 *displayALUT = nullptr;
+    const uint8_t           *displayLineTable = nullptr;
+    uint32_t                displayTsLeftBorderEnd = 0;
+    uint32_t                displayTsRightBorderStart = 0;
+    uint32_t                displayTsRightBorderEnd = 0;
+    const uint16_t          *displayLineAddrTable = nullptr;
+    const uint64_t          *displayPixelMaskTable = nullptr;
+    const uint8_t           *displayALUT = nullptr;
     uint32_t                displayBorderColor = 0;
     bool                    displayReady = false;
+    uint32_t                displayFrameSkip = 0;
+    bool                    displayRenderRequested = false;
+    bool                    displayRenderFrame = true;
+    
+    // Display cells are 8 pixels of one line. Writes to the displayed screen mark the cells they change in
+    // displayDirtyLines and displayChangedLines, one bit per column for each line, and only dirty cells are drawn. A
+    // cell stays dirty until it is drawn, so a write behind the beam is drawn on the next frame that is rendered. The
+    // border is only drawn while the colour is changing, and displayBorderChanged says that it has changed.
+    // displayChangedRects lists the areas of displayBuffer that may have changed in the frame that was last rendered,
+    // in place of sending the whole buffer
+    uint32_t                displayDirtyLines[192]{0};
+    uint32_t                displayChangedLines[192]{0};
+    uint32_t                displayFrameChangedLines[192]{0};
+    bool                    displayBorderDirty = true;
+    bool                    displayBorderDirtyNext = true;
+    bool                    displayBorderChanged = true;
+    bool                    displayBorderChangedNext = true;
+    uint32_t                displayFlashPhase = 0;
+    vector<DisplayRect>     displayChangedRects;
+    
+    // Each buffer in displayFrames holds an older frame when it comes back to be drawn into, so the cells that changed
+    // in the frames since need drawing again as well. Frames are numbered from 1 as they are rendered, 0 being a buffer
+    // that doesn't hold a frame that can be brought up to date
+    uint32_t                displayFramesRendered = 0;
+    uint32_t                displayFrameNumber[DisplayFrameRing::cFRAMES]{0};
+    uint32_t                displayFrameChangedHistory[2][192]{{0}};
+    bool                    displayBorderChangedHistory[2]{false};
     Color                   clutBuffer[64];
     
     // ULAPlus
@@ -357,11 +464,17 @@ public:
     // Keyboard
     bool                    keyboardCapsLockPressed = false;
     
+    // Idle detection
+    bool                    idleActive = false;
+    uint32_t                idleFrameCount = 0;
+    uint16_t                idleSPLow = 0;
+    uint16_t                idleSPHigh = 0;
+    vector<uint8_t>         idleMemory;
+
     // ULA
-    uint32_t                ULAMemoryContentionTable[80000]{0};
-    uint32_t                ULAIOContentionTable[80000]{0};
-    uint32_t                ULAFloatingBusTable[80000]{0};
-    const static uint32_t   ULAConentionValues[];
+    const uint8_t           *ULAMemoryContentionTable = nullptr;
+    uint32_t                ULAContentionStart = 0;
+    uint32_t                ULAContentionLength = 0;
     uint8_t                 ULAPortnnFDValue = 0;
     bool                    ULAApplySnow = false;
     uint8_t                 ULAPlusMode = eULAplusModeGroup;
@@ -381,6 +494,129 @@ public:
 
 };
 
+// - Memory
+
+inline uint8_t ZXSpectrum::memoryRamRead(uint32_t address) const
+{
+    return memoryRamPage[ address >> cMEMORY_PAGE_SHIFT ][ address & (cMEMORY_PAGE_SIZE - 1) ];
+}
+
+inline uint8_t *ZXSpectrum::memoryRamWritablePage(uint32_t page)
+{
+    return memoryRamShared[ page ] ? memoryRamUnsharePage(page) : memoryRamPage[ page ];
+}
+
+inline void ZXSpectrum::memoryRamWrite(uint32_t address, uint8_t data)
+{
+    memoryRamWritablePage(address >> cMEMORY_PAGE_SHIFT)[ address & (cMEMORY_PAGE_SIZE - 1) ] = data;
+}
+
+// - Memory contention
+
+inline void ZXSpectrum::coreMemoryContention(uint16_t address, uint32_t)
+{
+    if (memoryContendedSlot[address >> cMEMORY_SLOT_SHIFT])
+    {
+        ULAApplyMemoryContention();
+    }
+}
+
+// Outside of the window the ULA fetches the display in there is never any contention, which saves the table lookup
+// and the divide needed to wrap the T-state count. The window ends before the end of the frame so a T-state count
+// inside it never needs wrapping
+inline void ZXSpectrum::ULAApplyMemoryContention()
+{
+    uint32_t ts = z80Core.GetTStates() - ULAContentionStart;
+    if (ts < ULAContentionLength)
+    {
+        z80Core.AddContentionTStates( ULAMemoryContentionTable[z80Core.GetTStates()] );
+    }
+}
+
+// - Display
+
+// Writes to the bitmap mark the cell written to and writes to an attribute mark the 8 cells it colours
+inline void ZXSpectrum::displayMarkDirty(uint32_t page, uint32_t offset)
+{
+    if (page != emuDisplayPage || offset >= cBITMAP_SIZE + cATTR_SIZE)
+    {
+        return;
+    }
+    
+    if (offset < cBITMAP_SIZE)
+    {
+        const uint32_t line = ( ( offset >> 5 ) & 0xc0 ) | ( ( offset >> 2 ) & 0x38 ) | ( ( offset >> 8 ) & 0x07 );
+        displayDirtyLines[ line ] |= 1u << ( offset & 31 );
+        displayChangedLines[ line ] |= 1u << ( offset & 31 );
+    }
+    else
+    {
+        const uint32_t line = ( ( offset - cBITMAP_SIZE ) >> 5 ) << 3;
+        for (uint32_t i = 0; i < 8; i++)
+        {
+            displayDirtyLines[ line + i ] |= 1u << ( offset & 31 );
+            displayChangedLines[ line + i ] |= 1u << ( offset & 31 );
+        }
+    }
+}
+
+// - Z80 bus
+
+// The bus the Z80 core is built with for the ZXSpectrum machines. Memory access and contention use the memory map so
+// they are inlined into every opcode. Anything the memory map can't handle, and IO, goes straight to the machines core
+// functions rather than through the function pointers passed to the core
+class ZXSpectrumBus
+{
+public:
+    static uint8_t MemRead(CZ80CoreT<ZXSpectrumBus> &core, uint16_t address)
+    {
+        ZXSpectrum *machine = static_cast<ZXSpectrum *>(core.m_Param);
+        const uint8_t *memory = machine->memoryReadSlot[address >> ZXSpectrum::cMEMORY_SLOT_SHIFT];
+        
+        if (memory != nullptr)
+        {
+            return memory[address & (ZXSpectrum::cMEMORY_SLOT_SIZE - 1)];
+        }
+        
+        return machine->coreMemoryRead(address);
+    }
+    
+    static void MemWrite(CZ80CoreT<ZXSpectrumBus> &core, uint16_t address, uint8_t data)
+    {
+        ZXSpectrum *machine = static_cast<ZXSpectrum *>(core.m_Param);
+        uint8_t *memory = machine->memoryWriteSlot[address >> ZXSpectrum::cMEMORY_SLOT_SHIFT];
+        
+        if (memory != nullptr)
+        {
+            memory[address & (ZXSpectrum::cMEMORY_SLOT_SIZE - 1)] = data;
+            return;
+        }
+        
+        machine->coreMemoryWrite(address, data);
+    }
+    
+    static void MemContention(CZ80CoreT<ZXSpectrumBus> &core, uint16_t address, uint32_t tStates)
+    {
+        static_cast<ZXSpectrum *>(core.m_Param)->coreMemoryContention(address, tStates);
+    }
+    
+    static uint8_t IORead(CZ80CoreT<ZXSpectrumBus> &core, uint16_t address)
+    {
+        return static_cast<ZXSpectrum *>(core.m_Param)->coreIORead(address);
+    }
+    
+    static void IOWrite(CZ80CoreT<ZXSpectrumBus> &core, uint16_t address, uint8_t data)
+    {
+        static_cast<ZXSpectrum *>(core.m_Param)->coreIOWrite(address, data);
+    }
+    
+    static const uint8_t *CodePointer(CZ80CoreT<ZXSpectrumBus> &core, uint16_t address)
+    {
+        const uint8_t *memory = static_cast<ZXSpectrum *>(core.m_Param)->memoryCodeSlot[address >> ZXSpectrum::cMEMORY_SLOT_SHIFT];
+        return (memory != nullptr) ? memory + (address & (ZXSpectrum::cMEMORY_SLOT_SIZE - 1)) : nullptr;
+    }
+};
+
 #endif /* ZXSpectrum_hpp */
 
 
@@ -112,7 +112,7 @@ const int cSCREEN_FILL = 1;
                 dispatch_async(dispatch_get_main_queue(), ^{
                     if (self.view.window.occlusionState & NSApplicationOcclusionStateVisible)
                     {
-                        [_metalRenderer updateTextureData:_machine->getScreenBuffer()];
+                        [_metalRenderer updateTextureData:_machine->acquireLatestFrame()];
                     }
                 });
             }
@@ -128,11 +128,13 @@ const int cSCREEN_FILL = 1;
         [_accelerationTimer invalidate];
         _accelerationTimer = [NSTimer timerWithTimeInterval:1.0 / (cFRAMES_PER_SECOND * _defaults.machineAcceleration) repeats:YES block:^(NSTimer * _Nonnull timer) {
             
+            // Only the frames that are shown are drawn
+            _machine->setFrameSkip(static_cast<uint32_t>(_defaults.machineAcceleration) - 1);
             _machine->generateFrame();
             
-            if (!(_machine->emuFrameCounter % static_cast<uint32_t>(_defaults.machineAcceleration)))
+            if (_machine->displayRenderFrame)
             {
-                [_metalRenderer updateTextureData:_machine->getScreenBuffer()];
+                [_metalRenderer updateTextureData:_machine->acquireLatestFrame()];
             }
         }];
         
@@ -141,6 +143,7 @@ const int cSCREEN_FILL = 1;
     else
     {
         [_accelerationTimer invalidate];
+        _machine->setFrameSkip(0);
     }
 }
 
@@ -287,7 +287,7 @@ void OpenGLView::SetupTexture()
 
 //-----------------------------------------------------------------------------------------
 
-void OpenGLView::UpdateTextureData(unsigned char *pData)
+void OpenGLView::UpdateTextureData(const unsigned char *pData)
 {
     glClearColor(0.0f, 1.0f, 1.0f, 0.5f);
     glClear(GL_COLOR_BUFFER_BIT);
@@ -107,7 +107,7 @@ public:
 	void								Deinit();
 	bool								Init(HWND hWnd, int width, int height);
 
-	void								UpdateTextureData(unsigned char *pData);
+	void								UpdateTextureData(const unsigned char *pData);
 
 private:
 	bool								InitialiseExtensions();
@@ -236,7 +236,8 @@ int __stdcall WinMain(HINSTANCE inst, HINSTANCE prev, LPSTR cmd, int ncmd)
 			{
 				last_time = time;
 
-				m_pOpenGLView->UpdateTextureData(m_pMachine->displayBuffer);
+				// Frames are generated on the audio thread
+				m_pOpenGLView->UpdateTextureData(m_pMachine->acquireLatestFrame());
 
 				// Force the window to redraw
 				//InvalidateRect(window, NULL, true);
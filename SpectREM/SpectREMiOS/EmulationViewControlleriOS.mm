@@ -176,7 +176,7 @@ NSString  *const cSESSION_FILE_NAME = @"session.z80";
         if (_audioQueue->bufferUsed() <= b)
         {
             _machine->generateFrame();
-            [_metalRenderer updateTextureData:_machine->getScreenBuffer()];
+            [_metalRenderer updateTextureData:_machine->acquireLatestFrame()];
             _audioQueue->write(_machine->audioBuffer, b);
         }
     }
@@ -0,0 +1,704 @@
+//
+//  Z80Tester.cpp
+//  SpectREM
+//
+//  Command line conformance and throughput tester for CZ80Core. It runs zexdoc/zexall style CP/M programs and FUSE
+//  style per opcode test vectors against the core on a flat 64K memory bus, spreading the work over every CPU core, and
+//  reports pass/fail along with instructions per second for each zex test and each opcode group.
+//
+//  CMakeLists.txt in this directory builds z80tester along with a build for each of the Z80CORE_ options, and runs
+//  them all with ctest when given the test files. Each build is run with:
+//
+//      z80tester [-j threads] [-r repeat] [-zex zexdoc.com]... [-fuse tests.in tests.expected]
+//
+//  Each test in a zex program is run on its own so they can be run in parallel. -r runs each FUSE test that many times
+//  to give a useful instructions per second figure. The exit code is 1 if anything failed.
+//
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Z80_Core/Z80Core.h"
+
+using namespace std;
+
+// - Machine
+
+// 64K of RAM, with IO reads returning the high byte of the port as the FUSE tests expect. Writes to port 0 are the
+// CP/M BDOS calls made by the zex programs
+class Machine
+{
+public:
+    Machine()
+    {
+        core.Initialise(memRead, memWrite, ioRead, ioWrite, nullptr, debugRead, nullptr, this);
+    }
+
+    static uint8_t memRead(uint16_t address, void *param)
+    {
+        return static_cast<Machine *>(param)->memory[address];
+    }
+
+    static void memWrite(uint16_t address, uint8_t data, void *param)
+    {
+        static_cast<Machine *>(param)->memory[address] = data;
+    }
+
+    static uint8_t ioRead(uint16_t address, void *)
+    {
+        return address >> 8;
+    }
+
+    static void ioWrite(uint16_t address, uint8_t, void *param)
+    {
+        if ((address & 0xff) == 0)
+        {
+            static_cast<Machine *>(param)->bdosCall();
+        }
+    }
+
+    static uint8_t debugRead(uint16_t address, void *param, void *)
+    {
+        return static_cast<Machine *>(param)->memory[address];
+    }
+
+    // Console output is all the zex programs need. C = 2 prints the character in E, C = 9 the string at DE up to a $
+    void bdosCall()
+    {
+        switch (core.GetRegister(CZ80Core::eREG_C))
+        {
+            case 2:
+                output += static_cast<char>(core.GetRegister(CZ80Core::eREG_E));
+                break;
+
+            case 9:
+                for (uint16_t address = core.GetRegister(CZ80Core::eREG_DE); memory[address] != '$'; address++)
+                {
+                    output += static_cast<char>(memory[address]);
+                }
+                break;
+        }
+    }
+
+    CZ80Core                core;
+    uint8_t                 memory[65536];
+    string                  output;
+};
+
+// - Results
+
+struct Result
+{
+    string                  group;
+    string                  name;
+    bool                    passed = false;
+    string                  detail;
+    uint64_t                instructions = 0;
+    double                  seconds = 0;
+};
+
+static double mips(uint64_t instructions, double seconds)
+{
+    return (seconds > 0) ? instructions / seconds / 1000000.0 : 0;
+}
+
+// - Zex
+
+const uint16_t cCPM_TPA = 0x0100;
+const uint16_t cCPM_BDOS = 0xfe00;
+const uint64_t cZEX_INSTRUCTION_LIMIT = 100000000000ull;
+
+struct ZexProgram
+{
+    string                  name;
+    vector<uint8_t>         code;
+    uint16_t                testTable = 0;      // Address of the table of tests, 0 if it couldn't be found
+    vector<uint16_t>        tests;
+};
+
+// The tests are listed in a table of pointers into the program ending with 0. Finding the longest such run of words
+// means the tests can be run one at a time without knowing which build of zexdoc/zexall this is
+static void zexFindTests(ZexProgram &program)
+{
+    uint32_t end = cCPM_TPA + static_cast<uint32_t>(program.code.size());
+    auto word = [&](uint32_t address) { return static_cast<uint32_t>(program.code[address - cCPM_TPA] | (program.code[address - cCPM_TPA + 1] << 8)); };
+
+    for (uint32_t address = cCPM_TPA; address + 1 < end; address++)
+    {
+        vector<uint16_t> tests;
+        uint32_t entry = address;
+        while (entry + 1 < end && word(entry) >= cCPM_TPA && word(entry) < end)
+        {
+            tests.push_back(word(entry));
+            entry += 2;
+        }
+
+        if (entry + 1 < end && word(entry) == 0 && tests.size() > program.tests.size())
+        {
+            program.testTable = address;
+            program.tests = tests;
+        }
+    }
+
+    // Anything short is more likely to be code than the table
+    if (program.tests.size() < 8)
+    {
+        program.testTable = 0;
+        program.tests.clear();
+    }
+}
+
+// Runs the program, or the single test given by test, until it jumps back to CP/M at 0
+static void zexRun(const ZexProgram &program, int test, Result &result)
+{
+    Machine *machine = new Machine();
+    memset(machine->memory, 0, sizeof(machine->memory));
+    memcpy(&machine->memory[cCPM_TPA], program.code.data(), program.code.size());
+
+    // 0x0000 HALT for the warm boot, 0x0005 JP to the BDOS which is OUT (0),A : RET. The address in the JP is also
+    // where the programs put their stack
+    machine->memory[0x0000] = 0x76;
+    machine->memory[0x0005] = 0xc3;
+    machine->memory[0x0006] = cCPM_BDOS & 0xff;
+    machine->memory[0x0007] = cCPM_BDOS >> 8;
+    machine->memory[cCPM_BDOS] = 0xd3;
+    machine->memory[cCPM_BDOS + 1] = 0x00;
+    machine->memory[cCPM_BDOS + 2] = 0xc9;
+
+    if (test >= 0)
+    {
+        machine->memory[program.testTable] = program.tests[test] & 0xff;
+        machine->memory[program.testTable + 1] = program.tests[test] >> 8;
+        machine->memory[program.testTable + 2] = 0;
+        machine->memory[program.testTable + 3] = 0;
+    }
+
+    machine->core.Reset();
+    machine->core.SetRegister(CZ80Core::eREG_PC, cCPM_TPA);
+    machine->core.SetRegister(CZ80Core::eREG_SP, cCPM_BDOS);
+
+    auto start = chrono::steady_clock::now();
+    while (!machine->core.GetHalted() && result.instructions < cZEX_INSTRUCTION_LIMIT)
+    {
+        machine->core.Execute(0);
+        result.instructions++;
+    }
+    result.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    // Each test prints its name followed by OK or ERROR and the CRCs
+    istringstream lines(machine->output);
+    string line;
+    uint32_t passed = 0;
+    uint32_t failed = 0;
+    while (getline(lines, line))
+    {
+        while (!line.empty() && (line.back() == '\r' || line.back() == '\n'))
+        {
+            line.pop_back();
+        }
+
+        size_t ok = line.find("OK");
+        size_t error = line.find("ERROR");
+        if (ok == string::npos && error == string::npos)
+        {
+            continue;
+        }
+
+        if (error != string::npos)
+        {
+            failed++;
+            result.detail += line + " ";
+        }
+        else
+        {
+            passed++;
+        }
+
+        if (test >= 0)
+        {
+            size_t end = min(ok, error);
+            result.name = line.substr(0, line.find_last_not_of(". ", end - 1) + 1);
+            if (error != string::npos)
+            {
+                result.detail = line.substr(error);
+            }
+        }
+    }
+
+    result.passed = (passed > 0 && failed == 0);
+    if (result.name.empty())
+    {
+        result.name = (test >= 0) ? "test " + to_string(test) : "all tests";
+    }
+    if (passed + failed == 0)
+    {
+        result.detail = machine->core.GetHalted() ? "no result printed" : "did not finish";
+    }
+
+    delete machine;
+}
+
+static bool zexLoad(const string &path, ZexProgram &program)
+{
+    ifstream file(path, ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+
+    program.code.assign(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+    if (program.code.empty() || program.code.size() > cCPM_BDOS - cCPM_TPA)
+    {
+        return false;
+    }
+
+    size_t slash = path.find_last_of("/\\");
+    program.name = (slash == string::npos) ? path : path.substr(slash + 1);
+    zexFindTests(program);
+    return true;
+}
+
+// - FUSE
+
+const uint32_t cFUSE_REGISTERS = 13;
+
+struct FuseTest
+{
+    string                  name;
+    uint16_t                registers[cFUSE_REGISTERS];     // AF BC DE HL AF' BC' DE' HL' IX IY SP PC MEMPTR
+    uint32_t                state[7];                       // I R IFF1 IFF2 IM halted tstates
+    vector<pair<uint16_t, vector<uint8_t>>> memory;
+};
+
+static bool fuseReadLine(istream &in, string &line)
+{
+    while (getline(in, line))
+    {
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+        if (!line.empty())
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool fuseReadRegisters(istream &in, FuseTest &test)
+{
+    string line;
+    if (!fuseReadLine(in, line))
+    {
+        return false;
+    }
+    istringstream registers(line);
+    for (uint32_t i = 0; i < cFUSE_REGISTERS; i++)
+    {
+        registers >> hex >> test.registers[i];
+    }
+
+    if (!fuseReadLine(in, line))
+    {
+        return false;
+    }
+    istringstream state(line);
+    state >> hex >> test.state[0] >> test.state[1] >> dec >> test.state[2] >> test.state[3] >> test.state[4] >> test.state[5] >> test.state[6];
+    return !state.fail();
+}
+
+// Memory blocks are an address followed by bytes and -1. In tests.in the list of blocks also ends with -1, in
+// tests.expected it ends at a blank line
+static void fuseReadMemory(istream &in, FuseTest &test, bool expected)
+{
+    string line;
+    while (true)
+    {
+        streampos position = in.tellg();
+        if (!getline(in, line))
+        {
+            return;
+        }
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+        if (line.empty() || line == "-1")
+        {
+            if (expected || line == "-1")
+            {
+                return;
+            }
+            continue;
+        }
+        if (expected && !isxdigit(line[0]))
+        {
+            in.seekg(position);
+            return;
+        }
+
+        istringstream block(line);
+        string value;
+        block >> value;
+        pair<uint16_t, vector<uint8_t>> entry(static_cast<uint16_t>(stoul(value, nullptr, 16)), {});
+        while (block >> value && value != "-1")
+        {
+            entry.second.push_back(static_cast<uint8_t>(stoul(value, nullptr, 16)));
+        }
+        test.memory.push_back(entry);
+    }
+}
+
+static bool fuseLoad(const string &inPath, const string &expectedPath, vector<FuseTest> &tests, vector<FuseTest> &expected)
+{
+    ifstream in(inPath);
+    ifstream out(expectedPath);
+    if (!in || !out)
+    {
+        return false;
+    }
+
+    string line;
+    while (fuseReadLine(in, line))
+    {
+        FuseTest test;
+        test.name = line;
+        if (!fuseReadRegisters(in, test))
+        {
+            return false;
+        }
+        fuseReadMemory(in, test, false);
+        tests.push_back(test);
+    }
+
+    while (fuseReadLine(out, line))
+    {
+        FuseTest test;
+        test.name = line;
+
+        // Skip the bus events, which start with white space
+        streampos position = out.tellg();
+        while (getline(out, line) && !line.empty() && isspace(line[0]))
+        {
+            position = out.tellg();
+        }
+        out.seekg(position);
+
+        if (!fuseReadRegisters(out, test))
+        {
+            return false;
+        }
+        fuseReadMemory(out, test, true);
+        expected.push_back(test);
+    }
+
+    return tests.size() == expected.size();
+}
+
+// FUSE names the tests after the opcode bytes, so the prefix gives the group
+static string fuseGroup(const string &name)
+{
+    for (const char *prefix : { "ddcb", "fdcb", "cb", "dd", "ed", "fd" })
+    {
+        if (name.compare(0, strlen(prefix), prefix) == 0)
+        {
+            return prefix;
+        }
+    }
+    return "base";
+}
+
+static void fuseSetup(Machine &machine, const FuseTest &test)
+{
+    for (uint32_t i = 0; i < sizeof(machine.memory); i += 4)
+    {
+        machine.memory[i] = 0xde;
+        machine.memory[i + 1] = 0xad;
+        machine.memory[i + 2] = 0xbe;
+        machine.memory[i + 3] = 0xef;
+    }
+    for (auto &block : test.memory)
+    {
+        for (size_t i = 0; i < block.second.size(); i++)
+        {
+            machine.memory[static_cast<uint16_t>(block.first + i)] = block.second[i];
+        }
+    }
+
+    machine.core.Reset();
+
+    CZ80Core::Z80State state;
+    machine.core.GetState(state);
+    CZ80Core::Z80Registers &registers = state.registers;
+    registers.reg_pairs.regAF = test.registers[0];
+    registers.reg_pairs.regBC = test.registers[1];
+    registers.reg_pairs.regDE = test.registers[2];
+    registers.reg_pairs.regHL = test.registers[3];
+    registers.reg_pairs.regAF_ = test.registers[4];
+    registers.reg_pairs.regBC_ = test.registers[5];
+    registers.reg_pairs.regDE_ = test.registers[6];
+    registers.reg_pairs.regHL_ = test.registers[7];
+    registers.reg_pairs.regIX = test.registers[8];
+    registers.reg_pairs.regIY = test.registers[9];
+    registers.regSP = test.registers[10];
+    registers.regPC = test.registers[11];
+    state.MEMPTR = test.registers[12];
+    registers.regI = static_cast<uint8_t>(test.state[0]);
+    registers.regR = static_cast<uint8_t>(test.state[1]);
+    registers.IFF1 = static_cast<uint8_t>(test.state[2]);
+    registers.IFF2 = static_cast<uint8_t>(test.state[3]);
+    registers.IM = static_cast<uint8_t>(test.state[4]);
+    registers.Halted = test.state[5] != 0;
+    registers.TStates = 0;
+    machine.core.SetState(state);
+}
+
+static void fuseRun(const FuseTest &test, const FuseTest &expected, uint32_t repeat, Result &result)
+{
+    Machine *machine = new Machine();
+    result.group = fuseGroup(test.name);
+    result.name = test.name;
+
+    // Repeats only need the CPU state and the memory the test changes putting back
+    fuseSetup(*machine, test);
+    CZ80Core::Z80State initial;
+    machine->core.GetState(initial);
+    vector<pair<uint16_t, uint8_t>> written;
+    for (auto &block : expected.memory)
+    {
+        for (size_t i = 0; i < block.second.size(); i++)
+        {
+            uint16_t address = static_cast<uint16_t>(block.first + i);
+            written.push_back(make_pair(address, machine->memory[address]));
+        }
+    }
+
+    auto start = chrono::steady_clock::now();
+    for (uint32_t i = 0; i < repeat; i++)
+    {
+        if (i > 0)
+        {
+            machine->core.SetState(initial);
+            for (auto &byte : written)
+            {
+                machine->memory[byte.first] = byte.second;
+            }
+        }
+
+        while (machine->core.GetTStates() < test.state[6])
+        {
+            machine->core.Execute(0);
+            result.instructions++;
+        }
+    }
+    result.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    CZ80Core::Z80State state;
+    machine->core.GetState(state);
+    const CZ80Core::Z80Registers &registers = state.registers;
+    uint16_t actual[cFUSE_REGISTERS] = {
+        registers.reg_pairs.regAF, registers.reg_pairs.regBC, registers.reg_pairs.regDE, registers.reg_pairs.regHL,
+        registers.reg_pairs.regAF_, registers.reg_pairs.regBC_, registers.reg_pairs.regDE_, registers.reg_pairs.regHL_,
+        registers.reg_pairs.regIX, registers.reg_pairs.regIY, registers.regSP, registers.regPC, state.MEMPTR
+    };
+    uint32_t actualState[7] = {
+        registers.regI, registers.regR, registers.IFF1, registers.IFF2, registers.IM, registers.Halted, registers.TStates
+    };
+    static const char *registerNames[cFUSE_REGISTERS] = { "AF", "BC", "DE", "HL", "AF'", "BC'", "DE'", "HL'", "IX", "IY", "SP", "PC", "MEMPTR" };
+    static const char *stateNames[7] = { "I", "R", "IFF1", "IFF2", "IM", "halted", "tstates" };
+
+    char buffer[64];
+    for (uint32_t i = 0; i < cFUSE_REGISTERS; i++)
+    {
+        if (actual[i] != expected.registers[i])
+        {
+            snprintf(buffer, sizeof(buffer), " %s %04x!=%04x", registerNames[i], actual[i], expected.registers[i]);
+            result.detail += buffer;
+        }
+    }
+    for (uint32_t i = 0; i < 7; i++)
+    {
+        if (actualState[i] != expected.state[i])
+        {
+            snprintf(buffer, sizeof(buffer), " %s %x!=%x", stateNames[i], actualState[i], expected.state[i]);
+            result.detail += buffer;
+        }
+    }
+    for (auto &block : expected.memory)
+    {
+        for (size_t i = 0; i < block.second.size(); i++)
+        {
+            uint16_t address = static_cast<uint16_t>(block.first + i);
+            if (machine->memory[address] != block.second[i])
+            {
+                snprintf(buffer, sizeof(buffer), " (%04x) %02x!=%02x", address, machine->memory[address], block.second[i]);
+                result.detail += buffer;
+            }
+        }
+    }
+
+    result.passed = result.detail.empty();
+    delete machine;
+}
+
+// - Main
+
+static void runJobs(vector<function<void()>> &jobs, uint32_t threads)
+{
+    atomic<size_t> next(0);
+    vector<thread> workers;
+    for (uint32_t i = 0; i < threads; i++)
+    {
+        workers.emplace_back([&]() {
+            for (size_t job = next++; job < jobs.size(); job = next++)
+            {
+                jobs[job]();
+            }
+        });
+    }
+    for (auto &worker : workers)
+    {
+        worker.join();
+    }
+}
+
+static int usage()
+{
+    fprintf(stderr, "usage: z80tester [-j threads] [-r repeat] [-zex program.com]... [-fuse tests.in tests.expected]\n");
+    return 2;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t threads = max(1u, thread::hardware_concurrency());
+    uint32_t repeat = 1;
+    vector<ZexProgram> programs;
+    vector<FuseTest> fuseTests;
+    vector<FuseTest> fuseExpected;
+
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg == "-j" && i + 1 < argc)
+        {
+            threads = max(1, atoi(argv[++i]));
+        }
+        else if (arg == "-r" && i + 1 < argc)
+        {
+            repeat = max(1, atoi(argv[++i]));
+        }
+        else if (arg == "-zex" && i + 1 < argc)
+        {
+            ZexProgram program;
+            if (!zexLoad(argv[++i], program))
+            {
+                fprintf(stderr, "Unable to load %s\n", argv[i]);
+                return 2;
+            }
+            programs.push_back(program);
+        }
+        else if (arg == "-fuse" && i + 2 < argc)
+        {
+            if (!fuseLoad(argv[i + 1], argv[i + 2], fuseTests, fuseExpected))
+            {
+                fprintf(stderr, "Unable to load the FUSE tests from %s and %s\n", argv[i + 1], argv[i + 2]);
+                return 2;
+            }
+            i += 2;
+        }
+        else
+        {
+            return usage();
+        }
+    }
+
+    if (programs.empty() && fuseTests.empty())
+    {
+        return usage();
+    }
+
+    // One job per zex test, or per program if its test table couldn't be found, and one per FUSE test
+    vector<Result> zexResults;
+    vector<Result> fuseResults(fuseTests.size());
+    vector<function<void()>> jobs;
+
+    for (auto &program : programs)
+    {
+        size_t count = max<size_t>(1, program.tests.size());
+        for (size_t test = 0; test < count; test++)
+        {
+            zexResults.emplace_back();
+            zexResults.back().group = program.name;
+        }
+    }
+
+    size_t index = 0;
+    for (auto &program : programs)
+    {
+        if (program.tests.empty())
+        {
+            Result *result = &zexResults[index++];
+            jobs.push_back([&program, result]() { zexRun(program, -1, *result); });
+        }
+        for (size_t test = 0; test < program.tests.size(); test++)
+        {
+            Result *result = &zexResults[index++];
+            jobs.push_back([&program, test, result]() { zexRun(program, static_cast<int>(test), *result); });
+        }
+    }
+
+    for (size_t test = 0; test < fuseTests.size(); test++)
+    {
+        jobs.push_back([&, test]() { fuseRun(fuseTests[test], fuseExpected[test], repeat, fuseResults[test]); });
+    }
+
+    auto start = chrono::steady_clock::now();
+    runJobs(jobs, threads);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    uint32_t failed = 0;
+
+    for (auto &result : zexResults)
+    {
+        printf("%-12s %-40s %-5s %14llu instructions %8.2f MIPS %s\n", result.group.c_str(), result.name.c_str(), result.passed ? "OK" : "FAIL",
+               static_cast<unsigned long long>(result.instructions), mips(result.instructions, result.seconds), result.detail.c_str());
+        failed += !result.passed;
+    }
+
+    // FUSE results are summed per opcode group, with only the failures listed individually
+    map<string, Result> groups;
+    map<string, pair<uint32_t, uint32_t>> groupCounts;
+    for (auto &result : fuseResults)
+    {
+        if (!result.passed)
+        {
+            printf("fuse         %-40s FAIL %s\n", result.name.c_str(), result.detail.c_str());
+            failed++;
+        }
+
+        groups[result.group].instructions += result.instructions;
+        groups[result.group].seconds += result.seconds;
+        groupCounts[result.group].first += result.passed;
+        groupCounts[result.group].second++;
+    }
+    for (auto &group : groups)
+    {
+        printf("fuse         %-40s %4u/%-4u passed %14llu instructions %8.2f MIPS\n", group.first.c_str(),
+               groupCounts[group.first].first, groupCounts[group.first].second,
+               static_cast<unsigned long long>(group.second.instructions), mips(group.second.instructions, group.second.seconds));
+    }
+
+    printf("%zu jobs on %u threads in %.2fs, %u failed\n", jobs.size(), threads, seconds, failed);
+    return failed ? 1 : 0;
+}